@@ -302,6 +302,7 @@ declarationItem:
           | include                            /* include file def'n                */
           | END                                /* EOF check if in an include file   */
                      {  if (!isTop())  restoreLexState(); 
+                        else             YYACCEPT;         /* declarations only */
                         DEBUG(methods->getInputFlag(), methods->debugOut("END", NULL);)
                      }
           ;
@@ -475,7 +476,7 @@ number:     INTEGER                         /* SlipDatum((long)integer)
 void parser::error(const location_type& loc, const std::string& msg) {
 //   fprintf(stderr, "%s %4d:%4d %s\n"
 //                 , getFileName().c_str()
-   fprintf(stderr, "%4d:%4d %s\n"
+   if (lexerMessage()) fprintf(stderr, "%4d:%4d %s\n"
                  , loc.begin.line
                  , loc.begin.column
                  , msg.c_str());
@@ -748,6 +748,7 @@ namespace slip {
   case 12:
 
     {  if (!isTop())  restoreLexState(); 
+                        else             YYACCEPT;         /* declarations only */
                         DEBUG(methods->getInputFlag(), methods->debugOut("END", NULL);)
                      }
 
@@ -1496,7 +1497,7 @@ namespace slip {
 void parser::error(const location_type& loc, const std::string& msg) {
 //   fprintf(stderr, "%s %4d:%4d %s\n"
 //                 , getFileName().c_str()
-   fprintf(stderr, "%4d:%4d %s\n"
+   if (lexerMessage()) fprintf(stderr, "%4d:%4d %s\n"
                  , loc.begin.line
                  , loc.begin.column
                  , msg.c_str());
@@ -94,7 +94,7 @@ namespace slip {
        * @brief Required method of a <em>SlipCellBase</em> subclass
        * <p>Does nothing.</p>
        */
-      virtual string toString() const { return ""; }
+      string toString() const { return ""; }
    }; // class GetOperator : public SlipCellBase {
 
    static GetOperator op;
@@ -1899,8 +1899,13 @@ namespace slip {
    void printFragmentList(string str) { SlipCellBase::printFragmentList(str); }   // format and output the fragment list
    void printMemory(string str) { SlipCellBase::printMemory(str); }               // Output entire memory contents
    void printState(string str) { SlipCellBase::printState(str); }                 // Output the AVSL state
+   ULONG reclaim(ULONG budget) { return SlipCellBase::reclaim(budget); }          // Recover deferred cells
+   void setAVSLGrowth(ULONG growth, ULONG limit) { SlipCellBase::setAVSLGrowth(growth, limit); } // Set incremental allocation growth
+   void setAVSLSource(avslSource source) { SlipCellBase::setAVSLSource(source); } // Set fragment memory source
+   void setReclaimBudget(ULONG budget) { SlipCellBase::setReclaimBudget(budget); } // Set deferred cells reclaimed per allocation
    errorType  setErrorState(errorType state, string err) { return slip::SlipErr::setErrorState(state, err); }       // Set error message state
    void sysInfo(ostream& out) { SlipCellBase::sysInfo(out); }                     // Output the SLIP system info
+   size_t trim() { return SlipCellBase::trim(); }                                 // Return free fragments to the system
    void slipInit() { SlipCellBase::slipInit(); }                                  // Initialize SLIP system
    void slipInit(ULONG alloc, ULONG lta) { SlipCellBase::slipInit(alloc, lta); }  // Initialize SLIP system and allocation resources
    errorCallback setCallBack(errorCallback callBack) { return userCallBack(callBack); }  // Set user defined error callback function.s
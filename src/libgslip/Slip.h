@@ -105,8 +105,13 @@
  * | printFragmentList | format and output the fragment list            |
  * | printMemory       | Output entire memory contents                  |
  * | printState        | Output the AVSL state                          |
+ * | reclaim           | Recover deferred cells                         |
+ * | setAVSLGrowth     | Set incremental allocation growth              |
+ * | setAVSLSource     | Set fragment memory source                     |
+ * | setReclaimBudget  | Set deferred cells reclaimed per allocation    |
  * | setErrorState     | Set the error message state                    |
  * | sysInfo           | Output the SLIP system info                    |
+ * | trim              | Return free fragments to the system            |
  * | slipInit          | Initialize SLIP system                         |
  * | slipInit          | Initialize SLIP system and allocation resources|
  * 
@@ -337,8 +342,13 @@ namespace slip {
        extern  void    printFragmentList(string str = "");                      // format and output the fragment list
        extern  void    printMemory(string str = "");                            // Output entire memory contents
        extern  void    printState(string str = "");                             // Output the AVSL state
+       extern  ULONG   reclaim(ULONG budget);                                   // Recover deferred cells
+       extern  void    setAVSLGrowth(ULONG growth, ULONG limit);                // Set incremental allocation growth
+       extern  void    setAVSLSource(avslSource source);                        // Set fragment memory source
+       extern  void    setReclaimBudget(ULONG budget);                          // Set deferred cells reclaimed per allocation
        extern  errorType  setErrorState(errorType state, string err);           // Set error message state
        extern  void    sysInfo(ostream& out);                                   // Output the SLIP system info
+       extern  size_t  trim();                                                  // Return free fragments to the system
        extern  void    slipInit();                                              // Initialize SLIP system
        extern  void    slipInit(ULONG alloc, ULONG lta);                        // Initialize SLIP system and allocation resources
        extern  errorCallback setCallBack(errorCallback callBack);               // Set user defined error callback function.s
@@ -612,6 +612,7 @@ namespace slip {
          } else {
             setRightLink(X.getLeftLink(), X.getRightLink());
             setLeftLink(X.getRightLink(), X.getLeftLink());
+            countLinked(X.getLeftLink(), X.getRightLink(), -1);
             insertLeft(X);
          }
       }
@@ -644,12 +645,16 @@ namespace slip {
          }
          SlipHeader& header = *headerPtr;
          if (checkHeader(X, "moveListLeft") && !header.isEmpty()) {
+            ULONG count = header.countGet();
+            SlipCellBase* top = &header.getTop();
             setLeftLink(&header.getTop(), getLeftLink());
             setRightLink(&header.getBot(), this);
             setRightLink(getLeftLink(), &header.getTop());
             setLeftLink(this, &header.getBot());
             setLeftLink(&header, &header);
             setRightLink(&header, &header);
+            header.countEmpty();
+            countLinked(top->getLeftLink(), this, count, count < COUNTINDEXED);
          }
       }
       return *this;
@@ -681,12 +686,16 @@ namespace slip {
          }
          SlipHeader& header = *headerPtr;
          if (checkHeader(X, "moveListRight") && !header.isEmpty()) {
+            ULONG count = header.countGet();
+            SlipCellBase* bot = &header.getBot();
             setLeftLink(&header.getTop(), this);
             setRightLink(&header.getBot(), getRightLink());
             setLeftLink(getRightLink(), &header.getBot());
             setRightLink(this, &header.getTop());
             setLeftLink(&header, &header);
             setRightLink(&header, &header);
+            header.countEmpty();
+            countLinked(this, bot->getRightLink(), count, count < COUNTINDEXED);
          }
       }
       return *this;
@@ -730,6 +739,7 @@ namespace slip {
          } else {
             setRightLink(X.getLeftLink(), X.getRightLink());
             setLeftLink(X.getRightLink(), X.getLeftLink());
+            countLinked(X.getLeftLink(), X.getRightLink(), -1);
             insertRight(X);
          }
       }
@@ -752,12 +762,14 @@ namespace slip {
    /**
     * @brief Replace the current object with the new one.
     * <p>The current object is unlinked and the new object replaces it in its
-    *    former location.</p>
+    *    former location. A Descriptor List index holding the current object
+    *    is discarded.</p>
     * @note No object verification is performed. It is assumed the the current
     *       object and its replacement are valid.
     * @param[in,out] X (SlipCell&) replacement object
     */
    void SlipCell::replaceLinks(SlipCell& X) {                                   // Set links of <prev, next, X) & unlink this
+      dListChanged(this);
       setRightLink(getLeftLink(), &X);
       setLeftLink(&X, getLeftLink());
       setLeftLink(getRightLink(), &X);
@@ -785,6 +797,7 @@ namespace slip {
       } else if (checkThis(*this, "unLink")) {
          setRightLink(getLeftLink(), getRightLink());
          setLeftLink(getRightLink(), getLeftLink());
+         countLinked(getLeftLink(), getRightLink(), -1);
          setLeftLink(NULL);
          setRightLink(NULL);
       }
@@ -822,5 +835,90 @@ namespace slip {
    string     SlipCell::write() const { return ((SlipOp*)*getOperator())->write(*this);} // String in output format
 
 
+
+       /*************************************************
+        *               Derived Dispatch                *
+       *************************************************/
+   /*
+    * SLIP cells do not carry a vptr. The class type of the cell operator
+    * selects the derived class method. Anything which is not a SlipHeader
+    * or a SlipSublist is a SlipDatum. The selection is made once, in
+    * derived(), and a visitor names the method applied to the derived
+    * object.
+    */
+
+   template<typename Visitor>
+   typename Visitor::result SlipCell::derived(const Visitor& visit) {
+      switch(getClassType()) {
+         case eHEADER:  return visit(*(SlipHeader*)this);
+         case eSUBLIST: return visit(*(SlipSublist*)this);
+         default:       return visit(*(SlipDatum*)this);
+      }
+   }; // typename Visitor::result SlipCell::derived(const Visitor& visit)
+
+   struct SlipCell::Factory {
+      typedef SlipCell& result;
+      template<typename T> result operator()(T& Y) const { return Y.factory(); }
+   }; // struct SlipCell::Factory
+
+   struct SlipCell::Equal {
+      typedef bool result;
+      const SlipCell& X;
+      template<typename T> result operator()(T& Y) const { return Y.operator==(X); }
+   }; // struct SlipCell::Equal
+
+   struct SlipCell::Dump {
+      typedef void result;
+      ostream& out;
+      int&     col;
+      template<typename T> result operator()(T& Y) const { Y.dump(out, col); }
+   }; // struct SlipCell::Dump
+
+   template<typename X>
+   struct SlipCell::Assign {
+      typedef SlipCell& result;
+      X x;
+      template<typename T> result operator()(T& Y) const { return Y.operator=(x); }
+   }; // struct SlipCell::Assign
+
+   template<typename X>
+   struct SlipCell::Replace {
+      typedef SlipCell& result;
+      X x;
+      template<typename T> result operator()(T& Y) const { return Y.replace(x); }
+   }; // struct SlipCell::Replace
+
+   template<typename X, typename F>
+   struct SlipCell::ReplaceFlag {
+      typedef SlipCell& result;
+      X x;
+      F flag;
+      template<typename T> result operator()(T& Y) const { return Y.replace(x, flag); }
+   }; // struct SlipCell::ReplaceFlag
+
+   SlipCell& SlipCell::factory()                             { return derived(Factory{}); }
+   SlipCell& SlipCell::replace(const SlipCell& X)            { return derived(Replace<const SlipCell&>{X}); }
+   SlipCell& SlipCell::replace(bool X)                       { return derived(Replace<bool>{X}); }
+   SlipCell& SlipCell::replace(CHAR X)                       { return derived(Replace<CHAR>{X}); }
+   SlipCell& SlipCell::replace(UCHAR X)                      { return derived(Replace<UCHAR>{X}); }
+   SlipCell& SlipCell::replace(LONG X)                       { return derived(Replace<LONG>{X}); }
+   SlipCell& SlipCell::replace(ULONG X)                      { return derived(Replace<ULONG>{X}); }
+   SlipCell& SlipCell::replace(DOUBLE X)                     { return derived(Replace<DOUBLE>{X}); }
+   SlipCell& SlipCell::replace(const PTR X, const void* operation) { return derived(ReplaceFlag<const PTR, const void*>{X, operation}); }
+   SlipCell& SlipCell::replace(const string& X, bool constFlag)    { return derived(ReplaceFlag<const string&, bool>{X, constFlag}); }
+   SlipCell& SlipCell::replace(const string* X, bool constFlag)    { return derived(ReplaceFlag<const string*, bool>{X, constFlag}); }
+   SlipCell& SlipCell::operator=(const SlipCell& X)          { return derived(Assign<const SlipCell&>{X}); }
+   SlipCell& SlipCell::operator=(const bool    X)            { return derived(Assign<const bool>{X}); }
+   SlipCell& SlipCell::operator=(const CHAR    X)            { return derived(Assign<const CHAR>{X}); }
+   SlipCell& SlipCell::operator=(const DOUBLE  X)            { return derived(Assign<const DOUBLE>{X}); }
+   SlipCell& SlipCell::operator=(const LONG    X)            { return derived(Assign<const LONG>{X}); }
+   SlipCell& SlipCell::operator=(const UCHAR   X)            { return derived(Assign<const UCHAR>{X}); }
+   SlipCell& SlipCell::operator=(const ULONG   X)            { return derived(Assign<const ULONG>{X}); }
+   SlipCell& SlipCell::operator=(const PTR     X)            { return derived(Assign<const PTR>{X}); }
+   SlipCell& SlipCell::operator=(const string& X)            { return derived(Assign<const string&>{X}); }
+   SlipCell& SlipCell::operator=(const string* X)            { return derived(Assign<const string*>{X}); }
+   bool      SlipCell::operator==(const SlipCell& X)         { return derived(Equal{X}); }
+   void      SlipCell::dump(ostream& out, int& col)          { derived(Dump{out, col}); }
+
 } // namespace slip
 
@@ -326,7 +326,7 @@ namespace slip {
 
 class SlipCell : public SlipCellBase {
 /**
- * @fn virtual string dump() const;
+ * @fn string dump() const;
  * @brief Return hexadecimal string of object.
  * <p>Each derived cell returns a hexadecimal string of the derived object. A
  *    "dump" is an invariant property of an object and the dump method is
@@ -334,13 +334,14 @@ class SlipCell : public SlipCellBase {
  *    in the appropriate derived class.</p>
  * @return hexadecimal string representing the object
  * 
- * @fn virtual SlipCell& factory() = 0
+ * @fn SlipCell& factory()
  * @brief Construct a duplicate of the current cell.
  * <p>Usage: <tt><b>object.factory()</b></tt></p>
  * <p>A blind copy of a cell is created. The using method has an object of type
- *    SlipCell and wants to create a copy of it. The <em>factory</em> is a 
- *    virtual method and determines what derived object is and then executes
- *    the derived class's version of <em>factory</em> to create the copy.</p>
+ *    SlipCell and wants to create a copy of it. The <em>factory</em> uses
+ *    the class type of the cell operator to determine what derived object is
+ *    and then executes the derived class's version of <em>factory</em> to
+ *    create the copy.</p>
  * <p>For each derived class, <em>factory</em> becomes:</p>
  * <ul>
  *    <li><b>SlipDatum</b> <tt>SlipDatum(object)</tt> create a new SlipDatum 
@@ -697,6 +698,15 @@ class SlipCell : public SlipCellBase {
     **********************************************************/
 private:
 
+   struct Factory;                                                              // Derived dispatch of factory()
+   struct Equal;                                                                // Derived dispatch of operator==
+   struct Dump;                                                                 // Derived dispatch of dump()
+   template<typename X>             struct Assign;                              // Derived dispatch of operator=
+   template<typename X>             struct Replace;                             // Derived dispatch of replace(X)
+   template<typename X, typename F> struct ReplaceFlag;                         // Derived dispatch of replace(X, flag)
+   template<typename Visitor>
+   typename Visitor::result derived(const Visitor& visit);                      // Apply visit to the derived object
+
     /*********************************************************
      *                  Protected Functions                  *
      *********************************************************/
@@ -718,12 +728,13 @@ protected:
    SlipCell&         constructSlipCell(SlipCellBase& X) { return ((SlipCell&)X).factory();}   // Use a factory to construct a cell
    
    SlipCell&         copy(SlipCell& X)  { return X.factory(); }                 // Create a copy of the input cell
-   virtual SlipCell& factory() = 0;                                             // Create a SlipCell
+   SlipCell&         factory();                                                 // Create a SlipCell
    SlipCell&         insertLeft(SlipCell&    X) {                               // Insert X to current cell left
                         setRightLink((SlipCellBase*)&X, this);
                         setLeftLink((SlipCellBase*)&X, getLeftLink());
                         setRightLink(getLeftLink(), &X);
                         setLeftLink(&X);
+                        countLinked(X.getLeftLink(), this, 1);
                         return X;
                      }
    SlipCell&         insertRight(SlipCell&   X) {                               // Insert X to current cell right
@@ -731,6 +742,7 @@ protected:
                         X.setRightLink(getRightLink());
                         setLeftLink(getRightLink(), &X);
                         setRightLink(&X);
+                        countLinked(this, X.getRightLink(), 1);
                         return X;
                      }
     
@@ -747,7 +759,7 @@ public:
         *           Constructors & Destructors          *
         ************************************************/
    SlipCell() { }
-   virtual ~SlipCell() { }
+   ~SlipCell() { }
 
        /*************************************************
         *                Utility Methods                *
@@ -785,46 +797,46 @@ public:
    SlipCell&         moveListLeft(SlipCell& X);                                 // Move the list X to the left of the current cell
    SlipCell&         moveListRight(SlipCell& X);                                // Move the list X to the right of the current cell
 
-   virtual SlipCell& replace(const SlipCell& X) = 0;                            // Replace a cell on a list with a new cell
-   virtual SlipCell& replace(bool X)      = 0;                                  // Replace a cell on a list with a new cell
-   virtual SlipCell& replace(CHAR X)      = 0;                                  // Replace a cell on a list with a new cell
-   virtual SlipCell& replace(UCHAR X)     = 0;                                  // Replace a cell on a list with a new cell
-   virtual SlipCell& replace(LONG X)      = 0;                                  // Replace a cell on a list with a new cell
-   virtual SlipCell& replace(ULONG X)     = 0;                                  // Replace a cell on a list with a new cell
-   virtual SlipCell& replace(DOUBLE X)    = 0;                                  // Replace a cell on a list with a new cell
-   virtual SlipCell& replace(const PTR X, const void* operation = ptrOP) = 0;   // Replace a cell on a list with a new cell
-   virtual SlipCell& replace(const string& X, bool constFlag = false) = 0;      // Replace a cell on a list with a new cell
-   virtual SlipCell& replace(const string* X, bool constFlag = false) = 0;      // Replace a cell on a list with a new cell
+   SlipCell&         replace(const SlipCell& X);                                // Replace a cell on a list with a new cell
+   SlipCell&         replace(bool X);                                           // Replace a cell on a list with a new cell
+   SlipCell&         replace(CHAR X);                                           // Replace a cell on a list with a new cell
+   SlipCell&         replace(UCHAR X);                                          // Replace a cell on a list with a new cell
+   SlipCell&         replace(LONG X);                                           // Replace a cell on a list with a new cell
+   SlipCell&         replace(ULONG X);                                          // Replace a cell on a list with a new cell
+   SlipCell&         replace(DOUBLE X);                                         // Replace a cell on a list with a new cell
+   SlipCell&         replace(const PTR X, const void* operation = ptrOP);       // Replace a cell on a list with a new cell
+   SlipCell&         replace(const string& X, bool constFlag = false);          // Replace a cell on a list with a new cell
+   SlipCell&         replace(const string* X, bool constFlag = false);          // Replace a cell on a list with a new cell
 
            SlipCell& unLink();                                                  // Remove cell from list and return
 
        /*************************************************
         *             Assignment operators              *
        *************************************************/
-   virtual SlipCell& operator=(const SlipCell& X) = 0;                          // Y = V
-   virtual SlipCell& operator=(const bool    X) = 0;                            // Y = V
-   virtual SlipCell& operator=(const CHAR    X) = 0;                            // Y = V
-   virtual SlipCell& operator=(const DOUBLE  X) = 0;                            // Y = V
-   virtual SlipCell& operator=(const LONG    X) = 0;                            // Y = V
-   virtual SlipCell& operator=(const UCHAR   X) = 0;                            // Y = V
-   virtual SlipCell& operator=(const ULONG   X) = 0;                            // Y = V
-   virtual SlipCell& operator=(const PTR     X) = 0;                            // Y = V
-   virtual SlipCell& operator=(const string& X) = 0;                            // Y = V
-   virtual SlipCell& operator=(const string* X) = 0;                            // Y = V
+   SlipCell&         operator=(const SlipCell& X);                              // Y = V
+   SlipCell&         operator=(const bool    X);                                // Y = V
+   SlipCell&         operator=(const CHAR    X);                                // Y = V
+   SlipCell&         operator=(const DOUBLE  X);                                // Y = V
+   SlipCell&         operator=(const LONG    X);                                // Y = V
+   SlipCell&         operator=(const UCHAR   X);                                // Y = V
+   SlipCell&         operator=(const ULONG   X);                                // Y = V
+   SlipCell&         operator=(const PTR     X);                                // Y = V
+   SlipCell&         operator=(const string& X);                                // Y = V
+   SlipCell&         operator=(const string* X);                                // Y = V
 
        /*************************************************
         *              Logical operators                *
        *************************************************/
-   virtual bool      operator==(const SlipCell& X) = 0;                         // Y == X
+   bool              operator==(const SlipCell& X);                             // Y == X
            bool      operator!=(const SlipCell& X) { return !(*this == X); }    // Y == X
 
             /*****************************************
              *             Miscellaneous             *
              *****************************************/
-   virtual string    toString() const;                                          // pretty print SLIP cell
-   virtual string    write() const;                                             // String in output format
-   virtual string    dump()  const;                                             // return complete string data
-   virtual void      dump(ostream& out, int& col)  = 0;                         // Output the current cell
+   string            toString() const;                                          // pretty print SLIP cell
+   string            write() const;                                             // String in output format
+   string            dump()  const;                                             // return complete string data
+   void              dump(ostream& out, int& col);                              // Output the current cell
 };  // SlipCell
 
 };  // namespace slip
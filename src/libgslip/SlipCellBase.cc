@@ -31,12 +31,21 @@
 # include <iostream>
 # include <iomanip>
 # include <exception>
+# include <algorithm>
+# include <atomic>
+# include <mutex>
+# include <vector>
+# include <type_traits>
+# include <cstring>
+# include <sys/mman.h>
+# include <unistd.h>
 # include "SlipCellBase.h"
 # include "SlipCell.h"
 # include "SlipHeader.h"
 # include "SlipSublist.h"
 # include "SlipDatum.h"
 # include "SlipReader.h"
+# include "SlipReaderCell.h"
 # include "SlipGlobal.h"
 # include "SlipException.h"
 # include "SlipErr.h"
@@ -57,10 +66,22 @@
 using namespace std;
 
 namespace slip {
+   atomic<ULONG>             SlipCellBase::unloadedLists(0);                    //!< Lists waiting to be loaded when entered
+   SlipCellBase::ListLoader  SlipCellBase::listLoader = NULL;                   //!< Loads a list waiting to be loaded
+   atomic<bool>              SlipCellBase::dListIndexed(false);                 //!< A Descriptor List index was built
+   SlipCellBase::DListChange SlipCellBase::dListChange = NULL;                  //!< Discards the index holding a changed cell
+
    static bool avslHistoryFlag = false;                                         //!< history flag <em>true</em> when AVSL output wanted
    static bool firstTimeOnlyTime = false;                                       //!< Singleton flag for SLIP setup
    static ULONG const ALLOC = 25;                                               //!< Default initial and delta allocationof AVSL  cells
    static ULONG const MINALLOC = 25;                                            //!< Minimum cells to allocate on AVSL
+   static ULONG const AVSLBATCH = 64;                                           //!< Cells moved between a thread cache and the AVSL
+   static ULONG const MAXALLOC  = 1 << 20;                                      //!< Default largest incremental allocation of AVSL cells
+   static size_t const HUGEPAGE = 2 * 1024 * 1024;                              //!< Huge page size used to round mapped fragments
+   static atomic<ULONG> reclaimBudget(0);                                       //!< Deferred cells reclaimed per allocation, 0 is eager
+
+   static atomic<ULONG> knownCounts(0);                                         //!< Headers holding a known cell count
+   static_assert(sizeof(atomic<ULONG>) == sizeof(ULONG), "header count must be usable as an atomic");
 
    static const ULONG SlipCellBaseSize = sizeof(SlipCellBase);                  //!< Byte size of SlipCellBase
    static const ULONG SlipCellSize     = sizeof(SlipCell);                      //!< Byte size of SlipCell
@@ -75,6 +96,11 @@ namespace slip {
                                             max(SlipSublistSize,
                                                 SlipReaderSize))))))+ 3) / 4) * 4;
 
+   static_assert(!is_polymorphic<SlipCellBase>::value && !is_polymorphic<SlipCell>::value
+              && !is_polymorphic<SlipDatum>::value    && !is_polymorphic<SlipHeader>::value
+              && !is_polymorphic<SlipSublist>::value  && !is_polymorphic<SlipReaderCell>::value
+                , "SLIP cells must not carry a vptr");
+
    /**
     * @brief Administrative structure and methods for Available Space List.
     * <p>The state of the Available Space List. The state is defined as all
@@ -127,6 +153,8 @@ namespace slip {
     *       request. The created cell is always the first cell allocated from
     *       the heap, so that if <em>delta</em> cells are request then
     *       <em>delta - 1</em> are available.</li>
+    *   <li><em>index</em> Sorted index of the fragment list used to check
+    *       whether a cell is from the AVSL.</li>
     *   <li><em>highWater</em> High water mark: the largest address allocated from the heap.</li>
     *   <li><em>lowWater</em> Low water mark: the smallest address allocated from the heap.</li>
     *   <li>User Allocation Request Sizes</li>
@@ -140,9 +168,285 @@ namespace slip {
     *          and the AVSL is empty. If the delta allocation is zero and the
     *          initial allocation is exhausted an exception will be generated.</li>
     *          NOTE:this is the number of cells not the number of bytes.
+    *      <li><em>next</em> The number of cells in the next incremental
+    *          allocation. The first incremental allocation is <em>delta</em>
+    *          cells. Each incremental allocation multiplies <em>next</em> by
+    *          <em>growth</em> up to <em>limit</em> cells. A <em>growth</em>
+    *          of one (the default) allocates <em>delta</em> cells each time.</li>
+    *      <li><em>source</em> Where fragment space comes from, the C++ heap
+    *          (the default), anonymous memory maps or huge page backed memory
+    *          maps.</li>
     *   </ul>
+    *   <li><em>caches</em> The per thread caches of free cells (see AVSLCache).
+    *       Cells in a thread cache are free but are not in the AVSL. They are
+    *       counted in the reported number of free cells.</li>
+    *   <li><em>pendTop</em>, <em>pendBot</em> The deferred list. When a
+    *       reclaim budget is set (see <em>setReclaimBudget</em>) a deleted
+    *       list is appended to the deferred list without visiting its cells.
+    *       The cells are made free a few at a time by <em>reclaim</em>.
+    *       A thread which reclaims cells takes the whole deferred list into
+    *       its cache and makes the cells free from there without the lock.
+    *       Deferred cells are not counted in the reported number of free
+    *       cells.</li>
+    *   <li><em>pending</em> Non-zero when the deferred list is not empty.</li>
     * </ul>
-    */
+    * <p>The AVSL state is shared by all threads. Access is serialized by
+    *    <em>avslLock</em>. Threads do not access the AVSL directly when a
+    *    cell is allocated or deleted, they access their own AVSLCache and
+    *    only take the lock to move a batch of cells to or from the AVSL.</p>
+    */
+   struct AVSLCache;
+
+   /**
+    * @brief Per thread cache of free SLIP cells.
+    * <p>Each thread which creates or deletes SLIP cells owns a cache of free
+    *    cells. <em>operator new</em> and <em>addAVSLCells</em> use the cache
+    *    of the calling thread without synchronization. When the cache is
+    *    empty a batch of <em>AVSLBATCH</em> cells is moved from the AVSL to
+    *    the cache. Deleted cells are put on a separate return list, and when
+    *    it holds more than <em>2 * AVSLBATCH</em> cells the list is moved to
+    *    the bottom of the AVSL. Both transfers are done while holding
+    *    <em>avslLock</em>.</p>
+    * <p>A deleted cell is not reused from the cache. It goes to the bottom
+    *    of the AVSL and is reused after the free cells before it, as with a
+    *    single AVSL. A header deleted a second time after its first deletion
+    *    is then still free and the second deletion is ignored.</p>
+    * <p>The cache and the return list have the same format as the AVSL, a
+    *    singly linked list with the left link of each cell set to
+    *    <em>UNDEFDATA</em>. Cells are taken from the top and returned to the
+    *    bottom.</p>
+    * <p>The cache is registered with the AVSL state when it is first used and
+    *    is returned to the AVSL when the owning thread exits.</p>
+    */
+   struct AVSLCache {
+      SlipCellBase* top;                                     //!< Pointer to the first cached cell
+      SlipCellBase* bot;                                     //!< Pointer to the last  cached cell
+      atomic<ULONG> avail;                                   //!< Number of cached cells
+      SlipCellBase* freeTop;                                 //!< Pointer to the first returned cell
+      SlipCellBase* freeBot;                                 //!< Pointer to the last  returned cell
+      atomic<ULONG> freed;                                   //!< Number of returned cells
+      SlipCellBase* pendTop;                                 //!< Pointer to the first deferred cell taken
+      SlipCellBase* pendBot;                                 //!< Pointer to the last  deferred cell taken
+      atomic<ULONG> counter;                                 //!< Transaction counter
+
+      AVSLCache();
+      ~AVSLCache();
+      void fill();                                           // Move a batch of cells from the AVSL
+      void spill();                                          // Move all cells to the AVSL
+      void spillFreed();                                     // Move the returned cells to the AVSL
+      ULONG drain(ULONG budget);                             // Make taken deferred cells free
+      ULONG reclaim(ULONG budget);                           // Move deferred cells to the free list
+      void take();                                           // Take the AVSL deferred list
+
+      /**
+       * @brief Change the number of cached cells.
+       * <p>Only the owning thread changes the count. Other threads only read
+       *    it, so a relaxed load and store is sufficient.</p>
+       * @param[in] n signed change in the number of cells
+       */
+      void count(LONG n) {
+         avail.store(avail.load(memory_order_relaxed) + n, memory_order_relaxed);
+      }; // void count(LONG n)
+
+      /**
+       * @brief Increment the transaction counter and return the new value.
+       * @return transaction counter
+       */
+      ULONG tick() {
+         ULONG n = counter.load(memory_order_relaxed) + 1;
+         counter.store(n, memory_order_relaxed);
+         return n;
+      }; // ULONG tick()
+
+      /**
+       * @brief Empty the cache without returning cells to the AVSL.
+       */
+      void reset() {
+         top = bot = freeTop = freeBot = pendTop = pendBot = NULL;
+         avail.store(0, memory_order_relaxed);
+         freed.store(0, memory_order_relaxed);
+      }; // void reset()
+   }; // struct AVSLCache
+
+   /**
+    * @brief Sorted index of AVSL fragments.
+    * <p>Each allocation of AVSL space from the heap has one entry holding the
+    *    lowest and highest cell address of the allocation and a pointer to
+    *    the matching cell in the fragment list. Entries are sorted by address
+    *    and do not overlap. <em>find</em> is a binary search, so checking
+    *    whether a cell is from the AVSL does not depend on the number of
+    *    fragments.</p>
+    * <p>Entries are only added or removed while holding <em>avslLock</em>.
+    *    Readers do not take the lock. The writer makes <em>sequence</em> odd while the
+    *    entries are changed and even when the change is complete; a reader
+    *    retries a search which overlapped a change. When the entry array is
+    *    full a larger copy is published and the old array is retained until
+    *    the index is cleared, because a reader may still be searching it.</p>
+    */
+   struct FragmentIndex {
+      /**
+       * @brief A single index entry.
+       */
+      struct Entry {
+         atomic<SlipCellBase*> lowWater;                     //!< smallest cell address in the fragment
+         atomic<SlipCellBase*> highWater;                    //!< largest cell address in the fragment
+         SlipCellBase*         record;                       //!< fragment list cell
+         avslSource            source;                       //!< fragment memory source
+      }; // struct Entry
+
+      atomic<Entry*> entries;                                //!< sorted entries
+      atomic<ULONG>  size;                                   //!< number of entries in use
+      atomic<ULONG>  sequence;                               //!< odd while a change is in progress
+      ULONG          capacity;                               //!< number of entries allocated
+      vector<Entry*> retired;                                //!< replaced entry arrays
+
+      FragmentIndex() : entries(NULL), size(0), sequence(0), capacity(0) { }
+
+      /**
+       * @brief Return the position of the first entry above an address.
+       * <p>The caller must hold <em>avslLock</em>.</p>
+       * @param[in] X address being located
+       * @return index of the first entry whose low water mark is above X
+       */
+      ULONG position(const SlipCellBase* X) const {
+         Entry* e  = entries.load(memory_order_relaxed);
+         ULONG  lo = 0;
+         ULONG  hi = size.load(memory_order_relaxed);
+         while (lo < hi) {
+            ULONG mid = (lo + hi) / 2;
+            if (X < e[mid].lowWater.load(memory_order_relaxed)) hi = mid;
+            else                                                 lo = mid + 1;
+         }
+         return lo;
+      }; // ULONG position(const SlipCellBase* X) const
+
+      /**
+       * @brief Return <b>true</b> if the address is in an indexed fragment.
+       * @param[in] X address being checked
+       * @return <b>true</b> X is in a fragment, <b>false</b> otherwise
+       */
+      bool find(const SlipCellBase* X) const {
+         for (;;) {
+            ULONG seq = sequence.load(memory_order_acquire);
+            if (seq & 1) continue;
+            Entry* e  = entries.load(memory_order_acquire);
+            ULONG  lo = 0;
+            ULONG  hi = size.load(memory_order_acquire);
+            bool   flag = false;
+            while (lo < hi) {
+               ULONG mid = (lo + hi) / 2;
+               if      (X < e[mid].lowWater.load(memory_order_relaxed))  hi = mid;
+               else if (X > e[mid].highWater.load(memory_order_relaxed)) lo = mid + 1;
+               else { flag = true; break; }
+            }
+            atomic_thread_fence(memory_order_acquire);
+            if (sequence.load(memory_order_relaxed) == seq) return flag;
+         }
+      }; // bool find(const SlipCellBase* X) const
+
+      /**
+       * @brief Return the entry holding an address.
+       * <p>The caller must hold <em>avslLock</em>.</p>
+       * @param[in] X address being located
+       * @param[out] i position of the entry holding X
+       * @return <b>true</b> X is in a fragment, <b>false</b> otherwise
+       */
+      bool locate(const SlipCellBase* X, ULONG& i) const {
+         i = position(X);
+         if (i == 0) return false;
+         i--;
+         return X <= entries.load(memory_order_relaxed)[i].highWater.load(memory_order_relaxed);
+      }; // bool locate(const SlipCellBase* X, ULONG& i) const
+
+      /**
+       * @brief Insert an entry at a position.
+       * <p>The caller must hold <em>avslLock</em>.</p>
+       * @param[in] i position of the new entry (see <em>position</em>)
+       * @param[in] lowWater smallest cell address in the fragment
+       * @param[in] highWater largest cell address in the fragment
+       * @param[in] record fragment list cell
+       * @param[in] source fragment memory source
+       */
+      void insert(ULONG i, SlipCellBase* lowWater, SlipCellBase* highWater, SlipCellBase* record, avslSource source) {
+         ULONG  n   = size.load(memory_order_relaxed);
+         ULONG  seq = sequence.load(memory_order_relaxed);
+         Entry* e   = entries.load(memory_order_relaxed);
+         sequence.store(seq + 1, memory_order_relaxed);
+         atomic_thread_fence(memory_order_release);
+         if (n == capacity) {
+            capacity = max((ULONG)16, 2 * capacity);
+            Entry* copy = new Entry[capacity];
+            for (ULONG j = 0; j < n; j++) move(copy[j], e[j]);
+            if (e != NULL) retired.push_back(e);
+            e = copy;
+            entries.store(e, memory_order_release);
+         }
+         for (ULONG j = n; j > i; j--) move(e[j], e[j - 1]);
+         e[i].lowWater.store(lowWater, memory_order_relaxed);
+         e[i].highWater.store(highWater, memory_order_relaxed);
+         e[i].record = record;
+         e[i].source = source;
+         size.store(n + 1, memory_order_release);
+         sequence.store(seq + 2, memory_order_release);
+      }; // void insert(ULONG i, SlipCellBase* lowWater, SlipCellBase* highWater, SlipCellBase* record, avslSource source)
+
+      /**
+       * @brief Remove the entry at a position.
+       * <p>The caller must hold <em>avslLock</em>.</p>
+       * @param[in] i position of the entry
+       */
+      void remove(ULONG i) {
+         ULONG  n   = size.load(memory_order_relaxed);
+         ULONG  seq = sequence.load(memory_order_relaxed);
+         Entry* e   = entries.load(memory_order_relaxed);
+         sequence.store(seq + 1, memory_order_relaxed);
+         atomic_thread_fence(memory_order_release);
+         for (ULONG j = i + 1; j < n; j++) move(e[j - 1], e[j]);
+         size.store(n - 1, memory_order_release);
+         sequence.store(seq + 2, memory_order_release);
+      }; // void remove(ULONG i)
+
+      /**
+       * @brief Remove all entries and release the entry arrays.
+       * <p>No other thread may be searching the index.</p>
+       */
+      void clear() {
+         for (unsigned int i = 0; i < retired.size(); i++) delete[] retired[i];
+         retired.clear();
+         delete[] entries.load(memory_order_relaxed);
+         entries.store(NULL, memory_order_relaxed);
+         size.store(0, memory_order_relaxed);
+         capacity = 0;
+      }; // void clear()
+
+      /**
+       * @brief Return the fragment list cell of an entry.
+       * @param[in] i entry position
+       * @return fragment list cell
+       */
+      SlipCellBase* record(ULONG i) const {
+         return entries.load(memory_order_relaxed)[i].record;
+      }; // SlipCellBase* record(ULONG i) const
+
+      /**
+       * @brief Return an entry.
+       * <p>The caller must hold <em>avslLock</em>.</p>
+       * @param[in] i entry position
+       * @return entry
+       */
+      const Entry& entry(ULONG i) const {
+         return entries.load(memory_order_relaxed)[i];
+      }; // const Entry& entry(ULONG i) const
+
+   private:
+      static void move(Entry& to, const Entry& from) {
+         to.lowWater.store(from.lowWater.load(memory_order_relaxed), memory_order_relaxed);
+         to.highWater.store(from.highWater.load(memory_order_relaxed), memory_order_relaxed);
+         to.record = from.record;
+         to.source = from.source;
+      }; // static void move(Entry& to, const Entry& from)
+   }; // struct FragmentIndex
+
    struct AVSLState {
       SlipHeader*   AVSLList;                                //!< List of sorted AVSL fragments
       SlipCellBase* top;                                     //!< Pointer to the first AVSL cell
@@ -154,6 +458,15 @@ namespace slip {
       ULONG         alloc;                                   //!< Initial cells to allocate from the heap
       ULONG         delta;                                   //!< Incremental cells to allocate fromthe heap
       ULONG         counter;                                 //!< Transaction counter
+      ULONG         next;                                    //!< Cells in the next incremental allocation
+      ULONG         growth;                                  //!< Incremental allocation growth factor
+      ULONG         limit;                                   //!< Largest incremental allocation
+      avslSource    source;                                  //!< Fragment memory source
+      FragmentIndex index;                                   //!< Sorted fragment index
+      vector<AVSLCache*> caches;                             //!< Registered thread caches
+      SlipCellBase* pendTop;                                 //!< Pointer to the first deferred cell
+      SlipCellBase* pendBot;                                 //!< Pointer to the last  deferred cell
+      atomic<ULONG> pending;                                 //!< Non-zero if there are deferred cells
    private:
 
       /**
@@ -180,6 +493,12 @@ namespace slip {
          this->highWater = (SlipCellBase*)0x00000000;
          this->lowWater  = (SlipCellBase*)0xFFFFFFFF;
          this->counter   = 0;
+         this->next      = this->delta;
+         this->growth    = 1;
+         this->limit     = MAXALLOC;
+         this->source    = eHeap;
+         this->pendTop   = this->pendBot = NULL;
+         this->pending   = 0;
       }
    public:
       /**
@@ -210,6 +529,9 @@ namespace slip {
        * call the <i>slipInit</i> method to resume SLIP operations.</p>
        */
       void resetAVSLState() {
+         for (unsigned int i = 0; i < caches.size(); i++)
+            caches[i]->reset();
+         this->index.clear();
          this->AVSLList = NULL;
          this->alloc = 10000;
          this->delta = 10000;
@@ -219,6 +541,12 @@ namespace slip {
          this->highWater = (SlipCellBase*)0x00000000;
          this->lowWater  = (SlipCellBase*)0xFFFFFFFF;
          this->counter   = 0;
+         this->next      = this->delta;
+         this->growth    = 1;
+         this->limit     = MAXALLOC;
+         this->source    = eHeap;
+         this->pendTop   = this->pendBot = NULL;
+         this->pending   = 0;
       }; // void resetAVSLState()
       /**
        * @brief Allows dynamic setting of the heap allocation sizes.
@@ -230,27 +558,83 @@ namespace slip {
       void setAlloc(ULONG alloc, ULONG delta) {
          this->alloc = max(MINALLOC, alloc);
          this->delta = max(MINALLOC, delta);
+         this->next  = this->delta;
       }; // void setAlloc(ULONG alloc, ULONG total)
 
+      /**
+       * @brief Set the incremental allocation growth policy.
+       * <p>Errors in input are silently corrected. The growth factor is at
+       *    least one and the limit is at least the delta allocation.</p>
+       * @param[in] growth (ULONG) factor applied after each incremental allocation
+       * @param[in] limit (ULONG) largest incremental allocation in cells
+       */
+      void setGrowth(ULONG growth, ULONG limit) {
+         this->growth = max((ULONG)1, growth);
+         this->limit  = max(this->delta, limit);
+         this->next   = min(this->next, this->limit);
+      }; // void setGrowth(ULONG growth, ULONG limit)
+
+      /**
+       * @brief Return the number of cells in the next heap allocation.
+       * <p>The first allocation is <em>alloc</em> cells. Later allocations
+       *    are <em>next</em> cells and <em>next</em> grows geometrically to
+       *    the limit.</p>
+       * @return number of cells to allocate
+       */
+      ULONG request() {
+         if (total == 0) return alloc;
+         ULONG cells = next;
+         next = (ULONG)min((unsigned long long)next * growth, (unsigned long long)limit);
+         return cells;
+      }; // ULONG request()
+
       /**
        * @brief Return a pretty-printed string for the AVSL state.
        * @return string pretty-printed string of the AVSL internal state
        */
       string toString() const {                            //! Pretty-print current state
-          ULONG used = total - avail;
+          ULONG free = avail + cached();
+          ULONG used = total - free;
           stringstream ss(stringstream::in | stringstream::out);
           ss << "AVSL State: Total Cells   " << total << '\n'
-             << "            Free  Cells   " << avail << '\n'
+             << "            Free  Cells   " << free  << '\n'
+             << "            Cache Cells   " << cached() << '\n'
              << "            Used  Cells   " << used  << '\n'
              << "            Delta Alloc   " << alloc << '\n'
              << "            Init  Alloc   " << delta << '\n'
+             << "            Next  Alloc   " << next  << '\n'
+             << "            Growth        " << growth << " limit " << limit << '\n'
+             << "            Source        " << ((source == eHeap)? "heap": (source == eMap)? "mmap": "huge page") << '\n'
              << "            Cell  Size    " << ::cellSize << " bytes\n"
-             << "            Transaction counter "         << counter << '\n'
+             << "            Thread Caches " << dec << caches.size() << '\n'
+             << "            Transaction counter "         << transactions() << '\n'
              << "            High  Address 0x" << setw(0) << setfill('0') << hex << highWater << '\n'
              << "            Low   Address 0x" << setw(0) << setfill('0') << hex << lowWater
              << endl;
           return ss.str();
       }; // string toString() const
+
+      /**
+       * @brief Return the number of free cells held in thread caches.
+       * @return number of cells in all registered thread caches
+       */
+      ULONG cached() const {
+         ULONG n = 0;
+         for (unsigned int i = 0; i < caches.size(); i++)
+            n += caches[i]->avail.load(memory_order_relaxed) + caches[i]->freed.load(memory_order_relaxed);
+         return n;
+      }; // ULONG cached() const
+
+      /**
+       * @brief Return the number of AVSL transactions for all threads.
+       * @return AVSL and thread cache transaction count
+       */
+      ULONG transactions() const {
+         ULONG n = counter;
+         for (unsigned int i = 0; i < caches.size(); i++)
+            n += caches[i]->counter.load(memory_order_relaxed);
+         return n;
+      }; // ULONG transactions() const
    }; // struct avslState
 
    /**
@@ -266,6 +650,183 @@ namespace slip {
     *    removed when the program terminates.</p>
     */
    static AVSLState avsl(10000, 10000);                                         //!< AVSL State with default allocation values
+   static mutex     avslLock;                                                   //!< Serializes access to the AVSL state
+   static thread_local AVSLCache cache;                                         //!< Free cells owned by this thread
+
+   /**
+    * @brief Register the thread cache with the AVSL state.
+    */
+   AVSLCache::AVSLCache() : top(NULL), bot(NULL), avail(0), freeTop(NULL), freeBot(NULL), freed(0)
+                        , pendTop(NULL), pendBot(NULL), counter(0) {
+      lock_guard<mutex> guard(avslLock);
+      avsl.caches.push_back(this);
+   }; // AVSLCache::AVSLCache()
+
+   /**
+    * @brief Return the thread cache to the AVSL and unregister it.
+    * <p>Executed when the owning thread exits. The transaction count is
+    *    retained in the AVSL state. Deferred cells taken by the thread are
+    *    put back on the deferred list.</p>
+    */
+   AVSLCache::~AVSLCache() {
+      spill();
+      lock_guard<mutex> guard(avslLock);
+      if (pendTop != NULL) {
+         if (avsl.pendTop == NULL) avsl.pendTop = pendTop;
+         else                      avsl.pendBot->rightLink = pendTop;
+         avsl.pendBot = pendBot;
+         avsl.pending.store(1, memory_order_relaxed);
+      }
+      avsl.counter += counter.load(memory_order_relaxed);
+      avsl.caches.erase(find(avsl.caches.begin(), avsl.caches.end(), this));
+   }; // AVSLCache::~AVSLCache()
+
+   /**
+    * @brief Move a batch of cells from the AVSL to the thread cache.
+    * <p>Up to <em>AVSLBATCH</em> cells are moved. Deferred cells taken by
+    *    the thread are made free first. If the AVSL and the return list are
+    *    empty then deferred cells are taken and made free instead, and if
+    *    there are none then space is retrieved from the heap before the
+    *    move. The new heap
+    *    fragment is recorded under the same lock, before its cells are
+    *    available to other threads.</p>
+    * <p>The cache must be empty on entry. Returned cells are moved to the
+    *    AVSL first, so that they are used before heap space is retrieved.</p>
+    */
+   void AVSLCache::fill() {
+      SlipCellBase* lowWater;
+      SlipCellBase* highWater;
+      avslSource    source;
+      drain(AVSLBATCH);
+      {
+         lock_guard<mutex> guard(avslLock);
+         if ((avsl.top == NULL) && (freeTop == NULL) && (avsl.pendTop != NULL)) {
+            take();
+            drain(AVSLBATCH);
+         }
+         if (freeTop != NULL) {
+            if (avsl.top == NULL) avsl.top = freeTop;
+            else                  avsl.bot->rightLink = freeTop;
+            avsl.bot    = freeBot;
+            avsl.avail += freed.load(memory_order_relaxed);
+            freeTop = freeBot = NULL;
+            freed.store(0, memory_order_relaxed);
+         }
+         if (avsl.top == NULL)
+            SlipCellBase::getAVSLSpace(lowWater, highWater, source);
+         SlipCellBase* last = avsl.top;
+         ULONG n = 1;
+         for (; (n < AVSLBATCH) && (last->rightLink != NULL); n++)
+            last = last->rightLink;
+         top = avsl.top;
+         bot = last;
+         avsl.top   = last->rightLink;
+         avsl.bot   = (avsl.top == NULL)? NULL: avsl.bot;
+         avsl.avail -= n;
+         avsl.counter++;
+         last->rightLink = NULL;
+         count(n);
+      }
+   }; // void AVSLCache::fill()
+
+   /**
+    * @brief Move all cells in the thread cache to the bottom of the AVSL.
+    * <p>The cached cells are moved before the returned cells.</p>
+    */
+   void AVSLCache::spill() {
+      spillFreed();
+      if (top == NULL) return;
+      lock_guard<mutex> guard(avslLock);
+      if (avsl.top == NULL) avsl.top = top;
+      else                  avsl.bot->rightLink = top;
+      avsl.bot    = bot;
+      avsl.avail += avail.load(memory_order_relaxed);
+      avsl.counter++;
+      top = bot = NULL;
+      avail.store(0, memory_order_relaxed);
+   }; // void AVSLCache::spill()
+
+   /**
+    * @brief Move the returned cells to the bottom of the AVSL.
+    */
+   void AVSLCache::spillFreed() {
+      if (freeTop == NULL) return;
+      lock_guard<mutex> guard(avslLock);
+      if (avsl.top == NULL) avsl.top = freeTop;
+      else                  avsl.bot->rightLink = freeTop;
+      avsl.bot    = freeBot;
+      avsl.avail += freed.load(memory_order_relaxed);
+      avsl.counter++;
+      freeTop = freeBot = NULL;
+      freed.store(0, memory_order_relaxed);
+   }; // void AVSLCache::spillFreed()
+
+   /**
+    * @brief Make deferred cells taken by the thread free.
+    * <p>At most <em>budget</em> cells are taken from the top of the taken
+    *    deferred cells and appended to the return list, as
+    *    <em>addAVSLCells</em> does for eagerly recovered cells. The cells
+    *    reach the bottom of the AVSL when the return list is moved. Sublist
+    *    cells are not evaluated, as for any other free cell. The cells are
+    *    owned by the thread and the lock is not used.</p>
+    * @param[in] budget largest number of cells to move
+    * @return number of cells moved
+    */
+   ULONG AVSLCache::drain(ULONG budget) {
+      SlipCellBase* start = pendTop;
+      SlipCellBase* stop  = NULL;
+      ULONG n = 0;
+      for (SlipCellBase* link = start; (link != NULL) && (n < budget); link = link->rightLink, n++) {
+         ULONG counter = tick();
+         if (avslHistoryFlag) {
+            SlipOp* op = *(SlipOp**)(link->getOperator());
+            cout << right << setw(8) << counter << setw(9) << freed
+                 << " delete " << op ->dump((SlipCell&)*link) << endl;
+         }
+         stop = link;
+      }
+      if (n == 0) return 0;
+      pendTop = stop->rightLink;
+      if (pendTop == NULL) pendBot = NULL;
+      stop->rightLink = NULL;
+      if (freeTop == NULL) freeTop = start;
+      else                 freeBot->rightLink = start;
+      freeBot = stop;
+      freed.store(freed.load(memory_order_relaxed) + n, memory_order_relaxed);
+      return n;
+   }; // ULONG AVSLCache::drain(ULONG budget)
+
+   /**
+    * @brief Move deferred cells to the thread return list.
+    * <p>If the thread has no deferred cells and the deferred list is not
+    *    empty, the deferred list is taken while holding <em>avslLock</em>.
+    *    At most <em>budget</em> cells are then made free without the lock.
+    *    The caller must not hold <em>avslLock</em>.</p>
+    * @param[in] budget largest number of cells to move
+    * @return number of cells moved
+    */
+   ULONG AVSLCache::reclaim(ULONG budget) {
+      if ((pendTop == NULL) && (avsl.pending.load(memory_order_relaxed) != 0)) {
+         lock_guard<mutex> guard(avslLock);
+         take();
+      }
+      return drain(budget);
+   }; // ULONG AVSLCache::reclaim(ULONG budget)
+
+   /**
+    * @brief Take the deferred list.
+    * <p>The deferred list is appended to the deferred cells of the thread
+    *    in constant time and the deferred list is made empty. The caller
+    *    must hold <em>avslLock</em>.</p>
+    */
+   void AVSLCache::take() {
+      if (avsl.pendTop == NULL) return;
+      if (pendTop == NULL) pendTop = avsl.pendTop;
+      else                 pendBot->rightLink = avsl.pendTop;
+      pendBot = avsl.pendBot;
+      avsl.pendTop = avsl.pendBot = NULL;
+      avsl.pending.store(0, memory_order_relaxed);
+   }; // void AVSLCache::take()
 
           /*************************************************
            *           Constructors & Destructors          *
@@ -315,8 +876,44 @@ namespace slip {
     * | SlipDatum*   datum = new SlipDatum((type)value); | null       |                   |
     *
     * </tt>
+    * <p>The constructor reads the links set by <em>operator new</em> before
+    *    they are assigned. It is not inline, so the read is compiled once
+    *    here and not in every file that constructs a cell.</p>
     * @return SlipCell marked as persistent or temporary
     */
+   SlipCellBase::SlipCellBase() {                                               // Mark a cell persistent or temporary
+      if ((leftLink == rightLink) && (rightLink == UNDEFDATA)) {
+         leftLink = rightLink = NULL;
+      } else
+         leftLink = rightLink = (SlipCellBase*)TEMPORARY;
+   }; // SlipCellBase::SlipCellBase()
+
+   /**
+    * @fn SlipCellBase::~SlipCellBase()
+    * @brief Return a SLIP cell to the AVSL.
+    * <p>SLIP cells do not have a vptr. The destructor uses the class type of
+    *    the cell operator to select the derived class release method, so that
+    *    <b>delete</b> of a base class pointer behaves as it did with virtual
+    *    destructors:</p>
+    * <ul>
+    *    <li><b>SlipHeader</b> <b>delete header</b> is illegal (E3024).</li>
+    *    <li><b>SlipSublist</b> the cell is unlinked and put into the AVSL.</li>
+    *    <li><b>SlipReaderCell</b> the cell is put into the AVSL.</li>
+    *    <li><b>SlipDatum</b> the cell is unlinked and put into the AVSL.</li>
+    * </ul>
+    * <p>A cell without an operator is not a SLIP object and is ignored. A
+    *    stack allocated temporary never enters the AVSL and is ignored, this
+    *    holds for a temporary SlipDatum assigned a sublist or a header.</p>
+    */
+   SlipCellBase::~SlipCellBase() {
+      if (operation == NULL || isTemp()) return;
+      switch(getClassType()) {
+         case eHEADER:  ((SlipHeader*)this)->release();     break;
+         case eSUBLIST: ((SlipSublist*)this)->release();    break;
+         case eREADER:  ((SlipReaderCell*)this)->release(); break;
+         default:       ((SlipDatum*)this)->release();      break;
+      }
+   }; // SlipCellBase::~SlipCellBase()
 
    /*********************************************************
     *               SLIP Protected Functions                *
@@ -367,18 +964,27 @@ namespace slip {
     *    the stop pointer. Anything else will irramedially damage the integrity of
     *    the AVSL.
     * </p>
-    * <p>In operation, the start cell will follow the last cell in the AVSL and the
-    *    stop cell becomes the new list bottom. The AVSL state will be changed:
+    * <p>The cells are put on the return list of the calling thread. In operation,
+    *    the start cell will follow the last returned cell and the stop cell
+    *    becomes the new return list bottom. The cache state will be changed:
     * </p>
     * <ul>
-    *    <li><b>avsl.top</b> points to <b>start</b> if the AVSL was empty, otherwise is
-    *        is unchanged.</li>
-    *    <li><b>avsl.bot</b> points to <b>stop</b>.</li>
-    *    <li><b>avsl.avail</b> is incremented for each cell added to the AVSL. Sublists
+    *    <li><b>cache.freeTop</b> points to <b>start</b> if the return list was empty,
+    *        otherwise is is unchanged.</li>
+    *    <li><b>cache.freeBot</b> points to <b>stop</b>.</li>
+    *    <li><b>cache.freed</b> is incremented for each cell returned. Sublists
     *        are not evaluated, therefore, if a sublist references a list that
     *        would have been returned to the AVSL, the list cells will not be
-    *        recovered and avsl.avail will not be incremented.</li>
+    *        recovered and cache.freed will not be incremented.</li>
     * </ul>
+    * <p>If the return list then holds more than <em>2 * AVSLBATCH</em> cells
+    *    it is moved to the bottom of the AVSL.</p>
+    * <p>If a reclaim budget is set (see <em>setReclaimBudget</em>) and more
+    *    than one cell is returned, each cell is only marked as deleted
+    *    before the list is appended to the deferred list, the cells are
+    *    counted and made free later by <em>reclaim</em>. Deleting the list,
+    *    or a stale cell of it, again is ignored as it is for eager
+    *    recovery.</p>
     * <p><b>ERRORS</b></p>
     * <ul>
     *    <li><b>E3010</b> Attempt to recover a range of cells where at least one cell is a temp</li>
@@ -393,28 +999,115 @@ namespace slip {
      if (isTemp(start) || isTemp(stop)) {
         postError(__FILE__, __LINE__, SlipErr::E3010, "addAVSLCells", "", "", *start, *stop);
      }
+     if ((start != stop) && (reclaimBudget.load(memory_order_relaxed) != 0)) {
+        stop->rightLink = NULL;
+        for(SlipCellBase* link = start; link != NULL; link = link->rightLink)
+           link->leftLink = (SlipCellBase*)UNDEFDATA;                          // a stale cell is seen as deleted
+        lock_guard<mutex> guard(avslLock);
+        if (avsl.pendTop == NULL) avsl.pendTop = start;
+        else                      avsl.pendBot->rightLink = start;
+        avsl.pendBot = stop;
+        avsl.pending.store(1, memory_order_relaxed);
+        return;
+     }
+     AVSLCache& local = cache;
      stop->rightLink = NULL;
      for(SlipCellBase* link = start; link != NULL; link = getRightLink(*link)) {
-         avsl.counter++;
+         ULONG counter = local.tick();
          if (avslHistoryFlag) {
            SlipOp* op = *(SlipOp**)(link->getOperator());
-           cout << right << setw(8) << avsl.counter << setw(9) << avsl.avail
+           cout << right << setw(8) << counter << setw(9) << local.freed
                 << " delete " << op ->dump((SlipCell&)*link) << endl;
          }
          if (link->isDeleted()) {
            postError(__FILE__, __LINE__, SlipErr::E3018, "addAVSLCells", "", "", *link);
            (link->leftLink)->rightLink = link->rightLink;
         } else {
-           avsl.avail++;
+           local.freed.store(local.freed.load(memory_order_relaxed) + 1, memory_order_relaxed);
            link->leftLink = (SlipCellBase*)UNDEFDATA;
         }
      }
-     avsl.top   = (avsl.top == NULL)? start: avsl.top;                          // if AVSL empty before add, change top
-     avsl.bot   = (avsl.bot == NULL)? NULL: avsl.bot->rightLink = start;        // if AVSL not empty link bottom
-     avsl.bot = stop;
+     local.freeTop = (local.freeTop == NULL)? start: local.freeTop;             // if return list empty before add, change top
+     if (local.freeBot != NULL) local.freeBot->rightLink = start;               // if return list not empty link bottom
+     local.freeBot = stop;
      stop->leftLink = (SlipCellBase*)UNDEFDATA;
+     if (local.freed.load(memory_order_relaxed) > 2 * AVSLBATCH)
+        local.spillFreed();
    }; // SlipCellBase::addAVSLCells( size_t size, SlipCellBase* start, SlipCellBase* stop)
 
+   /**
+    * @brief Set the growth policy for incremental AVSL allocations.
+    * <p>Each time the AVSL is empty space for more cells is retrieved. The
+    *    first incremental allocation is for <em>delta</em> cells (see
+    *    <em>slipInit</em>). After each incremental allocation the size of the
+    *    next one is multiplied by <em>growth</em> until it reaches
+    *    <em>limit</em> cells. The default growth factor of one allocates
+    *    <em>delta</em> cells every time.</p>
+    * <p>Geometric growth bounds the number of fragments for large lists to
+    *    the logarithm of the number of cells.</p>
+    * @param[in] growth (ULONG) growth factor, at least one
+    * @param[in] limit (ULONG) largest incremental allocation in cells
+    */
+   void SlipCellBase::setAVSLGrowth(ULONG growth, ULONG limit) {                // Set incremental allocation growth
+      lock_guard<mutex> guard(avslLock);
+      avsl.setGrowth(growth, limit);
+   }; // void SlipCellBase::setAVSLGrowth(ULONG growth, ULONG limit)
+
+   /**
+    * @brief Select where memory for new AVSL fragments comes from.
+    * <p>The source applies to fragments allocated after the call.</p>
+    * | source    | fragment memory                                        |
+    * | :-------- | :----------------------------------------------------- |
+    * | eHeap     | operator new[] (default)                               |
+    * | eMap      | anonymous mmap rounded to the page size                |
+    * | eHugePage | MAP_HUGETLB mmap, otherwise mmap and MADV_HUGEPAGE     |
+    * <p>Mapped fragments are rounded up to a page (huge page) boundary and
+    *    the cells filling the rounded size are put on the AVSL.</p>
+    * @param[in] source (avslSource) fragment memory source
+    */
+   void SlipCellBase::setAVSLSource(avslSource source) {                        // Set fragment memory source
+      lock_guard<mutex> guard(avslLock);
+      avsl.source = source;
+   }; // void SlipCellBase::setAVSLSource(avslSource source)
+
+   /**
+    * @brief Bound the work done to recover deleted lists.
+    * <p>By default deleting a list visits every cell in the list and
+    *    returns it to the AVSL before <em>deleteList</em> or <em>flush</em>
+    *    returns. Deleting a long list, or allocating a cell whose sublist
+    *    references the last copy of a long list, takes time proportional
+    *    to the length of the list.</p>
+    * <p>With a non-zero budget the cells of a deleted list are only marked
+    *    as deleted and the list is put on a deferred list. Each <em>operator new</em> then reclaims at most
+    *    <em>budget</em> deferred cells, and an empty AVSL is refilled from
+    *    deferred cells before the heap is used. An idle or background thread
+    *    can recover deferred cells with <em>reclaim</em>.</p>
+    * <p>A budget of zero restores eager recovery. Cells already deferred
+    *    remain deferred until they are reclaimed.</p>
+    * @param[in] budget (ULONG) deferred cells reclaimed per allocation
+    */
+   void SlipCellBase::setReclaimBudget(ULONG budget) {                          // Set deferred cells reclaimed per allocation
+      reclaimBudget.store(budget, memory_order_relaxed);
+   }; // void SlipCellBase::setReclaimBudget(ULONG budget)
+
+   /**
+    * @brief Recover deferred cells.
+    * <p>At most <em>budget</em> cells are taken from the deferred list and
+    *    returned to the bottom of the AVSL through the return list of the
+    *    calling thread (see <em>setReclaimBudget</em>).
+    *    A program can call this when idle, or from a background thread, to
+    *    keep the deferred list short.</p>
+    * @param[in] budget (ULONG) largest number of cells to recover
+    * @return number of cells recovered, zero when there are no deferred cells
+    */
+   ULONG SlipCellBase::reclaim(ULONG budget) {                                  // Recover deferred cells
+      AVSLCache& local = cache;
+      ULONG n = local.reclaim(budget);
+      if (local.freed.load(memory_order_relaxed) > 2 * AVSLBATCH)
+         local.spillFreed();
+      return n;
+   }; // ULONG SlipCellBase::reclaim(ULONG budget)
+
    /**
     * @brief Turn logging of cell posting/removal from the AVSL.
     * <p>Turns output logging of AVSL events on/off. there is an incrementing
@@ -454,18 +1147,180 @@ namespace slip {
      return pretty.str();
   }; //SlipCellBase::dumpLink(SlipCellBase const * const X)
 
+# ifdef SLIP_COMPRESSED_LINKS
+   char* SlipLink::base = NULL;                                                 //!< start of the reserved AVSL region
+
+   static mutex  regionLock;                                                    //!< Protect the region bookkeeping
+   static size_t regionTop = 0;                                                 //!< Bytes carved from the region
+   static vector<pair<size_t, size_t> > regionFree;                             //!< Released <offset, bytes> region ranges
+
+   static_assert(SLIP_LINK_REGION <= ((size_t)SlipLink::UNDEFINDEX << 3), "SLIP_LINK_REGION exceeds 32-bit links");
+
+  /**
+   * @brief Carve an AVSL fragment from the reserved link region.
+   * <p>The first call reserves <b>SLIP_LINK_REGION</b> bytes of address
+   *    space without committing memory. Each fragment is taken from a
+   *    released range when one is large enough, otherwise from the top of the
+   *    region, and its pages are made accessible. Offset zero is never used
+   *    so that it can encode <em>NULL</em>.</p>
+   * <p>As in <em>getFragmentSpace</em>, an <em>eHeap</em> fragment is
+   *    exactly the requested size and mapped fragments are rounded up to the
+   *    page size.</p>
+   * @param[in] source fragment memory source, <em>eHugePage</em> aligns the
+   *            fragment to a huge page and requests transparent huge pages
+   * @param[in,out] cells number of cells requested and provided
+   * @return pointer to the fragment memory
+   * @throws bad_alloc if the region is exhausted
+   */
+   static SlipCellBase* getRegionSpace(avslSource source, ULONG& cells) {
+      lock_guard<mutex> guard(regionLock);
+      size_t sysPage = (size_t)sysconf(_SC_PAGESIZE);
+      size_t page    = (source == eHugePage)? HUGEPAGE: sysPage;
+      size_t align   = (source == eHeap)? 8: page;
+      size_t bytes   = (size_t)cellSize * cells;
+      if (source != eHeap) bytes = ((bytes + page - 1) / page) * page;
+      if (SlipLink::base == NULL) {
+         void* space = mmap(NULL, SLIP_LINK_REGION, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+         if (space == MAP_FAILED) throw bad_alloc();
+         SlipLink::base = (char*)space;
+         regionTop = sysPage;
+      }
+      size_t offset = 0;
+      for (unsigned int i = 0; i < regionFree.size(); i++) {
+         if ((regionFree[i].second >= bytes) && ((regionFree[i].first % align) == 0)) {
+            offset = regionFree[i].first;
+            regionFree[i].first  += bytes;
+            regionFree[i].second -= bytes;
+            if (regionFree[i].second == 0) regionFree.erase(regionFree.begin() + i);
+            break;
+         }
+      }
+      if (offset == 0) {
+         offset = ((regionTop + align - 1) / align) * align;
+         if (offset + bytes > SLIP_LINK_REGION) throw bad_alloc();
+         regionTop = offset + bytes;
+      }
+      char*  space = SlipLink::base + offset;
+      size_t low   = (offset / sysPage) * sysPage;
+      size_t high  = ((offset + bytes + sysPage - 1) / sysPage) * sysPage;
+      if (mprotect(SlipLink::base + low, high - low, PROT_READ | PROT_WRITE) != 0) throw bad_alloc();
+# ifdef MADV_HUGEPAGE
+      if (source == eHugePage)
+         madvise(space, bytes, MADV_HUGEPAGE);
+# endif
+      cells = bytes / cellSize;
+      return (SlipCellBase*)space;
+   }; // static SlipCellBase* getRegionSpace(avslSource source, ULONG& cells)
+
+  /**
+   * @brief Return an AVSL fragment to the reserved link region.
+   * <p>The pages wholly inside the fragment are returned to the system. The
+   *    address range stays reserved and is reused by later fragments.</p>
+   * @param[in] source fragment memory source
+   * @param[in] space first cell in the fragment
+   * @param[in] cells number of cells in the fragment
+   * @return number of bytes released
+   */
+   static size_t releaseRegionSpace(avslSource source, SlipCellBase* space, ULONG cells) {
+      size_t sysPage = (size_t)sysconf(_SC_PAGESIZE);
+      size_t page    = (source == eHugePage)? HUGEPAGE: sysPage;
+      size_t bytes   = (size_t)cellSize * cells;
+      if (source != eHeap) bytes = ((bytes + page - 1) / page) * page;
+      size_t offset  = (char*)space - SlipLink::base;
+      size_t low     = ((offset + sysPage - 1) / sysPage) * sysPage;
+      size_t high    = ((offset + bytes) / sysPage) * sysPage;
+      if (high > low) madvise(SlipLink::base + low, high - low, MADV_DONTNEED);
+      lock_guard<mutex> guard(regionLock);
+      regionFree.push_back(make_pair(offset, bytes));
+      return bytes;
+   }; // static size_t releaseRegionSpace(avslSource source, SlipCellBase* space, ULONG cells)
+# endif
+
+  /**
+   * @brief Get memory for an AVSL fragment from the selected source.
+   * <p>Heap fragments are exactly the requested size and are not zero
+   *    filled, each cell is formatted before use. Mapped fragments are
+   *    rounded up to the page size (huge page size for <em>eHugePage</em>)
+   *    and the number of cells is increased to fill the mapping.</p>
+   * <p>For <em>eHugePage</em> an explicit huge page mapping (MAP_HUGETLB) is
+   *    tried first. If no huge pages are reserved an ordinary mapping is
+   *    made and transparent huge pages are requested (MADV_HUGEPAGE).</p>
+   * @param[in] source fragment memory source
+   * @param[in,out] cells number of cells requested and provided
+   * @return pointer to the fragment memory
+   * @throws bad_alloc if the memory is not available
+   */
+   static SlipCellBase* getFragmentSpace(avslSource source, ULONG& cells) {
+# ifdef SLIP_COMPRESSED_LINKS
+      return getRegionSpace(source, cells);
+# endif
+      size_t bytes = (size_t)cellSize * cells;
+      if (source == eHeap)
+         return (SlipCellBase*) new char[bytes];
+
+      size_t page = (source == eHugePage)? HUGEPAGE: (size_t)sysconf(_SC_PAGESIZE);
+      bytes = ((bytes + page - 1) / page) * page;
+      void*  space = MAP_FAILED;
+# ifdef MAP_HUGETLB
+      if (source == eHugePage)
+         space = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+# endif
+      if (space == MAP_FAILED) {
+         space = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+         if (space == MAP_FAILED) throw bad_alloc();
+# ifdef MADV_HUGEPAGE
+         if (source == eHugePage)
+            madvise(space, bytes, MADV_HUGEPAGE);
+# endif
+      }
+      cells = bytes / cellSize;
+      return (SlipCellBase*)space;
+   }; // static SlipCellBase* getFragmentSpace(avslSource source, ULONG& cells)
+
+  /**
+   * @brief Return the memory of an AVSL fragment to its source.
+   * <p>The size of a mapped fragment is recomputed by rounding the cells up
+   *    to the page size used by <em>getFragmentSpace</em>.</p>
+   * @param[in] source fragment memory source
+   * @param[in] space first cell in the fragment
+   * @param[in] cells number of cells in the fragment
+   * @return number of bytes released
+   */
+   static size_t releaseFragmentSpace(avslSource source, SlipCellBase* space, ULONG cells) {
+# ifdef SLIP_COMPRESSED_LINKS
+      return releaseRegionSpace(source, space, cells);
+# endif
+      size_t bytes = (size_t)cellSize * cells;
+      if (source == eHeap) {
+         delete[] (char*)space;
+         return bytes;
+      }
+      size_t page = (source == eHugePage)? HUGEPAGE: (size_t)sysconf(_SC_PAGESIZE);
+      bytes = ((bytes + page - 1) / page) * page;
+      munmap(space, bytes);
+      return bytes;
+   }; // static size_t releaseFragmentSpace(avslSource source, SlipCellBase* space, ULONG cells)
+
   /**
    *
    * @brief Allocates and initializes heap space for the AVSL list.
    * <p>A demand for a Slip cell on an empty AVSL causes a cal to this method
    *    to retrieve additional space from the heap. The retrieved space is
    *    formated into Slip cells and linked into the AVSL list..</p>
+   * <p>The first cell of the space is the fragment list cell. The fragment
+   *    is recorded (<em>newFragment</em>) before the other cells are linked
+   *    into the AVSL list, all under the same lock.</p>
+   * <p>The first request is for <em>avsl.alloc</em> cells. Later requests
+   *    follow the growth policy, see <em>setAVSLGrowth</em>. The space comes
+   *    from the source selected by <em>setAVSLSource</em>.</p>
+   * <p>The caller must hold <em>avslLock</em>.</p>
    * <p>A formatted Slip cell placed on the AVSL list consists of:</p>
    * <ul>
    *  <li><b>leftLink</b> set to <em>UNDEFDATA</em>.</li>
    *  <li><b>rightLink</b> points to the next cell. The last link is <em>null</em>.</li>
    *  <li><b>operator</b> points to <em>SlipUndefinedOp</em></li>
-   *  <li><b>datum</b> contains <em>(long)0</em>, <em>(long)0</em>.</li>
+   *  <li><b>datum</b> is cleared as each cell is formatted. The space is not
+   *      zero filled in a separate pass.</li>
    * </ul>
    * <p>On successful execution the AVSL state is changed to: </p>
    * <ul>
@@ -482,8 +1337,9 @@ namespace slip {
    *
    * @param[in,out] lowWater the lowest (smallest) address of the allocation
    * @param[in,out] highWater the highest (largest) address of the allocation
+   * @param[out] source where the allocation came from
    */
-   void SlipCellBase::getAVSLSpace(SlipCellBase*& lowWater, SlipCellBase*& highWater) {
+   void SlipCellBase::getAVSLSpace(SlipCellBase*& lowWater, SlipCellBase*& highWater, avslSource& source) {
        if (avsl.alloc == 0) {
           cout << "E3008: Unable to get " << avsl.alloc
                << " Slip Cells from the heap " << avsl.toString() << endl;
@@ -494,29 +1350,35 @@ namespace slip {
           exit(1);
        }
        firstTimeOnlyTime = true;
+       ULONG cells = avsl.request();
        try {
            ULONG i = 0;
-           SlipCellBase* array = (SlipCellBase*) new char[cellSize * avsl.alloc]();
+           source = avsl.source;
+           SlipCellBase* array = getFragmentSpace(source, cells);
            lowWater  = (SlipCellBase*)array;
-           highWater = (SlipCellBase*)array + avsl.alloc - 1;
+           highWater = (SlipCellBase*)array + cells - 1;
+
+           newFragment(lowWater, highWater, source);
 
            /**
             * Continue space setup
             */
-           avsl.top    = &array[0];
-           avsl.total += avsl.alloc;
-           avsl.avail += avsl.alloc;
-           for (; i < avsl.alloc - 1; i++ ) {
+           avsl.top    = &array[1];
+           avsl.total += cells;
+           avsl.avail += cells - 1;
+           for (i = 1; i < cells - 1; i++ ) {
                array[i].setOperator((void*)undefinedOP);
                array[i].rightLink = &array[i + 1];
                array[i].leftLink  = (SlipCellBase*)UNDEFDATA;
+               memset(&array[i].datum, 0, sizeof(Data));
            }
            array[i].setOperator((void*)undefinedOP);
            array[i].rightLink = NULL;
            array[i].leftLink  = (SlipCellBase*)UNDEFDATA;
+           memset(&array[i].datum, 0, sizeof(Data));
            avsl.bot = &array[i];
        } catch (bad_alloc& ba) {
-          cout << "E3008: Unable to get " << avsl.alloc
+          cout << "E3008: Unable to get " << cells
                << "Slip Cells from the heap " << avsl.toString() << endl;
            throw(ba);
        } catch (...) {
@@ -581,35 +1443,129 @@ namespace slip {
       cell->setRightLink(X);
    }; // void SlipCellBase::insertFragmentRight(SlipCellBase* cell, SlipCellBase* X)
 
+          /*****************************************
+           *      Header Cell Count Functions      *
+          ******************************************/
+   /**
+    * @brief Add n to a known header cell count.
+    * <p>An unknown count (<em>COUNTUNKNOWN</em>) is unchanged. A count kept
+    *    by a Descriptor List index (<em>COUNTINDEXED</em>) becomes unknown,
+    *    which discards the index.</p>
+    * @param[in] n number of cells added (negative for removed cells)
+    */
+   void SlipCellBase::countAdd(LONG n) {                                        // Add n to a known header count
+      atomic<ULONG>& count = *reinterpret_cast<atomic<ULONG>*>(getHeadCount());
+      ULONG old = count.load(memory_order_relaxed);
+      while ((old != COUNTUNKNOWN)
+          && !count.compare_exchange_weak(old, (old == COUNTINDEXED)? COUNTUNKNOWN: (ULONG)(old + n), memory_order_relaxed));
+      if (old == COUNTINDEXED) knownCounts.fetch_sub(1, memory_order_relaxed);
+   }; // void SlipCellBase::countAdd(LONG n)
+
+   /**
+    * @brief The header cell count becomes unknown.
+    * <p>The next <em>size()</em> walks the list.</p>
+    */
+   void SlipCellBase::countClear() {                                            // Header count becomes unknown
+      if (reinterpret_cast<atomic<ULONG>*>(getHeadCount())->exchange(COUNTUNKNOWN, memory_order_relaxed) != COUNTUNKNOWN)
+         knownCounts.fetch_sub(1, memory_order_relaxed);
+   }; // void SlipCellBase::countClear()
+
+   /**
+    * @brief A known header cell count becomes zero.
+    * <p>Used when all cells are removed from a list. An unknown count is
+    *    unchanged, a count kept by a Descriptor List index becomes
+    *    unknown.</p>
+    */
+   void SlipCellBase::countEmpty() {                                            // A known header count becomes zero
+      atomic<ULONG>& count = *reinterpret_cast<atomic<ULONG>*>(getHeadCount());
+      ULONG old = count.load(memory_order_relaxed);
+      while ((old != COUNTUNKNOWN)
+          && !count.compare_exchange_weak(old, (old == COUNTINDEXED)? COUNTUNKNOWN: 0, memory_order_relaxed));
+      if (old == COUNTINDEXED) knownCounts.fetch_sub(1, memory_order_relaxed);
+   }; // void SlipCellBase::countEmpty()
+
+   /**
+    * @brief Return the header cell count.
+    * @return the cell count or <em>COUNTUNKNOWN</em>
+    */
+   ULONG SlipCellBase::countGet() const {                                       // Header count or COUNTUNKNOWN
+      return reinterpret_cast<atomic<ULONG>*>(getHeadCount())->load(memory_order_relaxed);
+   }; // ULONG SlipCellBase::countGet() const
+
+   /**
+    * @brief Set a known header cell count.
+    * <p>The number of headers holding a known count is kept so that a change
+    *    inside a list need not look for its header when no count is known.
+    *    A header that is not from the AVSL keeps an unknown count.</p>
+    * @param[in] n number of cells in the list
+    */
+   void SlipCellBase::countPut(ULONG n) {                                       // Set a known header count
+      if (!isAVSL(this)) return;
+      if (reinterpret_cast<atomic<ULONG>*>(getHeadCount())->exchange(n, memory_order_relaxed) == COUNTUNKNOWN)
+         knownCounts.fetch_add(1, memory_order_relaxed);
+   }; // void SlipCellBase::countPut(ULONG n)
+
+   /**
+    * @brief Forget the count of a header being deleted.
+    */
+   void SlipCellBase::countRelease() {                                          // Forget a deleted header count
+      countClear();
+   }; // void SlipCellBase::countRelease()
+
+   /**
+    * @brief Account for n cells linked or unlinked between left and right.
+    * <p>If either neighbour is the list header its count is changed.
+    *    Otherwise, and only while some header holds a known count, the list
+    *    is walked outward from both neighbours at once until its header is
+    *    found, and that header count becomes unknown. The walk is no longer
+    *    than the shorter distance to the header, and once the count is
+    *    unknown later changes inside the same list do not walk. Counts of
+    *    other lists are not touched.</p>
+    * @param[in] left cell to the left of the change
+    * @param[in] right cell to the right of the change
+    * @param[in] n number of cells linked (negative when unlinked)
+    * @param[in] known <em>false</em> if n is not known
+    */
+   void SlipCellBase::countLinked(SlipCellBase* left, SlipCellBase* right, LONG n, bool known) {
+      SlipCellBase* header = (left  != NULL && left->isHeader())?  left
+                           : (right != NULL && right->isHeader())? right: NULL;
+      if (header != NULL) {
+         if (known) header->countAdd(n);
+         else       header->countClear();
+      } else if (knownCounts.load(memory_order_relaxed) > 0) {
+         SlipCellBase* leftCell  = left;
+         SlipCellBase* rightCell = right;
+         while ((leftCell != NULL) && (rightCell != NULL)) {
+            leftCell  = leftCell->getLeftLink();
+            rightCell = rightCell->getRightLink();
+            if ((leftCell == right) || (rightCell == left)) break;              // circular, no header
+            if ((leftCell != NULL) && leftCell->isHeader())   { leftCell->countClear();  break; }
+            if ((rightCell != NULL) && rightCell->isHeader()) { rightCell->countClear(); break; }
+         }
+      }
+   }; // void SlipCellBase::countLinked(SlipCellBase* left, SlipCellBase* right, LONG n, bool known)
+
    /**
     * @brief returns <b>true</b> if the input cell is from the AVSL.
     * <p>The input cell is checked to see if it is from any of the space
     *    fragments retrieved from the heap. If the input cell is not from the
     *    heap, the method returns <b>false</b>.</p>
+    * <p>The fragment index is binary searched without taking the AVSL lock.</p>
     * @param[in] X Slip cell being checked
     * @return <b>true</b> cell is from the AVSL <b>false</b> otherwise
     */
    bool SlipCellBase::isAVSL(const SlipCellBase* X)  {                          // Cell is in AVSL
-      bool flag = false;
-      SlipCellBase* adr = const_cast<SlipCellBase*>(X);
-      if ((adr >= avsl.lowWater) && (adr <= avsl.highWater)) {  // quick check
-         SlipCellBase* link = avsl.AVSLList->getRightLink();
-         while((adr > link->datum.fragment.highWater) && !link->isHeader())
-            link = link->getRightLink();
-         flag = (!link->isHeader() && (adr <= link->datum.fragment.highWater));
-      }
-      return flag;
+      return avsl.index.find(X);
    }; // bool SlipCellBase::isAVSL(const SlipCellBase* X)
 
    /**
     * @brief insert a new AVSL fragment into the sorted AVSL fragment list.
-    * <p>Insert a new fragment into the space fragment list and setup the high
-    *    water/low water address marks.</p>
-    * <p>The search loop looks at a list of AVSL memory fragments and places
-    *    the new fragment in sorted order within the list. Loop invariants are:
-    * </p>
+    * <p>Insert a new fragment into the space fragment list and the fragment
+    *    index and setup the high water/low water address marks.</p>
+    * <p>The position of the new fragment is found by a binary search of the
+    *    fragment index. The fragment list and the index are in the same
+    *    order and satisfy:</p>
     * <ol>
-    *    <li>There is at least one space fragment on the list</li>
     *    <li>Each fragment is strictly ordered with the low water mark
     *        &lt; the high water mark.</li>
     *    <li>Each fragment is strictly ordered with respect to the following,
@@ -617,48 +1573,193 @@ namespace slip {
     *        <p><tt>high water[i-1] &lt; low water[i] &lt; high water[i] &lt; low water[i+1]</tt><p>
     *    </li>
     * </ol>
-    * <p>If two fragments are conjoined (one fragment immediately following or
-    *    preceding the other) then the old fragment list element is expanded.</p>
+    * <p>Each heap allocation has its own fragment, conjoined allocations are
+    *    not merged.</p>
     * <p>The AVSL state is altered:</p>
     * <ul>
     *    <li><b>avsl.highWater</b> contains the highest byte address in the fragment list</li>
     *    <li><b>avsl.lowWater</b> contains the lowest byte address in the fragment list</li>
     * </ul>
+    * <p>The fragment list cell is the first cell of the fragment, so that
+    *    no cell is allocated. The caller must hold <em>avslLock</em> and
+    *    must record the fragment before any of its cells are on the AVSL,
+    *    otherwise another thread can take a cell for which <em>isAVSL</em>
+    *    is <b>false</b>. Before <em>slipInit</em> has made the fragment
+    *    list header the fragment is only entered in the index.</p>
     *
     * @param[in,out] lowWater the lowest (smallest) address of the allocation
     * @param[in,out] highWater the highest (largest) address of the allocation
+    * @param[in] source where the allocation came from
     */
    void SlipCellBase::newFragment( SlipCellBase* lowWater                       // Create a new AVSL fragment history
-                                 , SlipCellBase* highWater) {
-      SlipDatum* datum = new SlipDatum((ULONG)0);
-      datum->datum.fragment.lowWater = lowWater;
-      datum->datum.fragment.highWater = highWater;
-      if (highWater < avsl.lowWater) {                                          // the current allocation precedes the lowest addressed fragment
-         if ((highWater + 1) != avsl.lowWater) {                                // attempt to expand an existing fragment
-            insertFragmentRight(avsl.AVSLList, datum);
-         } else
-            delete datum;
-         avsl.lowWater = lowWater;
-      } else if (lowWater > avsl.highWater) {                                   // the current allocation follows the lowest addressed fragment
-         if ((lowWater - 1) != avsl.highWater) {                                // attempt to expand and existing fragement
-            insertFragmentLeft(avsl.AVSLList, datum);
-         } else
-            delete datum;
-         avsl.highWater = highWater;
-      } else {                                                                  // the current allocation is between the highes and lowest address
-         SlipCellBase* link = avsl.AVSLList->rightLink;
-         while((!link->isHeader()) && lowWater < link->datum.fragment.lowWater);         // do a sequential search
-         if ((lowWater - 1)== link->datum.fragment.highWater) {
-            link->datum.fragment.highWater = highWater;
-            delete datum;
-         } else if ((highWater + 1) == (link->getRightLink())->datum.fragment.lowWater) {
-            (link->getRightLink())->datum.fragment.lowWater = lowWater;
-            delete datum;
-         } else {
-            insertFragmentRight(link, datum);
+                                 , SlipCellBase* highWater
+                                 , avslSource    source) {
+      SlipCellBase* record = lowWater;
+      record->setOperator((void*)ulongOP);
+      memset(&record->datum, 0, sizeof(Data));
+      record->datum.fragment.lowWater  = lowWater;
+      record->datum.fragment.highWater = highWater;
+      record->leftLink = record->rightLink = NULL;
+      ULONG i = avsl.index.position(lowWater);
+      ULONG n = avsl.index.size.load(memory_order_relaxed);
+      if (avsl.AVSLList == NULL)
+         ;                                                                      // slipInit links the first fragment
+      else if (i < n)
+         insertFragmentLeft(avsl.index.record(i), record);                      // precedes the next higher fragment
+      else
+         insertFragmentLeft(avsl.AVSLList, record);                             // follows the highest fragment
+      avsl.index.insert(i, lowWater, highWater, record, source);
+      if (i == 0) avsl.lowWater  = lowWater;
+      if (i == n) avsl.highWater = highWater;
+   }; // void SlipCellBase::newFragment(ULONG lowWater, ULONG highWater)
+
+   /**
+    * @brief Return fully free AVSL fragments to the system.
+    * <p>Fragments are only returned to the system by <em>deleteSlip</em>.
+    *    After a peak load the AVSL can hold many free cells which are not
+    *    needed. <em>trim</em> finds each fragment whose cells are all on the
+    *    AVSL, removes the cells from the AVSL, removes the fragment from the
+    *    fragment list and index, and deletes (heap) or unmaps (mapped) the
+    *    fragment memory.</p>
+    * <p>The cache of the calling thread is returned to the AVSL first. Cells
+    *    in the caches of other threads, and deferred cells (see
+    *    <em>setReclaimBudget</em>), are not on the AVSL and keep their
+    *    fragments. The deferred deletion of a free sublist, string or pointer
+    *    cell, normally done when the cell is reused, is done first: the
+    *    referenced list is deleted (<em>deleteList()</em>) or the datum is
+    *    removed, and the cell becomes an undefined free cell. A list made
+    *    free this way can allow a later <em>trim</em> to release its
+    *    fragments.</p>
+    * <p>The fragment list cell of a fragment is normally the first cell
+    *    taken from the fragment. It is counted as free, and is discarded
+    *    with the fragment. A fragment list cell held in another fragment is
+    *    deleted, which can allow a later <em>trim</em> to release that
+    *    fragment.</p>
+    * <p>Each free cell on the AVSL is located in the fragment index, the
+    *    time is proportional to the number of free cells.</p>
+    * @return number of bytes returned to the system
+    */
+   size_t SlipCellBase::trim() {                                                // Return free fragments to the system
+      AVSLCache& local = cache;
+      local.spill();
+      SlipCellBase* held = NULL;                                                // free cells with a datum to delete
+      {
+         lock_guard<mutex> guard(avslLock);
+         SlipCellBase* top = NULL;
+         SlipCellBase* bot = NULL;
+         ULONG cells = 0;
+         for (SlipCellBase* link = avsl.top; link != NULL; ) {
+            SlipCellBase* next = link->rightLink;
+            SlipOp* op = *(SlipOp**)link->getOperator();
+            if (op->isSublist() || op->isString() || op->isPtr()) {
+               link->rightLink = held;
+               held = link;
+               cells++;
+            } else {
+               if (top == NULL) top = link;
+               else             bot->rightLink = link;
+               bot = link;
+            }
+            link = next;
          }
+         if (bot != NULL) bot->rightLink = NULL;
+         avsl.top    = top;
+         avsl.bot    = bot;
+         avsl.avail -= cells;
       }
-   }; // void SlipCellBase::newFragment(ULONG lowWater, ULONG highWater)
+      while (held != NULL) {                                                    // delete outside of the AVSL lock
+         SlipCellBase* link = held;
+         held = held->rightLink;
+         if (link->isSublist()) {
+            SlipHeader* header = *(SlipHeader**)getSublistHeader(*link);
+            if ((header == NULL) || !header->isHeader())
+               postError(__FILE__, __LINE__, SlipErr::E2010, "trim", "", "Header in sublist is not a header.", *link);
+            else
+               header->deleteList();
+         }
+         remove(*link);                                                         // Delete SlipPointer datum
+         link->setOperator((void*)undefinedOP);
+         link->resetData();
+         link->rightLink = NULL;
+         if (local.top == NULL) local.top = link;
+         else                   local.bot->rightLink = link;
+         local.bot = link;
+         local.count(1);
+      }
+      local.spill();
+      struct Released {
+         SlipCellBase* record;                               //!< fragment list cell
+         SlipCellBase* lowWater;                             //!< first cell in the fragment
+         ULONG         cells;                                //!< number of cells in the fragment
+         avslSource    source;                               //!< fragment memory source
+      };
+      vector<Released> released;
+      {
+         lock_guard<mutex> guard(avslLock);
+         ULONG n = avsl.index.size.load(memory_order_relaxed);
+         if ((n == 0) || (avsl.top == NULL)) return 0;
+         vector<ULONG> count(n, 0);
+         ULONG i;
+         for (SlipCellBase* link = avsl.top; link != NULL; link = link->rightLink)
+            if (avsl.index.locate(link, i)) count[i]++;
+         vector<bool> drop(n, false);
+         ULONG cells = 0;
+         for (i = 0; i < n; i++) {
+            const FragmentIndex::Entry& e = avsl.index.entry(i);
+            SlipCellBase* lowWater  = e.lowWater.load(memory_order_relaxed);
+            SlipCellBase* highWater = e.highWater.load(memory_order_relaxed);
+            ULONG size = (highWater - lowWater) + 1;
+            bool  self = (e.record >= lowWater) && (e.record <= highWater);
+            if (count[i] + self != size) continue;
+            drop[i] = true;
+            cells  += size - self;
+         }
+         if (cells == 0) return 0;
+
+             /* Remove the cells from the AVSL */
+         SlipCellBase* top = NULL;
+         SlipCellBase* bot = NULL;
+         for (SlipCellBase* link = avsl.top; link != NULL; link = link->rightLink) {
+            if (avsl.index.locate(link, i) && drop[i]) continue;
+            if (top == NULL) top = link;
+            else             bot->rightLink = link;
+            bot = link;
+         }
+         if (bot != NULL) bot->rightLink = NULL;
+         avsl.top    = top;
+         avsl.bot    = bot;
+         avsl.avail -= cells;
+         avsl.total -= cells;
+         avsl.counter++;
+
+             /* Remove the fragments from the fragment list and index */
+         for (i = n; i-- > 0; ) {
+            if (!drop[i]) continue;
+            const FragmentIndex::Entry& e = avsl.index.entry(i);
+            SlipCellBase* record = e.record;
+            setRightLink(record->getLeftLink(), record->getRightLink());
+            setLeftLink(record->getRightLink(), record->getLeftLink());
+            record->setLeftLink(NULL);
+            record->setRightLink(NULL);
+            SlipCellBase* lowWater  = e.lowWater.load(memory_order_relaxed);
+            SlipCellBase* highWater = e.highWater.load(memory_order_relaxed);
+            bool self = (record >= lowWater) && (record <= highWater);
+            avsl.total -= self;
+            Released r = { (self? NULL: record), lowWater, (ULONG)(highWater - lowWater) + 1, e.source };
+            released.push_back(r);
+            avsl.index.remove(i);
+         }
+         n = avsl.index.size.load(memory_order_relaxed);
+         avsl.lowWater  = (n == 0)? (SlipCellBase*)0xFFFFFFFF: avsl.index.entry(0).lowWater.load(memory_order_relaxed);
+         avsl.highWater = (n == 0)? (SlipCellBase*)0x00000000: avsl.index.entry(n - 1).highWater.load(memory_order_relaxed);
+      }
+      size_t bytes = 0;
+      for (unsigned int i = 0; i < released.size(); i++) {
+         bytes += releaseFragmentSpace(released[i].source, released[i].lowWater, released[i].cells);
+         if (released[i].record != NULL) delete released[i].record;
+      }
+      return bytes;
+   }; // size_t SlipCellBase::trim()
 
    /**
     *
@@ -667,8 +1768,10 @@ namespace slip {
     *    to <em>UNDEFDATA</em>, the static type characteristics pointer,
     *    <em>operator</em>, to point to <em>SlipUndefinedOp</em>, and clear
     *    the datum value.</p>
-    * <p>If the AVSL is empty, retrieve a allocation from the heap and insert
-    *    a fragment entry into the fragment list, and then retrieve and
+    * <p>The cell is taken from the cache of the calling thread. If the cache
+    *    is empty a batch of cells is moved from the AVSL to the cache. If the
+    *    AVSL is empty, retrieve a allocation from the heap and insert a
+    *    fragment entry into the fragment list, and then retrieve and
     *    initialize a Slip cell.</p>
     * <p>Ignore any Slip cell whose address is the same as <em>UNDEFDATA</em>.
     *    This creates a hole in the AVSL which is one cell deep.</p>
@@ -681,13 +1784,17 @@ namespace slip {
     *    deleted list is deferred until the time that the referencing sublist
     *    is removed from the AVSL. This deferral should cause no operational
     *    issues during normal use.</p>
-    * <p>Update the AVSL state as required:</p>
+    * <p>If a reclaim budget is set, at most <em>budget</em> deferred cells
+    *    are reclaimed before the cell is retrieved (see
+    *    <em>setReclaimBudget</em>).</p>
+    * <p>Update the cache state as required:</p>
     * <ul>
-    *    <li><b>avsl.avail</b> is decremented.</li>
-    *    <li><b>avsl.top</b> is adjusted to point to the next available cell.</li>
+    *    <li><b>cache.avail</b> is decremented.</li>
+    *    <li><b>cache.top</b> is adjusted to point to the next available cell.</li>
     * </ul>
     * <p>In summary:</p>
     * <ol>
+    *    <li>If the cache is empty, a batch of cells is moved from the AVSL.</li>
     *    <li>If the AVSL is empty, a new list of cells retrieved from the heap.</li>
     *    <li>If the top AVSL cell is a Slip header, datum or reader cell, it is used.</li>
     *    <li>If the top AVSL cell is a sublist cell the referenced header is
@@ -704,26 +1811,26 @@ namespace slip {
     * @return a SLIP Cell
     */
    void * SlipCellBase::operator new(size_t size) {    // Create a new SLIP cell
+      ULONG budget = reclaimBudget.load(memory_order_relaxed);
+      if (budget != 0)
+         reclaim(budget);
+      AVSLCache& local = cache;
       SlipCellBase* link = NULL;
       do  {
-        if (avsl.top == NULL) {
-           SlipCellBase* lowWater;
-           SlipCellBase* highWater;
-           SlipCellBase::getAVSLSpace(lowWater, highWater);
-           newFragment(lowWater, highWater);
-        }
-        link = (SlipCellBase*)avsl.top;
-        avsl.top = avsl.top->rightLink;
-        avsl.avail--;
+        if (local.top == NULL)
+           local.fill();
+        link = local.top;
+        local.top = local.top->rightLink;
+        local.count(-1);
       } while(link == TEMPORARY );
 
-      avsl.bot = (avsl.top == NULL)? NULL: avsl.bot;                            // set both top & bot if AVSL empty
+      local.bot = (local.top == NULL)? NULL: local.bot;                         // set both top & bot if cache empty
 
       SlipOp* op = *(SlipOp**)link->getOperator();
 
-      avsl.counter++;
+      ULONG counter = local.tick();
       if (avslHistoryFlag)
-         cout << right << setw(8) << avsl.counter << setw(9) << avsl.avail
+         cout << right << setw(8) << counter << setw(9) << local.avail
               << " new    " << op->dump((SlipDatum&)*link) << endl;
       if (op->isSublist()) {
          SlipHeader* header = *(SlipHeader**)getSublistHeader(*link);
@@ -765,6 +1872,9 @@ namespace slip {
     *    Each cell is analyzed before output and diagnostics messages are
     *    issued as required. Identifying which fragment contains the cell
     *    is not done.</p>
+    * <p>The cache of the calling thread is returned to the AVSL before output.
+    *    Cells in the caches of other threads are not output. No other thread
+    *    may use SLIP cells during output.</p>
     * <p><b>WARNINGS</b></p>
     * <ul>
     *    <li>"****** Left link is not 0xdeadbeef"</li>
@@ -778,6 +1888,7 @@ namespace slip {
     * @param[in] str user caption printed as a heading
     */
    void SlipCellBase::printAVSL(string str) {                                   // pretty-print the AVSL state and list
+      cache.spill();
       SlipCellBase* link = avsl.top;
       ULONG count = 0;
       if (str != "") cout << str << endl;
@@ -926,6 +2037,7 @@ namespace slip {
     */
    void SlipCellBase::printState(string str) {                                  // Output the AVSL state
       if (str != "") cout << str << endl;
+      lock_guard<mutex> guard(avslLock);
       cout << avsl.toString();
    }; // void SlipCellBase::printState()
 
@@ -1056,6 +2168,8 @@ namespace slip {
    *     and initializes all internal variables. When the method is complete,
    *     there will be no memory allocated for SLIP cells and the SLIP API
    *     will not be operational.</p>
+   *  <p>No other thread may use SLIP cells during or after the call. The
+   *     caches of all threads are emptied.</p>
    */
    void SlipCellBase::deleteSlip() {                                            // Reinitialize SLIP to its pristine state
       avslHistoryFlag = false;                                                  // history flag <em>true</em> when AVSL output wanted
@@ -1070,6 +2184,8 @@ namespace slip {
          delete adr;
       }
       delete link;
+      knownCounts.store(0, memory_order_relaxed);
+      lock_guard<mutex> guard(avslLock);
       avsl.resetAVSLState();
    }; // void SlipCellBase::deleteSlip()
 
@@ -1090,6 +2206,8 @@ namespace slip {
     *    the AVSL.</p>
     * <p>Initializes the header for the fragment table and inserts the first
     *    fragment to represent the initial allocation.</p>
+    * <p>Initialization must be complete before SLIP cells are used by more
+    *    than one thread.</p>
     *
     * @param[in] alloc number of cells in the initial allocation
     * @param[in] delta number of cells in successive allocations
@@ -1097,16 +2215,21 @@ namespace slip {
    void   SlipCellBase::slipInit(ULONG alloc, ULONG delta) {                // Initialize SLIP system and allocation resources
       if (firstTimeOnlyTime) return;
       firstTimeOnlyTime = true;
-      avsl.setAlloc(alloc, delta);
-      getAVSLSpace(avsl.lowWater, avsl.highWater);
+      SlipCellBase* lowWater;
+      SlipCellBase* highWater;
+      avslSource    source;
+      {
+         lock_guard<mutex> guard(avslLock);
+         avsl.setAlloc(alloc, delta);
+         getAVSLSpace(lowWater, highWater, source);
+      }
       /*
        * Initialize space fragment list and insert first fragment
        */
-      avsl.AVSLList = new SlipHeader();
-      SlipDatum* link = new SlipDatum((ULONG)0);
-      link->datum.fragment.lowWater  = avsl.lowWater;
-      link->datum.fragment.highWater = avsl.highWater;
-      insertFragmentRight(avsl.AVSLList, link);
+      SlipHeader* list = new SlipHeader();
+      lock_guard<mutex> guard(avslLock);
+      avsl.AVSLList = list;
+      insertFragmentLeft(list, avsl.index.record(0));
    }; // void   SlipCellBase::slipInit(ULONG alloc, ULONG delta)
 
    /**
@@ -1148,6 +2271,7 @@ namespace slip {
           << "  maximum class  " << cellSize << " rounded up to a long boundary"
           << endl << endl;
 
+      lock_guard<mutex> guard(avslLock);
       out << avsl.toString() << endl;
 
    }; // void SlipCellBase::sysInfo(ostream& out)
@@ -1485,7 +2609,6 @@ namespace slip {
     *
     * @return class type of the object
     */
-   const ClassType SlipCellBase::getClassType()const { return ((SlipOp*)operation)->getClassType();} // return the internal class type
 
    /**
     * @fn SlipCellBase::getLeftLink() const
@@ -1526,20 +2649,22 @@ namespace slip {
     *    following field values are returned:</p>
     * | Field names | Description
     * | :---------- | :---------------------------------- |
-    * | avail       | Total AVSL free cells               |
+    * | avail       | Total AVSL and thread cache free cells |
     * | total       | Total AVSL cells (free \& used)     |
     * | alloc       | Initial heap allocation (cells)     |
     * | delta       | Incremental heap allocation (cells) |
     * @return Return the current Slip state structure     |
     */
-   SlipState       SlipCellBase::getSlipState()      { return SlipState(avsl.total, avsl.avail, avsl.alloc, avsl.delta);};
+   SlipState       SlipCellBase::getSlipState()      {
+      lock_guard<mutex> guard(avslLock);
+      return SlipState(avsl.total, avsl.avail + avsl.cached(), avsl.alloc, avsl.delta);
+   }; // SlipState SlipCellBase::getSlipState()
 
    /**
     * @fn SlipCellBase::isData()      const
     * @brief Return <b>true</b> if the Slip cell is a SlipDatum cell.
     * @return <b>true</b> if the Slip cell is a SlipDatum cell
     */
-   const bool      SlipCellBase::isData() const { return ((SlipOp*)operation)->isData();}       // true if cell is data
 
    /**
     * @fn SlipCellBase::isDeleted()   const
@@ -1580,14 +2705,12 @@ namespace slip {
     *       <b>0</b> as appropriate.
     * @return <b>true</b> if the SlipDatum represents a discrete data type
     */
-   const bool      SlipCellBase::isDiscrete() const { return ((SlipOp*)operation)->isDiscrete();}   // true if cell is a discrete number
 
    /**
     * @fn  SlipCellBase::isHeader()    const
     * @brief Return <b>true</b> for a SlipHeader object.
     * @return Return <b>true</b> for a SlipHeader object
     */
-   const bool      SlipCellBase::isHeader()    const { return ((SlipOp*)operation)->isHeader();}    // true if cell is a header
 
    /**
     * @fn SlipCellBase::isName()      const
@@ -1620,7 +2743,6 @@ namespace slip {
     * </ul>
     * @return <b>true</b> if this is a SlipDatum numeric type
     */
-   const bool      SlipCellBase::isNumber()    const { return ((SlipOp*)operation)->isNumber();}    // true if cell is numeric data
 
    /**
     * @fn SlipCellBase::isPtr()       const
@@ -1628,28 +2750,24 @@ namespace slip {
     * <p>This method will return <b>false</b> for a SlipDatum (STRING) object.</p>
     * @return <b>true</b> for a SlipDatum (PTR) data cell
     */
-   const bool      SlipCellBase::isPtr()       const { return ((SlipOp*)operation)->isPtr();}       // true if cell is a pointer
    
    /**
     * @fn SlipCellBase::isReal()      const
     * @brief Return <b>true</b> for a SlipDatum (DOUBLE) object.
     * @return <b>true</b> for a SlipDatum (DOUBLE) object
     */
-   const bool      SlipCellBase::isReal()      const { return ((SlipOp*)operation)->isReal();}      // true if cell is a real
 
    /**
     * @fn SlipCellBase::isString()    const
     * @brief Return <b>true</b> for a SlipDatum (STRING) data object.
     * @return Return <b>true</b> for a SlipDatum (STRING) data object
     */
-   const bool      SlipCellBase::isString()    const { return ((SlipOp*)operation)->isString();}    // true if cell is a string
 
    /**
     * @fn SlipCellBase::isSublist()
     * @brief Return <b>true</b> for a SlipSublist object.
     * @return <b>true</b> for a SlipSublist object
     */
-   const bool      SlipCellBase::isSublist()   const { return ((SlipOp*)operation)->isSublist();}   // true if cell is sublist
 
    /**
     * @fn SlipCellBase::isTemp()      const
@@ -1675,6 +2793,17 @@ namespace slip {
     * @return Return <b>true</b> if the Slip object is not in a list
     */
 
+   /**
+    * @brief Pretty-print the object.
+    * <p>A SlipReaderCell is printed by the reader. All other objects are
+    *    printed by the cell operator.</p>
+    * @return pretty-printed string for the object
+    */
+   string   SlipCellBase::toString() const {
+      if (getClassType() == eREADER) return ((SlipReaderCell*)this)->toString();
+      return ((SlipOp*)*getOperator())->toString((SlipCell&)*this);
+   }; // string   SlipCellBase::toString() const
+
    /**
     * @brief Uglify and print the object.
     * <p>The linkLeft, linkRight, and operator fields are output in hex. The
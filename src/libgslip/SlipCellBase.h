@@ -31,6 +31,7 @@
 #ifndef _SLIPCELLBASE_H
 #define	_SLIPCELLBASE_H
 
+# include <atomic>
 # include <stdio.h>
 # include <string>
 # include <sstream>
@@ -40,6 +41,69 @@ using namespace std;
 
 namespace slip {
 
+/**
+ * @struct slip::SlipOpTag
+ * @brief Cell type tag held in every SlipOp.
+ * <p>SlipOp inherits the tag as a base. The type predicates of a cell load
+ *    the tag through the cell operator without calling into SlipOp. The
+ *    conversion from the operator to the tag is a static_cast, defined in
+ *    SlipOp.h once SlipOp is complete.</p>
+ */
+   struct SlipOpTag {
+      enum { DATA = 0x01, DISCRETE = 0x02, NUMBER = 0x04 };                     //!< Property bits
+      const UCHAR  type;                                                        //!< ClassType of the cell
+      const UCHAR  props;                                                       //!< DATA | DISCRETE | NUMBER
+      SlipOpTag(ClassType type, UCHAR props) : type((UCHAR)type), props(props) { }
+   }; // struct SlipOpTag
+
+#ifdef SLIP_COMPRESSED_LINKS
+# if __SIZEOF_POINTER__ != 8
+#   error SLIP_COMPRESSED_LINKS requires 64-bit pointers
+# endif
+# ifndef SLIP_LINK_REGION
+#   define SLIP_LINK_REGION ((size_t)31 << 30)
+# endif
+/**
+ * @class slip::SlipLink
+ * @brief 32-bit compressed SLIP cell link.
+ * <p>Built with <b>SLIP_COMPRESSED_LINKS</b> defined (configure
+ *    <tt>--enable-compressed-links</tt>), all AVSL fragments are carved from
+ *    a single reserved virtual region and a link is stored as the 8-byte
+ *    word offset of the cell from the start of the region. A link is
+ *    decoded to a pointer with one shift and one add. <em>NULL</em>,
+ *    <em>TEMPORARY</em> and <em>UNDEFDATA</em> have reserved encodings.</p>
+ * <p>The region holds <b>SLIP_LINK_REGION</b> bytes (default 31 GiB),
+ *    enough for more than 800 million cells. A link may only reference a
+ *    cell in the region, stack temporaries can not be linked.</p>
+ */
+   class SlipLink {
+   public:
+      static const ULONG NULLINDEX  = 0;                                        //!< encoded NULL
+      static const ULONG UNDEFINDEX = 0xFFFFFFFE;                               //!< encoded UNDEFDATA
+      static const ULONG TEMPINDEX  = 0xFFFFFFFF;                               //!< encoded TEMPORARY
+      static char*       base;                                                  //!< start of the reserved AVSL region
+
+      static ULONG encode(const SlipCellBase* X) {
+         if (X == NULL)      return NULLINDEX;
+         if (X == TEMPORARY) return TEMPINDEX;
+         if (X == UNDEFDATA) return UNDEFINDEX;
+         return (ULONG)(((const char*)X - base) >> 3);
+      }
+      static SlipCellBase* decode(ULONG X) {
+         if (X >= UNDEFINDEX) return (SlipCellBase*)((X == TEMPINDEX)? TEMPORARY: UNDEFDATA);
+         return (X == NULLINDEX)? NULL: (SlipCellBase*)(base + ((size_t)X << 3));
+      }
+
+      SlipLink& operator=(const SlipCellBase* X) { index = encode(X); return *this; }
+      operator SlipCellBase*() const             { return decode(index); }
+      SlipCellBase* operator->() const           { return decode(index); }
+   private:
+      ULONG index;                                                              //!< encoded link
+   }; // class SlipLink
+#else
+   typedef SlipCellBase* SlipLink;                                              //!< uncompressed SLIP cell link
+#endif
+
 /**
  * @class slip::SlipCellBase
  * @brief Base class for all Slip Cells.
@@ -111,6 +175,8 @@ namespace slip {
  *    <li><b>operator</b> pointer to invariant properties of the Slip cell type.</li>
  *    <li><b>Datum</b> defined by the derived object.</li>
  * </ul>
+ * <p>With <b>SLIP_COMPRESSED_LINKS</b> the links are 32-bit region offsets,
+ *    see <em>SlipLink</em>.</p>
  * <p>The requirement that all SLIP cell types be the same size allows garbage
  *    collection to be used without memory holes. Memory reorganization is not
  *    necessary because uneven sized memory allocations do not exist. If total
@@ -183,7 +249,7 @@ namespace slip {
  * </p>
  */
 /**
- * @fn virtual string SlipCellBase::toString() const = 0
+ * @fn string SlipCellBase::toString() const
  * @brief Return a pretty-printed string for the object.
  * <p>Each Slip object derived from SlipCellBase is required to return a
  *    pretty string of the object. The string must be suitable for output
@@ -210,35 +276,36 @@ namespace slip {
  * @return pretty string
  */
    class SlipCellBase {
+      friend struct AVSLCache;
+      friend class SlipCursor;
+      friend class SlipExprNum;
       friend class SlipHashEntry;
+      friend class SlipMappedRead;
       friend class SlipOp;
       friend class SlipSequencer;
+      friend class SlipStructuralIterator;
       friend class SlipWrite;
+      friend class SlipWriteBinary;
    private:
        void*         operation;                                                 //!< Pointer to invariant operations class
-       SlipCellBase* leftLink;                                                  //!< Pointer to preceding cell
-       SlipCellBase* rightLink;                                                 //!< Pointer to following cell
+       SlipLink      leftLink;                                                  //!< Pointer to preceding cell
+       SlipLink      rightLink;                                                 //!< Pointer to following cell
        Data          datum;                                                     //!< SLIP cell data field
 
    /*********************************************************
     *                SLIP Private Functions                 *
    **********************************************************/
-      static void getAVSLSpace(SlipCellBase*& lowWater, SlipCellBase*& highWater);
+      static void getAVSLSpace(SlipCellBase*& lowWater, SlipCellBase*& highWater, avslSource& source);
       static void insertFragmentLeft(SlipCellBase* cell, SlipCellBase* X);      // Insert X to current cell left
       static void insertFragmentRight(SlipCellBase* cell, SlipCellBase* X);     // Insert X to current cell right
-      static void newFragment(SlipCellBase* lowWater, SlipCellBase* highWater);
+      static void newFragment(SlipCellBase* lowWater, SlipCellBase* highWater, avslSource source);
 
    protected:
 
           /*************************************************
            *           Constructors & Destructors          *
            ************************************************/
-       SlipCellBase() {
-         if ((leftLink == rightLink) && (rightLink == UNDEFDATA)) {
-            leftLink = rightLink = NULL;
-         } else
-            leftLink = rightLink = (SlipCellBase*)TEMPORARY;
-       }
+       SlipCellBase();                                                          // Mark a cell persistent or temporary
 
    /*********************************************************
     *               SLIP Protected Functions                *
@@ -274,11 +341,25 @@ namespace slip {
        void**               getHeadDescList() const { return &const_cast<SlipCellBase*>(this)->datum.Head.descriptionList; }
        USHORT*              getHeadRefCnt()   const { return &const_cast<SlipCellBase*>(this)->datum.Head.refCnt;          }
        USHORT*              getHeadMrk()      const { return &const_cast<SlipCellBase*>(this)->datum.Head.mrk;             }
+       ULONG*               getHeadCount()    const { return &const_cast<SlipCellBase*>(this)->datum.Head.count;           }
 
        static void**        getHeadDescList(const SlipCellBase& X) { return X.getHeadDescList(); }
        static USHORT*       getHeadRefCnt(const SlipCellBase& X)   { return X.getHeadRefCnt();   }
        static USHORT*       getHeadMrk(const SlipCellBase& X)      { return X.getHeadMrk();      }
 
+             /**********************************************
+              *          Header Cell Count Functions         *
+              **********************************************/
+       static const ULONG   COUNTUNKNOWN = 0xFFFFFFFF;                          //!< List cell count is not known
+       static const ULONG   COUNTINDEXED = 0xFFFFFFFE;                          //!< List cell count is kept by a Descriptor List index
+       void                 countAdd(LONG n);                                   // Add n to a known header count
+       void                 countClear();                                       // Header count becomes unknown
+       void                 countEmpty();                                       // A known header count becomes zero
+       ULONG                countGet() const;                                   // Header count or COUNTUNKNOWN
+       void                 countPut(ULONG n);                                  // Set a known header count
+       void                 countRelease();                                     // Forget a deleted header count
+       static void          countLinked(SlipCellBase* left, SlipCellBase* right, LONG n, bool known = true); // n cells (un)linked between left and right
+
              /**********************************************
               *     Sublist Cell Data Access Functions      *
               **********************************************/
@@ -343,6 +424,28 @@ namespace slip {
        static string        slipDump(string name, SlipCellBase& X);
        string               slipDump(string name)              { return slipDump(name, *this); }
 
+       /**********************************************************
+        *                 Lists loaded when used                 *
+        **********************************************************/
+
+       typedef void (*ListLoader)(SlipCellBase& header);                        //!< loads a list waiting to be loaded
+       static atomic<ULONG> unloadedLists;                                      //!< number of lists waiting to be loaded
+       static ListLoader    listLoader;                                         //!< loads a list waiting to be loaded
+       static void          loadList(SlipCellBase* header) {                    // Load a list before it is entered
+          if (unloadedLists.load(memory_order_relaxed)) listLoader(*header);
+       }; // static void loadList(SlipCellBase* header)
+
+       /**********************************************************
+        *             Descriptor List index changes              *
+        **********************************************************/
+
+       typedef void (*DListChange)(const SlipCellBase* cell);                   //!< discards the index holding a changed cell
+       static atomic<bool>  dListIndexed;                                       //!< true if a Descriptor List index was built
+       static DListChange   dListChange;                                        //!< discards the index holding a changed cell
+       static void          dListChanged(const SlipCellBase* cell) {            // A cell is assigned or replaced
+          if (dListIndexed.load(memory_order_acquire)) dListChange(cell);
+       }; // static void dListChanged(const SlipCellBase* cell)
+
                /*****************************************
                 *             Miscellaneous             *
                ******************************************/
@@ -355,13 +458,18 @@ namespace slip {
        **********************************************************/
        void * operator new(size_t size);                                        // Get a new SLIP cell from the AVSL
        void   operator delete(void* ptr) { }                                    // Class destructor puts cells on AVSL
-       virtual ~SlipCellBase()  { }                                             // destructor
+       ~SlipCellBase();                                                         // destructor
        SlipCellBase*   getLeftLink()  const   { return leftLink; }              // Return pointer to previous cell
        SlipCellBase*   getRightLink() const   { return rightLink; }             // Return pointer to next cell
        static void     deleteSlip();                                            // Reinitialize SLIP to its pristine state
        static void     sysInfo(ostream& out);                                   // Output the SLIP system info
        static void     slipInit();                                              // Initialize SLIP system
        static void     slipInit(ULONG alloc, ULONG lta);                        // Initialize SLIP system and allocation resources
+       static void     setAVSLGrowth(ULONG growth, ULONG limit);                // Set incremental allocation growth
+       static void     setAVSLSource(avslSource source);                        // Set fragment memory source
+       static void     setReclaimBudget(ULONG budget);                          // Set deferred cells reclaimed per allocation
+       static ULONG    reclaim(ULONG budget);                                   // Recover deferred cells
+       static size_t   trim();                                                  // Return free fragments to the system
 
        /*********************************************************
         *                SLIP Public Functions                  *
@@ -374,17 +482,18 @@ namespace slip {
                /*****************************************
                 *            Basic Primitive            *
                ******************************************/
-       const ClassType getClassType() const;                                    // return the internal class type
+       inline const SlipOpTag* getTag() const;                                  // Type tag of the cell operator
+       const ClassType getClassType() const { return (ClassType)getTag()->type; }          // return the internal class type
        const string    getName()      const;                                    // string representing SlipDatumCell
-       const bool      isData()       const;                                    // true if cell is data
-       const bool      isDiscrete()   const;                                    // true if cell is a discrete number
-       const bool      isHeader()     const;                                    // true if cell is a header
+       const bool      isData()       const { return getTag()->props & SlipOpTag::DATA; }     // true if cell is data
+       const bool      isDiscrete()   const { return getTag()->props & SlipOpTag::DISCRETE; } // true if cell is a discrete number
+       const bool      isHeader()     const { return getTag()->type == eHEADER; }  // true if cell is a header
        const bool      isName()       const { return isSublist(); }             // true for SlipSublist
-       const bool      isNumber()     const;                                    // true if cell is numeric data
-       const bool      isPtr()        const;                                    // true if pointer
-       const bool      isReal()       const;                                    // true if cell is a real data type
-       const bool      isString()     const;                                    // true if string
-       const bool      isSublist()    const;                                    // true if cell is sublist
+       const bool      isNumber()     const { return getTag()->props & SlipOpTag::NUMBER; }   // true if cell is numeric data
+       const bool      isPtr()        const { return getTag()->type == ePTR; }     // true if pointer
+       const bool      isReal()       const { return getTag()->type == eDOUBLE; }  // true if cell is a real data type
+       const bool      isString()     const { return getTag()->type == eSTRING; }  // true if string
+       const bool      isSublist()    const { return getTag()->type == eSUBLIST; } // true if cell is sublist
 
                /*****************************************
                 *             Miscellaneous             *
@@ -398,11 +507,13 @@ namespace slip {
        static  void    printFragmentList(string str = "");                      // format and output the fragment list
        static  void    printMemory(string str = "");                            // Output entire memory contents
        static  void    printState(string str = "");                             // Output the AVSL state
-       virtual string  dump() const;                                            // return everything about the SLIP Cell
-       virtual string  toString() const       = 0;                              // return SlipCell Value
+               string  dump() const;                                            // return everything about the SLIP Cell
+               string  toString() const;                                        // return SlipCell Value
 
    }; // class SlipCellBase
 
 }; // namespace slip
 
+# include "SlipOp.h"                                                            // SlipCellBase::getTag() needs SlipOp
+
 #endif	/* SLILPCELLBASE_H */
@@ -0,0 +1,229 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file    SlipCursor.cc
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+ # include <sstream>
+ # include <string>
+ # include "SlipCursor.h"
+ # include "SlipCellBase.h"
+ # include "SlipHeader.h"
+
+namespace slip {
+
+               /*****************************************
+                *           Private Functions           *
+               ******************************************/
+
+   /**
+    * @brief Enter a sublist.
+    * <p>The current list and the sublist cell are saved in a frame and the
+    *    current cell is the sublist header.</p>
+    * @param[in] sublist (SlipCellBase*) sublist cell in the current list
+    */
+   void SlipCursor::downLevel(SlipCellBase* sublist) {                          // Enter a sublist
+      Frame save = { list, sublist };
+      if (depth < DEPTH) frame[depth] = save; else spill.push_back(save);
+      depth++;
+      list = *(SlipHeader**)SlipCellBase::getSublistHeader(*sublist);
+      link = list;
+      SlipCellBase::loadList(link);
+   }; // void SlipCursor::downLevel(SlipCellBase* sublist)
+
+   /**
+    * @brief Return to the enclosing list.
+    * <p>The current cell is the sublist cell used to enter the list.</p>
+    */
+   void SlipCursor::leave() {                                                   // Return to the enclosing list
+      Frame save;
+      depth--;
+      if (depth < DEPTH) save = frame[depth];
+      else {
+         save = spill.back();
+         spill.pop_back();
+      }
+      list = save.list;
+      link = save.cell;
+   }; // void SlipCursor::leave()
+
+               /*****************************************
+                *            Public Functions           *
+               ******************************************/
+
+   /**
+    * @brief Advance structurally left to the preceeding data cell.
+    * <p>A sublist cell is entered from the list bottom and a list header
+    *    returns to the cell before the sublist cell in the enclosing list.
+    *    The walk stops on a data cell or the topmost list header.</p>
+    * @return (SlipCursor&) reference to the cursor
+    */
+   SlipCursor& SlipCursor::advanceSEL() {                                       // advance structural element left
+      link = link->getLeftLink();
+      while(!link->isData()) {
+         if (link->isSublist()) downLevel(link);
+         else if (depth == 0) break;
+         else leave();
+         link = link->getLeftLink();
+      }
+      return *this;
+   }; // SlipCursor& SlipCursor::advanceSEL()
+
+   /**
+    * @brief Advance structurally right to the succeeding data cell.
+    * <p>A sublist cell is entered from the list top and a list header
+    *    returns to the cell after the sublist cell in the enclosing list.
+    *    The walk stops on a data cell or the topmost list header.</p>
+    * <p>As for <em>SlipReader::advanceSER</em>, from a list header the walk
+    *    starts after the list top: a data cell at the list top is passed
+    *    over and a sublist cell at the list top is entered.</p>
+    * @return (SlipCursor&) reference to the cursor
+    */
+   SlipCursor& SlipCursor::advanceSER() {                                       // advance structural element right
+      if (link->isHeader()) link = link->getRightLink();
+      do {
+         if (link->isSublist()) downLevel(link);
+         else if (link->isHeader()) {
+            if (depth == 0) break;
+            leave();
+         }
+         link = link->getRightLink();
+      } while(!link->isData());
+      return *this;
+   }; // SlipCursor& SlipCursor::advanceSER()
+
+   /**
+    * @brief Advance structurally left to the preceeding sublist cell.
+    * <p>If the current cell is a sublist cell, the sublist is entered. The
+    *    walk stops on a sublist cell or the topmost list header.</p>
+    * @return (SlipCursor&) reference to the cursor
+    */
+   SlipCursor& SlipCursor::advanceSNL() {                                       // advance structural name left
+      if (link->isSublist()) downLevel(link);
+      if (link->isHeader()) link = link->getLeftLink();
+      while(!link->isSublist()) {
+         if (link->isHeader()) {
+            if (depth == 0) break;
+            leave();
+         }
+         link = link->getLeftLink();
+      }
+      return *this;
+   }; // SlipCursor& SlipCursor::advanceSNL()
+
+   /**
+    * @brief Advance structurally right to the succeeding sublist cell.
+    * <p>If the current cell is a sublist cell, the sublist is entered. The
+    *    walk stops on a sublist cell or the topmost list header.</p>
+    * @return (SlipCursor&) reference to the cursor
+    */
+   SlipCursor& SlipCursor::advanceSNR() {                                       // advance structural name right
+      if (link->isSublist()) downLevel(link);
+      if (link->isHeader()) link = link->getRightLink();
+      while(!link->isSublist()) {
+         if (link->isHeader()) {
+            if (depth == 0) break;
+            leave();
+         }
+         link = link->getRightLink();
+      }
+      return *this;
+   }; // SlipCursor& SlipCursor::advanceSNR()
+
+   /**
+    * @brief Advance structurally left to the preceeding cell.
+    * <p>If the current cell is a sublist cell, the sublist is entered. The
+    *    walk stops on a data cell, a sublist cell or the topmost list
+    *    header.</p>
+    * @return (SlipCursor&) reference to the cursor
+    */
+   SlipCursor& SlipCursor::advanceSWL() {                                       // advance structural word left
+      if (link->isSublist()) downLevel(link);
+      link = link->getLeftLink();
+      while(link->isHeader() && (depth > 0)) {
+         leave();
+         link = link->getLeftLink();
+      }
+      return *this;
+   }; // SlipCursor& SlipCursor::advanceSWL()
+
+   /**
+    * @brief Advance structurally right to the succeeding cell.
+    * <p>If the current cell is a sublist cell, the sublist is entered. The
+    *    walk stops on a data cell, a sublist cell or the topmost list
+    *    header.</p>
+    * @return (SlipCursor&) reference to the cursor
+    */
+   SlipCursor& SlipCursor::advanceSWR() {                                       // advance structural word right
+      if (link->isSublist()) downLevel(link);
+      link = link->getRightLink();
+      while(link->isHeader() && (depth > 0)) {
+         leave();
+         link = link->getRightLink();
+      }
+      return *this;
+   }; // SlipCursor& SlipCursor::advanceSWR()
+
+   /**
+    * @brief Return to the topmost list.
+    * <p>The current cell is the topmost list sublist cell used to enter
+    *    the sublists. No change is made at the topmost list.</p>
+    * @return (SlipCursor&) reference to the cursor
+    */
+   SlipCursor& SlipCursor::resetTop() {                                         // Return to the topmost list
+      if (depth > 0) {
+         Frame save = frame[0];
+         depth = 0;
+         spill.clear();
+         list = save.list;
+         link = save.cell;
+      }
+      return *this;
+   }; // SlipCursor& SlipCursor::resetTop()
+
+   /**
+    * @brief Return to the previous level.
+    * <p>The current cell is the sublist cell used to enter the current
+    *    list. No change is made at the topmost list.</p>
+    * @return (SlipCursor&) reference to the cursor
+    */
+   SlipCursor& SlipCursor::upLevel() {                                          // Return to previous level
+      if (depth > 0) leave();
+      return *this;
+   }; // SlipCursor& SlipCursor::upLevel()
+
+   /**
+    * @brief Pretty print the cursor.
+    * @return cursor depth, current cell and current list
+    */
+   string SlipCursor::toString() const {                                        // pretty print the cursor
+      stringstream pretty;
+      pretty << "SlipCursor Depth<" << depth << "> "
+             << currentCell().toString() << "  " << currentList().toString();
+      return pretty.str();
+   }; // string SlipCursor::toString() const
+
+}; // namespace slip
@@ -0,0 +1,120 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file    SlipCursor.h
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+#ifndef _SLIPCURSOR_H
+#define	_SLIPCURSOR_H
+
+# include <string>
+# include <vector>
+# include "SlipDef.h"
+# include "SlipCell.h"
+# include "SlipCellBase.h"
+# include "SlipHeader.h"
+
+using namespace std;
+
+namespace slip {
+
+   /**
+    * @class SlipCursor
+    * @brief Structural traversal of a list without SlipReaderCell chains.
+    * <p>A SlipReader enters a sublist by chaining a new SlipReaderCell taken
+    *    from the AVSL, and returns to the enclosing list by giving the cell
+    *    back. A SlipCursor does the same traversal with a stack of
+    *    (list header, sublist cell) frames held in the cursor. Nesting up
+    *    to <b>DEPTH</b> levels uses the frames in the cursor and does no
+    *    allocation, deeper nesting uses heap storage.</p>
+    * <p>The advance methods have the semantics of the SlipReader advance
+    *    methods with the same name:</p>
+    * <ul>
+    *    <li><b>advanceLWL</b>, <b>advanceLWR</b> the preceeding or succeeding
+    *        cell of the current list.</li>
+    *    <li><b>advanceSEL</b>, <b>advanceSER</b> the preceeding or succeeding
+    *        data cell, entering and leaving sublists.</li>
+    *    <li><b>advanceSNL</b>, <b>advanceSNR</b> the preceeding or succeeding
+    *        sublist cell, entering and leaving sublists.</li>
+    *    <li><b>advanceSWL</b>, <b>advanceSWR</b> the preceeding or succeeding
+    *        data or sublist cell, entering and leaving sublists.</li>
+    * </ul>
+    * <p>A structural walk stops on the topmost list header when there are
+    *    no more cells. The cursor only reads the list, a cell removed from
+    *    the list while it is the current cell or is in a frame invalidates
+    *    the cursor. As for SlipReader, <b>advanceSER</b> from a list header
+    *    passes over a data cell at the list top.</p>
+    * <pre>
+    *    SlipCursor cursor(list);
+    *    while(!cursor.advanceSEL().isHeader())
+    *       total += (DOUBLE)(SlipDatum&)cursor.currentCell();
+    * </pre>
+    */
+   class SlipCursor {
+   public:
+      static const unsigned DEPTH = 32;                                         //!< sublist levels held in the cursor
+   private:
+      struct Frame {
+         SlipHeader*   list;                                                    // enclosing list
+         SlipCellBase* cell;                                                    // sublist cell entered
+      }; // struct Frame
+
+      SlipHeader*    list;                                                      // current list
+      SlipCellBase*  link;                                                      // current cell
+      unsigned       depth;                                                     // sublist levels entered
+      Frame          frame[DEPTH];                                              // sublist levels entered
+      vector<Frame>  spill;                                                     // sublist levels beyond DEPTH
+
+      void           downLevel(SlipCellBase* sublist);                          // Enter a sublist
+      void           leave();                                                   // Return to the enclosing list
+   public:
+      SlipCursor(const SlipHeader& header)
+                : list(const_cast<SlipHeader*>(&header)), link(list), depth(0) { SlipCellBase::loadList(link); }
+
+      SlipCursor&    advanceLWL() { link = link->getLeftLink();  return *this; } // advance linear word left
+      SlipCursor&    advanceLWR() { link = link->getRightLink(); return *this; } // advance linear word right
+      SlipCursor&    advanceSEL();                                              // advance structural element left
+      SlipCursor&    advanceSER();                                              // advance structural element right
+      SlipCursor&    advanceSNL();                                              // advance structural name left
+      SlipCursor&    advanceSNR();                                              // advance structural name right
+      SlipCursor&    advanceSWL();                                              // advance structural word left
+      SlipCursor&    advanceSWR();                                              // advance structural word right
+
+      SlipCell&      currentCell() const { return *static_cast<SlipCell*>(link); } // Return current SLIP cell being referenced
+      SlipHeader&    currentList() const { return *list; }                      // Return current SLIP list header being traversed
+      USHORT         listDepth()   const { return depth; }                      // Current list depth being traversed
+      SlipHeader&    reset()    { link = list; return *list; }                  // Break cursor to current list header
+      SlipCursor&    resetTop();                                                // Return to the topmost list
+      SlipCursor&    upLevel();                                                 // Return to previous level
+
+      bool           isData()    const { return link->isData();    }            // true if cell is data
+      bool           isHeader()  const { return link->isHeader();  }            // true if cell is a header
+      bool           isSublist() const { return link->isSublist(); }            // true if cell is sublist
+      string         toString() const;                                          // pretty print the cursor
+   }; // class SlipCursor
+}; // namespace slip
+
+#endif	/* _SLIPCURSOR_H */
@@ -31,6 +31,7 @@
 
 # include <iostream>
 # include <iomanip>
+# include <atomic>
 # include "SlipCellBase.h"
 # include "SlipCell.h"
 # include "SlipOp.h"
@@ -41,10 +42,27 @@
 # include "SlipHeader.h"
 # include "SlipStringConst.h"
 # include "SlipStringNonConst.h"
+# include "SlipStringInlineOp.h"
+# include "SlipStringInterned.h"
 # include "SlipSublist.h"
 
 namespace slip {
 
+   static atomic<bool> internMode(false);                                       //!< true non-constant strings are interned
+
+   /**
+    * @brief Return a SlipPointer for a non-constant string.
+    * <p>If interning is enabled the pooled SlipStringInterned object is
+    *    returned, otherwise a new SlipStringNonConst object.</p>
+    * @param[in] X (string*) string value
+    * @return (STRING) string object
+    */
+   static STRING newString(const string* X) {                                   // Non-constant string object
+      if (internMode.load(memory_order_relaxed))
+         return SlipStringInterned::intern(*X);
+      return new SlipStringNonConst(X);
+   }; // static STRING newString(const string* X)
+
     /*********************************************************
      *                   Private Functions                   *
     **********************************************************/
@@ -67,6 +85,22 @@ namespace slip {
       }
    }; // void SlipDatum::setDatumCell(void* op)
 
+   /**
+    * @brief Set a non-constant string datum and operator.
+    * <p>A string of at most SlipStringInlineOp::INLINESIZE bytes is held
+    *    in the datum field. A longer string is held in a SlipPointer.</p>
+    * @param[in] X (string*) string value
+    */
+   void SlipDatum::putString(const string* X) {                                 // Set a non-constant string
+      if (X->size() <= SlipStringInlineOp::INLINESIZE) {
+         setOperator((void*)stringInlineOP);
+         SlipStringInlineOp::put(*this, *X);
+      } else {
+         setOperator((void*)stringOP);
+         *getString() = newString(X);
+      }
+   }; // void SlipDatum::putString(const string* X)
+
     /*********************************************************
      *                  Protected Functions                  *
     **********************************************************/
@@ -216,13 +250,11 @@ namespace slip {
     * @param[in] constFlag <b>true</b> a constant string is input
     */
    SlipDatum::SlipDatum(const string& X, bool constFlag) {
-      STRING ptr;
       constructDatumCell((void*)stringOP);
       if (constFlag)
-         ptr = new SlipStringConst(&X);
+         *getString() = new SlipStringConst(&X);
       else
-         ptr = new SlipStringNonConst(&X);
-      *getString() = ptr;
+         putString(&X);
    }; // SlipDatum::SlipDatum(string& X, bool constFlag)
 
    /**
@@ -242,31 +274,51 @@ namespace slip {
     * @param[in] constFlag <b>true</b> a constant string is input
     */
    SlipDatum::SlipDatum(const string* X, bool constFlag) {
-      STRING ptr;
       constructDatumCell((void*)stringOP);
       if (constFlag)
-         ptr = new SlipStringConst(X);
+         *getString() = new SlipStringConst(X);
       else
-          ptr = new SlipStringNonConst(X);
-       *getString() = ptr;
+         putString(X);
    }; // SlipDatum::SlipDatum(string* X, bool constFlag)
 
    /**
-    * @fn SlipDatum::~SlipDatum()
+    * @fn SlipDatum::internStrings(bool flag)
+    * @brief Enable or disable string interning.
+    * <p>When enabled, non-constant STRINGs created by constructors,
+    *    assignment, replace and list input share one pooled copy of each
+    *    distinct string. Existing cells are unaffected.</p>
+    * @param[in] flag <b>true</b> intern strings
+    * @return the previous setting
+    */
+   bool SlipDatum::internStrings(bool flag) {                                   // Enable/disable string interning
+      return internMode.exchange(flag);
+   }; // bool SlipDatum::internStrings(bool flag)
+
+   /**
+    * @fn SlipDatum::internStrings()
+    * @brief Return the string interning setting.
+    * @return <b>true</b> if strings are interned
+    */
+   bool SlipDatum::internStrings() {                                            // true if strings are interned
+      return internMode.load();
+   }; // bool SlipDatum::internStrings()
+
+   /**
+    * @fn SlipDatum::release()
     * @brief Return SlipDatum object to the AVSL.
-    * <p>Destructor returns data to the AVSL.</p>
+    * <p>Called by <em>~SlipCellBase</em> to return data to the AVSL.</p>
     * <p>If the cell is linked into a list, a silent <em>unlink</em> removes
     *    the cell from the existing link. If the cell is not a valid candidate
     *    for AVSL insertion, then the request is silently ignored./p>
     * <p>Invalid AVSL objects are those already deleted, those never from the
     *    AVLS and those on the runtime stack.</p>
     */
-   SlipDatum::~SlipDatum() {
+   void SlipDatum::release() {
       if (!isDeleted() && !isTemp() && isAVSL(this)) {
          if (getLeftLink() != NULL)  unLink();
          addAVSLCells( this, this);
       }
-   }; // SlipDatum::~SlipDatum()
+   }; // void SlipDatum::release()
 
    /*********************************************************
     *                  Protected Methods                    *
@@ -288,6 +340,7 @@ namespace slip {
     *    Slip classes which have SlipOp derived objects have this method.</p>
     * <p>Before return, ensure that the <b>operator</b> field points to the
     *    undefined invariant property object and reset the <b>datum</b> field.</p>
+    * <p>A Descriptor List index holding the cell is discarded.</p>
     * <p><b>ERRORS</b></p>
     * <ul>
     *    <li><b>E3019</b> Cell has been deleted. Reference to cell is stale.</li>
@@ -296,6 +349,7 @@ namespace slip {
     */
    bool SlipDatum::assignPreamble() {                                           // Delete before change
       bool flag = isDeleted();
+      dListChanged(this);
       if (flag) {                                                               // Is the current cell deleted
          postError(__FILE__, __LINE__, SlipErr::E3019, "SlipDatum::assignPreamble", "", "", *this);
       }  else ((SlipOp*)*getOperator())->remove(*this);                         // Remove SlipPointer datum {PTR STRING}
@@ -3737,8 +3791,7 @@ namespace slip {
     */
    SlipDatum& SlipDatum::operator=(const string& X)    {
       assignPreamble();
-      setOperator((void*)stringOP);
-      *getString() = new SlipStringNonConst(&X);
+      putString(&X);
       return *this;
    }; // SlipDatum& SlipDatum::operator=(const string& X)
 
@@ -7252,9 +7305,10 @@ namespace slip {
     */
    SlipCell& SlipDatum::replace(const string& X, bool constFlag) {              // Replace a cell on a list with a new cell
       assignPreamble();
-      setOperator((void*)stringOP);
-      if (constFlag) *getString() = new SlipStringConst(&X);
-      else           *getString() = new SlipStringNonConst(&X);
+      if (constFlag) {
+         setOperator((void*)stringOP);
+         *getString() = new SlipStringConst(&X);
+      } else putString(&X);
       return *this;
    }; // SlipCell& SlipDatum::replace(const string& X, bool constFlag)
 
@@ -7276,9 +7330,10 @@ namespace slip {
     */
    SlipCell& SlipDatum::replace(const string* X, bool constFlag) {              // Replace a cell on a list with a new cell
       assignPreamble();
-      setOperator((void*)stringOP);
-      if (constFlag) *getString() = new SlipStringConst(X);
-      else           *getString() = new SlipStringNonConst(X);
+      if (constFlag) {
+         setOperator((void*)stringOP);
+         *getString() = new SlipStringConst(X);
+      } else putString(X);
       return *this;
    }; // SlipCell& SlipDatum::replace(const string* X, bool constFlag)
 
@@ -630,6 +630,14 @@ namespace slip {
  *    If they are used in a list, then the user should unlink them from the list
  *    to delete them. If deletion is done while the cell is on a list then a
  *    the cell will be silently unlinked and deleted.<p>
+ * <p>A non-constant STRING of up to 7 bytes is held in the cell datum
+ *    field with no heap use. A longer one normally holds its own copy of
+ *    the string. When interning is enabled
+ *    (<em>SlipDatum::internStrings(true)</em>) the string is placed into a
+ *    global string pool and cells with the same string share one reference
+ *    counted copy. Interned strings compare for equality by address.
+ *    Interning applies to STRINGs created after it is enabled, existing
+ *    cells are unchanged.</p>
  * <p>
  * SlipDatum cells are automatically created on the stack during execution of 
  * expressions. Intermediate terms in an expression create temporary SlipDatum 
@@ -931,11 +939,15 @@ namespace slip {
  */
 
    class SlipDatum : public SlipCell {
+         friend class SlipCellBase;
+         friend class SlipCell;
        private:
        /*********************************************************
         *                   Private Functions                   *
        **********************************************************/
          void constructDatumCell(void* op);                                     // Fill in the Datum Cell fields
+         void release();                                                        // Return the cell to the AVSL
+         void putString(const string* X);                                       // Set a non-constant string
        protected:
 
        /*********************************************************
@@ -948,7 +960,7 @@ namespace slip {
             this->setOperator(X->getOperator());
             *this->getData() = ((SlipOp*)*(X->getOperator()))->getDatumCopy(X); }
 
-         virtual SlipCell& factory() {                                         // Create a SlipCell
+                 SlipCell& factory() {                                         // Create a SlipCell
             return *(new SlipDatum(*this));
          }
          
@@ -991,7 +1003,8 @@ namespace slip {
          SlipDatum(const PTR X, const void* operation = ptrOP);
          SlipDatum(const string& X, bool constFlag = false);
          SlipDatum(const string* X, bool constFlag = false);
-         virtual ~SlipDatum();
+         static bool internStrings(bool flag);                                  // Enable/disable string interning
+         static bool internStrings();                                           // true if strings are interned
 
       /*********************************************************
        *                  Casting Operators                    *
@@ -1015,19 +1028,19 @@ namespace slip {
          ULONG      operator~()     { return ((SlipOp*)*getOperator())->bitNOT(*this);  }
          SlipDatum  operator+()     { return ((SlipOp*)*getOperator())->plus(*this);    }
          SlipDatum  operator-()     { return ((SlipOp*)*getOperator())->minus(*this);   }
-         SlipDatum& operator++()    { return ((SlipOp*)*getOperator())->preInc(*this);  }
-         SlipDatum& operator--()    { return ((SlipOp*)*getOperator())->preDec(*this);  }
-         SlipDatum& operator++(int) { return ((SlipOp*)*getOperator())->postInc(*this); }
-         SlipDatum& operator--(int) { return ((SlipOp*)*getOperator())->postDec(*this); }
+         SlipDatum& operator++()    { dListChanged(this); return ((SlipOp*)*getOperator())->preInc(*this);  }
+         SlipDatum& operator--()    { dListChanged(this); return ((SlipOp*)*getOperator())->preDec(*this);  }
+         SlipDatum& operator++(int) { dListChanged(this); return ((SlipOp*)*getOperator())->postInc(*this); }
+         SlipDatum& operator--(int) { dListChanged(this); return ((SlipOp*)*getOperator())->postDec(*this); }
 
           /*************************************************
            *                Binary operators               *
           *************************************************/
-         SlipDatum  operator+(const SlipDatum& X) { return ((SlipOp*)*getOperator())->add(*this,  X);}
-         SlipDatum  operator-(const SlipDatum& X) { return ((SlipOp*)*getOperator())->sub(*this,  X);}
-         SlipDatum  operator*(const SlipDatum& X) { return ((SlipOp*)*getOperator())->mul(*this,  X);}
-         SlipDatum  operator/(const SlipDatum& X) { return ((SlipOp*)*getOperator())->div(*this,  X);}
-         LONG       operator%(const SlipDatum& X) { return ((SlipOp*)*getOperator())->mod(*this,  X);}
+         SlipDatum  operator+(const SlipDatum& X) { return SlipOp::arithTable[SlipOp::ADD][getClassType()][X.getClassType()](*this, X);}
+         SlipDatum  operator-(const SlipDatum& X) { return SlipOp::arithTable[SlipOp::SUB][getClassType()][X.getClassType()](*this, X);}
+         SlipDatum  operator*(const SlipDatum& X) { return SlipOp::arithTable[SlipOp::MUL][getClassType()][X.getClassType()](*this, X);}
+         SlipDatum  operator/(const SlipDatum& X) { return SlipOp::arithTable[SlipOp::DIV][getClassType()][X.getClassType()](*this, X);}
+         LONG       operator%(const SlipDatum& X) { return SlipOp::modTable[getClassType()][X.getClassType()](*this, X);}
 
          SlipDatum  operator+(const DOUBLE X)     { return ((SlipOp*)*getOperator())->add(*this, X); }
          SlipDatum  operator-(const DOUBLE X)     { return ((SlipOp*)*getOperator())->sub(*this, X); }
@@ -1106,88 +1119,88 @@ namespace slip {
           /*************************************************
            *             Assignment operators              *
           *************************************************/
-         virtual SlipCell&  operator=(const SlipCell& X);                       // Y = V
-         virtual SlipDatum& operator=(const bool    X);                         // Y = V
-         virtual SlipDatum& operator=(const CHAR    X);                         // Y = V
-         virtual SlipDatum& operator=(const DOUBLE  X);                         // Y = V
-         virtual SlipDatum& operator=(const LONG    X);                         // Y = V
-         virtual SlipDatum& operator=(const UCHAR   X);                         // Y = V
-         virtual SlipDatum& operator=(const ULONG   X);                         // Y = V
-         virtual SlipDatum& operator=(const PTR     X);                         // Y = V
-         virtual SlipDatum& operator=(const string& X);                         // Y = V
-         virtual SlipDatum& operator=(const string* X);                         // Y = V
+                 SlipCell&  operator=(const SlipCell& X);                       // Y = V
+                 SlipDatum& operator=(const bool    X);                         // Y = V
+                 SlipDatum& operator=(const CHAR    X);                         // Y = V
+                 SlipDatum& operator=(const DOUBLE  X);                         // Y = V
+                 SlipDatum& operator=(const LONG    X);                         // Y = V
+                 SlipDatum& operator=(const UCHAR   X);                         // Y = V
+                 SlipDatum& operator=(const ULONG   X);                         // Y = V
+                 SlipDatum& operator=(const PTR     X);                         // Y = V
+                 SlipDatum& operator=(const string& X);                         // Y = V
+                 SlipDatum& operator=(const string* X);                         // Y = V
          SlipDatum& operator=(const SlipDatum& X) { return (SlipDatum&)operator=((SlipCell&)X); }
 
           /*************************************************
            *        Compound Assignment operators          *
           *************************************************/
-         SlipDatum& operator+=(const SlipDatum&  X) { return ((SlipOp*)*getOperator())->addAsgn(*this, X); }
-         SlipDatum& operator-=(const SlipDatum&  X) { return ((SlipOp*)*getOperator())->subAsgn(*this, X); }
-         SlipDatum& operator*=(const SlipDatum&  X) { return ((SlipOp*)*getOperator())->mulAsgn(*this, X); }
-         SlipDatum& operator/=(const SlipDatum&  X) { return ((SlipOp*)*getOperator())->divAsgn(*this, X); }
-         SlipDatum& operator%=(const SlipDatum&  X) { return ((SlipOp*)*getOperator())->modAsgn(*this, X); }
-         SlipDatum& operator<<=(const SlipDatum& X) { return ((SlipOp*)*getOperator())->shlAsgn(*this, X); }
-         SlipDatum& operator>>=(const SlipDatum& X) { return ((SlipOp*)*getOperator())->shrAsgn(*this, X); }
-         SlipDatum& operator&=(const SlipDatum&  X) { return ((SlipOp*)*getOperator())->bandAsgn(*this, X);}
-         SlipDatum& operator|=(const SlipDatum&  X) { return ((SlipOp*)*getOperator())->borAsgn(*this,  X);}
-         SlipDatum& operator^=(const SlipDatum&  X) { return ((SlipOp*)*getOperator())->bxorAsgn(*this, X);}
+         SlipDatum& operator+=(const SlipDatum&  X) { dListChanged(this); return ((SlipOp*)*getOperator())->addAsgn(*this, X); }
+         SlipDatum& operator-=(const SlipDatum&  X) { dListChanged(this); return ((SlipOp*)*getOperator())->subAsgn(*this, X); }
+         SlipDatum& operator*=(const SlipDatum&  X) { dListChanged(this); return ((SlipOp*)*getOperator())->mulAsgn(*this, X); }
+         SlipDatum& operator/=(const SlipDatum&  X) { dListChanged(this); return ((SlipOp*)*getOperator())->divAsgn(*this, X); }
+         SlipDatum& operator%=(const SlipDatum&  X) { dListChanged(this); return ((SlipOp*)*getOperator())->modAsgn(*this, X); }
+         SlipDatum& operator<<=(const SlipDatum& X) { dListChanged(this); return ((SlipOp*)*getOperator())->shlAsgn(*this, X); }
+         SlipDatum& operator>>=(const SlipDatum& X) { dListChanged(this); return ((SlipOp*)*getOperator())->shrAsgn(*this, X); }
+         SlipDatum& operator&=(const SlipDatum&  X) { dListChanged(this); return ((SlipOp*)*getOperator())->bandAsgn(*this, X);}
+         SlipDatum& operator|=(const SlipDatum&  X) { dListChanged(this); return ((SlipOp*)*getOperator())->borAsgn(*this,  X);}
+         SlipDatum& operator^=(const SlipDatum&  X) { dListChanged(this); return ((SlipOp*)*getOperator())->bxorAsgn(*this, X);}
 
-         SlipDatum& operator+=(const DOUBLE  X)   { return ((SlipOp*)*getOperator())->addAsgn(*this, X); }
-         SlipDatum& operator-=(const DOUBLE  X)   { return ((SlipOp*)*getOperator())->subAsgn(*this, X); }
-         SlipDatum& operator*=(const DOUBLE  X)   { return ((SlipOp*)*getOperator())->mulAsgn(*this, X); }
-         SlipDatum& operator/=(const DOUBLE  X)   { return ((SlipOp*)*getOperator())->divAsgn(*this, X); }
+         SlipDatum& operator+=(const DOUBLE  X)   { dListChanged(this); return ((SlipOp*)*getOperator())->addAsgn(*this, X); }
+         SlipDatum& operator-=(const DOUBLE  X)   { dListChanged(this); return ((SlipOp*)*getOperator())->subAsgn(*this, X); }
+         SlipDatum& operator*=(const DOUBLE  X)   { dListChanged(this); return ((SlipOp*)*getOperator())->mulAsgn(*this, X); }
+         SlipDatum& operator/=(const DOUBLE  X)   { dListChanged(this); return ((SlipOp*)*getOperator())->divAsgn(*this, X); }
 
-         SlipDatum& operator+=(const bool    X)   { return ((SlipOp*)*getOperator())->addAsgn(*this, (LONG)X); }
-         SlipDatum& operator-=(const bool    X)   { return ((SlipOp*)*getOperator())->subAsgn(*this, (LONG)X); }
+         SlipDatum& operator+=(const bool    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->addAsgn(*this, (LONG)X); }
+         SlipDatum& operator-=(const bool    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->subAsgn(*this, (LONG)X); }
 
-         SlipDatum& operator+=(const UCHAR   X)   { return ((SlipOp*)*getOperator())->addAsgn(*this, (ULONG)X); }
-         SlipDatum& operator-=(const UCHAR   X)   { return ((SlipOp*)*getOperator())->subAsgn(*this, (ULONG)X); }
-         SlipDatum& operator*=(const UCHAR   X)   { return ((SlipOp*)*getOperator())->mulAsgn(*this, (ULONG)X); }
-         SlipDatum& operator/=(const UCHAR   X)   { return ((SlipOp*)*getOperator())->divAsgn(*this, (ULONG)X); }
-         SlipDatum& operator%=(const UCHAR   X)   { return ((SlipOp*)*getOperator())->modAsgn(*this, (ULONG)X); }
-         SlipDatum& operator<<=(const UCHAR  X)   { return ((SlipOp*)*getOperator())->shlAsgn(*this, (ULONG)X); }
-         SlipDatum& operator>>=(const UCHAR  X)   { return ((SlipOp*)*getOperator())->shrAsgn(*this, (ULONG)X); }
-         SlipDatum& operator&=(const UCHAR   X)   { return ((SlipOp*)*getOperator())->bandAsgn(*this, (ULONG)X);}
-         SlipDatum& operator|=(const UCHAR   X)   { return ((SlipOp*)*getOperator())->borAsgn(*this, (ULONG)X); }
-         SlipDatum& operator^=(const UCHAR   X)   { return ((SlipOp*)*getOperator())->bxorAsgn(*this, (ULONG)X);}
+         SlipDatum& operator+=(const UCHAR   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->addAsgn(*this, (ULONG)X); }
+         SlipDatum& operator-=(const UCHAR   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->subAsgn(*this, (ULONG)X); }
+         SlipDatum& operator*=(const UCHAR   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->mulAsgn(*this, (ULONG)X); }
+         SlipDatum& operator/=(const UCHAR   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->divAsgn(*this, (ULONG)X); }
+         SlipDatum& operator%=(const UCHAR   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->modAsgn(*this, (ULONG)X); }
+         SlipDatum& operator<<=(const UCHAR  X)   { dListChanged(this); return ((SlipOp*)*getOperator())->shlAsgn(*this, (ULONG)X); }
+         SlipDatum& operator>>=(const UCHAR  X)   { dListChanged(this); return ((SlipOp*)*getOperator())->shrAsgn(*this, (ULONG)X); }
+         SlipDatum& operator&=(const UCHAR   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->bandAsgn(*this, (ULONG)X);}
+         SlipDatum& operator|=(const UCHAR   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->borAsgn(*this, (ULONG)X); }
+         SlipDatum& operator^=(const UCHAR   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->bxorAsgn(*this, (ULONG)X);}
 
-         SlipDatum& operator+=(const CHAR    X)   { return ((SlipOp*)*getOperator())->addAsgn(*this, (LONG)X); }
-         SlipDatum& operator-=(const CHAR    X)   { return ((SlipOp*)*getOperator())->subAsgn(*this, (LONG)X); }
-         SlipDatum& operator*=(const CHAR    X)   { return ((SlipOp*)*getOperator())->mulAsgn(*this, (LONG)X); }
-         SlipDatum& operator/=(const CHAR    X)   { return ((SlipOp*)*getOperator())->divAsgn(*this, (LONG)X); }
-         SlipDatum& operator%=(const CHAR    X)   { return ((SlipOp*)*getOperator())->modAsgn(*this, (LONG)X); }
-         SlipDatum& operator<<=(const CHAR   X)   { return ((SlipOp*)*getOperator())->shlAsgn(*this, (LONG)X); }
-         SlipDatum& operator>>=(const CHAR   X)   { return ((SlipOp*)*getOperator())->shrAsgn(*this, (LONG)X); }
-         SlipDatum& operator&=(const CHAR    X)   { return ((SlipOp*)*getOperator())->bandAsgn(*this, (LONG)X);}
-         SlipDatum& operator|=(const CHAR    X)   { return ((SlipOp*)*getOperator())->borAsgn(*this, (LONG)X); }
-         SlipDatum& operator^=(const CHAR    X)   { return ((SlipOp*)*getOperator())->bxorAsgn(*this, (LONG)X);}
+         SlipDatum& operator+=(const CHAR    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->addAsgn(*this, (LONG)X); }
+         SlipDatum& operator-=(const CHAR    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->subAsgn(*this, (LONG)X); }
+         SlipDatum& operator*=(const CHAR    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->mulAsgn(*this, (LONG)X); }
+         SlipDatum& operator/=(const CHAR    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->divAsgn(*this, (LONG)X); }
+         SlipDatum& operator%=(const CHAR    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->modAsgn(*this, (LONG)X); }
+         SlipDatum& operator<<=(const CHAR   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->shlAsgn(*this, (LONG)X); }
+         SlipDatum& operator>>=(const CHAR   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->shrAsgn(*this, (LONG)X); }
+         SlipDatum& operator&=(const CHAR    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->bandAsgn(*this, (LONG)X);}
+         SlipDatum& operator|=(const CHAR    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->borAsgn(*this, (LONG)X); }
+         SlipDatum& operator^=(const CHAR    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->bxorAsgn(*this, (LONG)X);}
 
-         SlipDatum& operator+=(const ULONG   X)   { return ((SlipOp*)*getOperator())->addAsgn(*this, X); }
-         SlipDatum& operator-=(const ULONG   X)   { return ((SlipOp*)*getOperator())->subAsgn(*this, X); }
-         SlipDatum& operator*=(const ULONG   X)   { return ((SlipOp*)*getOperator())->mulAsgn(*this, X); }
-         SlipDatum& operator/=(const ULONG   X)   { return ((SlipOp*)*getOperator())->divAsgn(*this, X); }
-         SlipDatum& operator%=(const ULONG   X)   { return ((SlipOp*)*getOperator())->modAsgn(*this, X); }
-         SlipDatum& operator<<=(const ULONG  X)   { return ((SlipOp*)*getOperator())->shlAsgn(*this, X); }
-         SlipDatum& operator>>=(const ULONG  X)   { return ((SlipOp*)*getOperator())->shrAsgn(*this, X); }
-         SlipDatum& operator&=(const ULONG   X)   { return ((SlipOp*)*getOperator())->bandAsgn(*this, X);}
-         SlipDatum& operator|=(const ULONG   X)   { return ((SlipOp*)*getOperator())->borAsgn(*this, X); }
-         SlipDatum& operator^=(const ULONG   X)   { return ((SlipOp*)*getOperator())->bxorAsgn(*this, X);}
+         SlipDatum& operator+=(const ULONG   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->addAsgn(*this, X); }
+         SlipDatum& operator-=(const ULONG   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->subAsgn(*this, X); }
+         SlipDatum& operator*=(const ULONG   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->mulAsgn(*this, X); }
+         SlipDatum& operator/=(const ULONG   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->divAsgn(*this, X); }
+         SlipDatum& operator%=(const ULONG   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->modAsgn(*this, X); }
+         SlipDatum& operator<<=(const ULONG  X)   { dListChanged(this); return ((SlipOp*)*getOperator())->shlAsgn(*this, X); }
+         SlipDatum& operator>>=(const ULONG  X)   { dListChanged(this); return ((SlipOp*)*getOperator())->shrAsgn(*this, X); }
+         SlipDatum& operator&=(const ULONG   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->bandAsgn(*this, X);}
+         SlipDatum& operator|=(const ULONG   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->borAsgn(*this, X); }
+         SlipDatum& operator^=(const ULONG   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->bxorAsgn(*this, X);}
 
-         SlipDatum& operator+=(const LONG    X)   { return ((SlipOp*)*getOperator())->addAsgn(*this, X); }
-         SlipDatum& operator-=(const LONG    X)   { return ((SlipOp*)*getOperator())->subAsgn(*this, X); }
-         SlipDatum& operator*=(const LONG    X)   { return ((SlipOp*)*getOperator())->mulAsgn(*this, X); }
-         SlipDatum& operator/=(const LONG    X)   { return ((SlipOp*)*getOperator())->divAsgn(*this, X); }
-         SlipDatum& operator%=(const LONG    X)   { return ((SlipOp*)*getOperator())->modAsgn(*this, X); }
-         SlipDatum& operator<<=(const LONG   X)   { return ((SlipOp*)*getOperator())->shlAsgn(*this, X); }
-         SlipDatum& operator>>=(const LONG   X)   { return ((SlipOp*)*getOperator())->shrAsgn(*this, X); }
-         SlipDatum& operator&=(const LONG    X)   { return ((SlipOp*)*getOperator())->bandAsgn(*this, X);}
-         SlipDatum& operator|=(const LONG    X)   { return ((SlipOp*)*getOperator())->borAsgn(*this, X);}
-         SlipDatum& operator^=(const LONG    X)   { return ((SlipOp*)*getOperator())->bxorAsgn(*this, X);}
+         SlipDatum& operator+=(const LONG    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->addAsgn(*this, X); }
+         SlipDatum& operator-=(const LONG    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->subAsgn(*this, X); }
+         SlipDatum& operator*=(const LONG    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->mulAsgn(*this, X); }
+         SlipDatum& operator/=(const LONG    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->divAsgn(*this, X); }
+         SlipDatum& operator%=(const LONG    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->modAsgn(*this, X); }
+         SlipDatum& operator<<=(const LONG   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->shlAsgn(*this, X); }
+         SlipDatum& operator>>=(const LONG   X)   { dListChanged(this); return ((SlipOp*)*getOperator())->shrAsgn(*this, X); }
+         SlipDatum& operator&=(const LONG    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->bandAsgn(*this, X);}
+         SlipDatum& operator|=(const LONG    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->borAsgn(*this, X);}
+         SlipDatum& operator^=(const LONG    X)   { dListChanged(this); return ((SlipOp*)*getOperator())->bxorAsgn(*this, X);}
 
           /*************************************************
            *              Logical operators                *
           *************************************************/
-         virtual bool  operator==(const SlipCell& X);                           // Y == X
+                 bool  operator==(const SlipCell& X);                           // Y == X
 
          bool       operator!=(const SlipDatum& X) { return !((SlipOp*)*getOperator())->equal(*this,     X); }
          bool       operator<(const SlipDatum&  X) { return ((SlipOp*)*getOperator())->lessThan(*this,   X); }
@@ -1258,24 +1271,24 @@ namespace slip {
                /*****************************************
                 *          Manipulating Lists           *
                ******************************************/
-         virtual SlipCell& replace(const SlipCell& X);                          // Replace a cell on a list with a new cell
-         virtual SlipCell& replace(bool X);                                     // Replace a cell on a list with a new cell
-         virtual SlipCell& replace(CHAR X);                                     // Replace a cell on a list with a new cell
-         virtual SlipCell& replace(UCHAR X);                                    // Replace a cell on a list with a new cell
-         virtual SlipCell& replace(LONG X);                                     // Replace a cell on a list with a new cell
-         virtual SlipCell& replace(ULONG X);                                    // Replace a cell on a list with a new cell
-         virtual SlipCell& replace(DOUBLE X);                                   // Replace a cell on a list with a new cell
-         virtual SlipCell& replace(const PTR X, const void* operation = ptrOP); // Replace a cell on a list with a new cell
-         virtual SlipCell& replace(const string& X, bool constFlag = false);    // Replace a cell on a list with a new cell
-         virtual SlipCell& replace(const string* X, bool constFlag = false);    // Replace a cell on a list with a new cell
+                 SlipCell& replace(const SlipCell& X);                          // Replace a cell on a list with a new cell
+                 SlipCell& replace(bool X);                                     // Replace a cell on a list with a new cell
+                 SlipCell& replace(CHAR X);                                     // Replace a cell on a list with a new cell
+                 SlipCell& replace(UCHAR X);                                    // Replace a cell on a list with a new cell
+                 SlipCell& replace(LONG X);                                     // Replace a cell on a list with a new cell
+                 SlipCell& replace(ULONG X);                                    // Replace a cell on a list with a new cell
+                 SlipCell& replace(DOUBLE X);                                   // Replace a cell on a list with a new cell
+                 SlipCell& replace(const PTR X, const void* operation = ptrOP); // Replace a cell on a list with a new cell
+                 SlipCell& replace(const string& X, bool constFlag = false);    // Replace a cell on a list with a new cell
+                 SlipCell& replace(const string* X, bool constFlag = false);    // Replace a cell on a list with a new cell
 
                /*****************************************
                 *             Miscellaneous             *
                ******************************************/
          Parse              getParse();                                         // Return a pointer to the User Data parse method
-         virtual string     write();                                            // Return a write formatted string
-         virtual string     dump() const;                                       // dump cell
-         virtual void       dump(ostream& out, int& col);                       // Output the current cell
+                 string     write();                                            // Return a write formatted string
+                 string     dump() const;                                       // dump cell
+                 void       dump(ostream& out, int& col);                       // Output the current cell
    }; // class SlipDatum
 }; // namespace slip
 #endif  /* SLIPDATUM_H */
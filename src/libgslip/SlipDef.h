@@ -115,6 +115,24 @@ class SlipCellBase;
      , eException                                                               //!< issue a warning message & throw an exception
   };
 
+   /**
+    * @brief The sources of AVSL fragment memory.
+    * <p></p>
+    * <center>
+    * | source     | memory                                           |
+    * | :--------- | :----------------------------------------------- |
+    * | eHeap      | C++ heap                                         |
+    * | eMap       | anonymous memory map                             |
+    * | eHugePage  | huge page backed anonymous memory map            |
+    * -------------------------------------------------------------------
+    * </center>
+    */
+  enum avslSource {
+       eHeap                                                                    //!< operator new[]
+     , eMap                                                                     //!< mmap
+     , eHugePage                                                                //!< mmap with MAP_HUGETLB or MADV_HUGEPAGE
+  };
+
     //---------------------------------------------------------------------
     // Slip operation types
     //---------------------------------------------------------------------
@@ -178,12 +196,16 @@ class SlipCellBase;
      *      list must be manually deleted (garbage collection is manual).</li>
      * <li> <b>Mrk:LSTMRK</b> User defined identifier (mark). This is an
      *      uncontrolled numeric field reserved for user use.</li>
+     * <li> <b>Count:LSTCNT</b> The number of cells in the list, or
+     *      <em>COUNTUNKNOWN</em> if the count must be found by a walk of the
+     *      list. The field uses the padding of the Header data field.</li>
      * </ul>
      */
     struct sHeadData {                           // SLIP Header Datum Field
         void*      descriptionList;              //!< Association list Pointer
         USHORT     refCnt;                       //!< List Usage Count
         USHORT     mrk;                          //!< List in use mark
+        ULONG      count;                        //!< Number of cells in the list
     }; // struct sHeadData
 
     /**
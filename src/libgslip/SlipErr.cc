@@ -68,6 +68,24 @@ bool defaultCallback(string filename, int lineno, SlipErr::Error err, string mes
  */   
 static errorCallback callBack = defaultCallback;         //!< pointer to callbace function
 
+/**
+ * @var slip::threadCallBack
+ *
+ * @brief Container for a callback function used by one thread.
+ *
+ * <p>When not <b>NULL</b> the function replaces the user callback function
+ *    for messages posted on the thread which set it.</p>
+ */
+static thread_local errorCallback threadCallBack = NULL; //!< pointer to thread callback function
+
+/**
+ * @brief Return the callback function for the current thread.
+ * @return thread callback function if set, otherwise the user callback function
+ */
+static errorCallback currentCallBack() {
+   return (threadCallBack)? threadCallBack: callBack;
+}; // static errorCallback currentCallBack()
+
 /**
  * @var slip::SlipErr::slipMessage
  * 
@@ -195,6 +213,9 @@ SlipErr::Error SlipErr::slipMessage[SlipErr::ELAST] = {
     , SlipErr::Error(SlipErr::E3024, eException, "E3024", "Delete header is illegal. header.deleteList() must be used. ")
     , SlipErr::Error(SlipErr::E3025, eException, "E3025", "Descriptor List has incorrect number of entries. ")
     , SlipErr::Error(SlipErr::E3026, eException, "E3025", "Attempt to use deleted SlipHeader. ")
+    , SlipErr::Error(SlipErr::E3027, eException, "E3027", "List cell count does not match the list. ")
+    , SlipErr::Error(SlipErr::E3028, eException, "E3028", "List cell is not numeric. ")
+    , SlipErr::Error(SlipErr::E3029, eException, "E3029", "Lists are not the same size. ")
 
           //-------------------------------------------------------------
           // Input/Output errors
@@ -218,6 +239,8 @@ SlipErr::Error SlipErr::slipMessage[SlipErr::ELAST] = {
     , SlipErr::Error(SlipErr::E4017, eWarning,   "E4017", "Can not attach a anonymous list to a named list. ")
     , SlipErr::Error(SlipErr::E4018, eWarning,   "E4018", "Named List in Descriptor List can not be found. ")
     , SlipErr::Error(SlipErr::E4019, eWarning,   "E4019", "Descriptor list not empty in name list.. ")
+    , SlipErr::Error(SlipErr::E4020, eWarning,   "E4020", "Binary list file is not valid. ")
+    , SlipErr::Error(SlipErr::E4021, eWarning,   "E4021", "User Data has no binary form. An empty list is written. ")
     }; //
 
    /**
@@ -342,7 +365,7 @@ SlipErr::Error SlipErr::slipMessage[SlipErr::ELAST] = {
               << prefix << ' ' << base.getMessage() << ' ' << suffix << endl
               << "      " << cell1.dump() << endl
               << "      " << cell2.dump() << endl;
-      if (callBack(file, lineno, base, message.str())) 
+      if (currentCallBack()(file, lineno, base, message.str())) 
          throw SlipException(base, message.str(), &cell1, &cell2); 
    }; // void postError(string file, int lineno, SlipErr::eError error, string name, string prefix, string suffix, const SlipCellBase& cell1, const SlipCellBase& cell2)
 
@@ -406,8 +429,8 @@ SlipErr::Error SlipErr::slipMessage[SlipErr::ELAST] = {
               << base.getErrorNumber() << ' '
               << prefix << ' ' << base.getMessage() << ' ' << suffix << endl
               << "      " << cell1.dump() << endl;
-      if (callBack) {
-         if (callBack(file, lineno, base, message.str())) 
+      if (currentCallBack()) {
+         if (currentCallBack()(file, lineno, base, message.str())) 
             throw SlipException(base, message.str(), &cell1, NULL); 
       } else {
          cout << message.str() << flush;
@@ -474,8 +497,8 @@ SlipErr::Error SlipErr::slipMessage[SlipErr::ELAST] = {
       message << file << ':' << lineno << " in " << name << ": "
               << base.getErrorNumber() << ' '
               << prefix << ' ' << base.getMessage() << ' '<< suffix << endl;
-      if (callBack) {
-         if (callBack(file, lineno, base, message.str())) 
+      if (currentCallBack()) {
+         if (currentCallBack()(file, lineno, base, message.str())) 
             throw SlipException(base, message.str(), NULL, NULL);
       } else {
          cout << message.str() << flush;
@@ -539,8 +562,8 @@ SlipErr::Error SlipErr::slipMessage[SlipErr::ELAST] = {
       stringstream message;
       message << file << ':' << lineno << " in " << name << ": "
               << base.getErrorNumber() << endl;
-      if (callBack) {
-         if (callBack(file, lineno, base, message.str())) 
+      if (currentCallBack()) {
+         if (currentCallBack()(file, lineno, base, message.str())) 
             throw SlipException(base, message.str(), NULL, NULL); 
       } else {
          cout << message.str() << flush;
@@ -570,5 +593,22 @@ SlipErr::Error SlipErr::slipMessage[SlipErr::ELAST] = {
       return tmp;
    }; // errorCallback userCallBack(errorCallback callBack)
 
+   /**
+    * @brief Setup a diagnostic message callback for the current thread.
+    *
+    * <p>Messages posted on the current thread use this callback function
+    *    in place of the user callback function. Other threads are not
+    *    affected. A <b>NULL</b> input restores the user callback function
+    *    for the thread.</p>
+    *
+    * @param callBack (errorCallBack) thread diagnostic message handler.
+    * @return the previous thread callback function.
+    */
+   errorCallback userThreadCallBack(errorCallback callBack) {                    // Set thread error callback function
+      errorCallback tmp = threadCallBack;
+      threadCallBack = callBack;
+      return tmp;
+   }; // errorCallback userThreadCallBack(errorCallback callBack)
+
 
 }; // namcespace slip
@@ -241,6 +241,9 @@ namespace slip {
                      , E3024                       //!<  Delete header is illegal. header.deleteList() must be used
                      , E3025                       //!<  Descriptor List has incorrect number of entries
                      , E3026                       //!<  Attempt to use deleted SlipHeader
+                     , E3027                       //!<  List cell count does not match the list
+                     , E3028                       //!<  List cell is not numeric
+                     , E3029                       //!<  Lists are not the same size
 
           //-------------------------------------------------------------
           // Input/Output errors
@@ -264,6 +267,8 @@ namespace slip {
                      , E4017                       //!<  Can not attach a anonymous list to a named list.
                      , E4018                       //!<  Named List in Descriptor List can not be found.
                      , E4019                       //!<  Descriptor list not empty in name list..
+                     , E4020                       //!<  Binary list file is not valid
+                     , E4021                       //!<  User Data has no binary form
                      , ELAST                       //!<  marker for number of enums in list
                      }; // enum eError
 
@@ -369,6 +374,7 @@ namespace slip {
    void postError(string file, int lineno, SlipErr::eError error, string name, string prefix, string suffix);
    void postError(string file, int lineno, SlipErr::eError error, string name);
    errorCallback userCallBack(errorCallback callBack);                          // Set user defined error callback function.s
+   errorCallback userThreadCallBack(errorCallback callBack);                    // Set thread error callback function
 
 } // namespace slip
 
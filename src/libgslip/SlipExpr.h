@@ -0,0 +1,332 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file    SlipExpr.h
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ * @brief Expression templates for SlipDatum arithmetic.
+ * <p>Each SlipDatum arithmetic operator returns a new SlipDatum, so that
+ *    <tt>(-b + b*b - 4*a*c)/2</tt> makes a temporary cell for each operator
+ *    and each operator is a virtual call. This file is an opt-in layer which
+ *    builds the whole expression as a type, evaluates it in native types and
+ *    makes a single SlipDatum for the result.</p>
+ * <p>An expression is started by <b>slipExpr</b>(SlipDatum) and is extended
+ *    by the operators +, -, *, / and % with another expression, a SlipDatum
+ *    or a C++ arithmetic value. The expression is evaluated when it is
+ *    converted to a SlipDatum, or by <b>eval()</b>:</p>
+ * <pre>
+ *    SlipExpr<SlipExprLeaf> A = slipExpr(a), B = slipExpr(b), C = slipExpr(c);
+ *    SlipDatum x = (-B + B*B - 4*A*C) / 2;
+ * </pre>
+ * <p>An operator between two SlipDatum objects is not part of an
+ *    expression: in <tt>slipExpr(b) + b*b</tt> the <tt>b*b</tt> is a
+ *    SlipDatum operation.</p>
+ * <p>The result type and value are those of the same expression written
+ *    with SlipDatum operators, where a C++ value is treated as a SlipDatum
+ *    of its type (int as LONG, unsigned as ULONG, double as DOUBLE). If an
+ *    operand is not numeric (or % has a DOUBLE operand) the expression is
+ *    evaluated with the SlipDatum operators, so the same error is posted.</p>
+ */
+
+#ifndef _SLIPEXPR_H
+#define	_SLIPEXPR_H
+
+# include <type_traits>
+# include "SlipDef.h"
+# include "SlipCellBase.h"
+# include "SlipDatum.h"
+
+using namespace std;
+
+namespace slip {
+
+   /**
+    * @class SlipExprNum
+    * @brief A numeric SlipDatum value held in a native type.
+    * <p>The <b>type</b> is the SlipDatum type of the value. The value is
+    *    kept widened: bool, CHAR and LONG as a LONG, UCHAR and ULONG as a
+    *    ULONG. Each operation gives the type and value of the SlipDatum
+    *    operation with the same operands.</p>
+    */
+   class SlipExprNum {
+   public:
+      ClassType type;                                                           //!< SlipDatum type of the value
+      union {
+         LONG   l;                                                              //!< bool, CHAR, LONG value
+         ULONG  u;                                                              //!< UCHAR, ULONG value
+         DOUBLE d;                                                              //!< DOUBLE value
+      };
+   private:
+      enum Wide { W_LONG, W_ULONG, W_DOUBLE };
+      Wide wide() const {
+         return (type == eDOUBLE)? W_DOUBLE
+              : ((type == eUCHAR) || (type == eULONG))? W_ULONG: W_LONG;
+      }; // Wide wide() const
+      template<class T> static T value(const SlipExprNum& X) {                  // value with C++ promotion
+         return (X.type == eDOUBLE)? (T)X.d: (X.type == eULONG)? (T)X.u
+              : (X.type == eUCHAR)? (T)(LONG)X.u: (T)X.l;
+      }; // template<class T> static T value(const SlipExprNum& X)
+      template<class T> static T apply(int op, T Y, const SlipExprNum& X) {
+         if (X.type == eDOUBLE) {
+            DOUBLE x = X.d;
+            switch(op) { case '+': Y += x; break; case '-': Y -= x; break;
+                         case '*': Y *= x; break; default:  Y /= x; break; }
+         } else if (X.type == eULONG) {
+            ULONG x = X.u;
+            switch(op) { case '+': Y += x; break; case '-': Y -= x; break;
+                         case '*': Y *= x; break; default:  Y /= x; break; }
+         } else {
+            LONG x = value<LONG>(X);
+            switch(op) { case '+': Y += x; break; case '-': Y -= x; break;
+                         case '*': Y *= x; break; default:  Y /= x; break; }
+         }
+         return Y;
+      }; // template<class T> static T apply(int op, T Y, const SlipExprNum& X)
+   public:
+      SlipExprNum() : type(eLONG), l(0) { }
+      SlipExprNum(bool   X) : type(eBOOL),   l(X) { }
+      SlipExprNum(CHAR   X) : type(eCHAR),   l(X) { }
+      SlipExprNum(UCHAR  X) : type(eUCHAR),  u(X) { }
+      SlipExprNum(LONG   X) : type(eLONG),   l(X) { }
+      SlipExprNum(ULONG  X) : type(eULONG),  u(X) { }
+      SlipExprNum(DOUBLE X) : type(eDOUBLE), d(X) { }
+
+      /**
+       * @brief Load a SlipDatum value.
+       * @param[in] X SlipDatum
+       * @return <b>false</b> if X is not numeric
+       */
+      bool load(const SlipDatum& X) {
+         switch(type = X.getClassType()) {
+            case eBOOL:   l = *SlipCellBase::getBool(X);   return true;
+            case eCHAR:   l = *SlipCellBase::getChar(X);   return true;
+            case eLONG:   l = *SlipCellBase::getLong(X);   return true;
+            case eUCHAR:  u = *SlipCellBase::getUChar(X);  return true;
+            case eULONG:  u = *SlipCellBase::getULong(X);  return true;
+            case eDOUBLE: d = *SlipCellBase::getDouble(X); return true;
+            default:                                       return false;
+         }
+      }; // bool load(const SlipDatum& X)
+
+      /**
+       * @brief Y op X for op one of '+', '-', '*', '/'.
+       * <p>The LHS is widened and the RHS is used with the C++ conversions.
+       *    The result is a DOUBLE if either operand is a DOUBLE, otherwise
+       *    a ULONG for + and * with a ULONG RHS and the widened LHS type for
+       *    the rest.</p>
+       */
+      static SlipExprNum arith(int op, const SlipExprNum& Y, const SlipExprNum& X) {
+         if ((Y.wide() == W_DOUBLE) || (X.type == eDOUBLE))
+            return SlipExprNum(apply<DOUBLE>(op, value<DOUBLE>(Y), X));
+         if (((op == '+') || (op == '*')) && (X.type == eULONG))
+            return SlipExprNum(apply<ULONG>(op, (Y.wide() == W_ULONG)? Y.u: (ULONG)Y.l, X));
+         if (Y.wide() == W_ULONG)
+            return SlipExprNum(apply<ULONG>(op, Y.u, X));
+         return SlipExprNum(apply<LONG>(op, Y.l, X));
+      }; // static SlipExprNum arith(int op, const SlipExprNum& Y, const SlipExprNum& X)
+
+      /**
+       * @brief Y % X computed in the widened LHS type, a LONG result.
+       * @note Neither operand is a DOUBLE.
+       */
+      static SlipExprNum mod(const SlipExprNum& Y, const SlipExprNum& X) {
+         if (Y.wide() == W_ULONG) {
+            ULONG num = Y.u;
+            if (X.type == eULONG) num %= X.u; else num %= value<LONG>(X);
+            return SlipExprNum((LONG)num);
+         }
+         LONG num = Y.l;
+         if (X.type == eULONG) num %= X.u; else num %= value<LONG>(X);
+         return SlipExprNum(num);
+      }; // static SlipExprNum mod(const SlipExprNum& Y, const SlipExprNum& X)
+
+      /**
+       * @brief -Y or +Y.
+       * <p>bool and CHAR give a LONG, LONG, UCHAR and ULONG give a ULONG.</p>
+       */
+      static SlipExprNum unary(int op, const SlipExprNum& Y) {
+         if (Y.type == eDOUBLE) return SlipExprNum((op == '-')? -Y.d: Y.d);
+         if ((Y.type == eBOOL) || (Y.type == eCHAR))
+            return SlipExprNum((op == '-')? -Y.l: Y.l);
+         ULONG num = (Y.type == eLONG)? (ULONG)Y.l: Y.u;
+         return SlipExprNum((op == '-')? -num: num);
+      }; // static SlipExprNum unary(int op, const SlipExprNum& Y)
+
+      SlipDatum datum() const {                                                 // Make the result cell
+         switch(type) {
+            case eBOOL:   return SlipDatum((bool)l);
+            case eCHAR:   return SlipDatum((CHAR)l);
+            case eUCHAR:  return SlipDatum((UCHAR)u);
+            case eULONG:  return SlipDatum(u);
+            case eDOUBLE: return SlipDatum(d);
+            default:      return SlipDatum(l);
+         }
+      }; // SlipDatum datum() const
+   }; // class SlipExprNum
+
+   /**
+    * @brief A SlipDatum operand, held by reference.
+    */
+   class SlipExprLeaf {
+      const SlipDatum& X;
+   public:
+      SlipExprLeaf(const SlipDatum& X) : X(X) { }
+      bool      num(SlipExprNum& Y) const { return Y.load(X); }
+      SlipDatum datum() const { return X; }
+   }; // class SlipExprLeaf
+
+   /**
+    * @brief A C++ arithmetic operand.
+    */
+   class SlipExprConst {
+      SlipExprNum X;
+   public:
+      template<class T> SlipExprConst(T X, typename enable_if<is_floating_point<T>::value>::type* = 0)
+                     : X((DOUBLE)X) { }
+      template<class T> SlipExprConst(T X, typename enable_if<is_integral<T>::value>::type* = 0)
+                     : X(is_same<T, bool>::value? SlipExprNum((bool)X)
+                       : is_same<T, char>::value || is_same<T, signed char>::value? SlipExprNum((CHAR)X)
+                       : is_same<T, unsigned char>::value? SlipExprNum((UCHAR)X)
+                       : is_signed<T>::value? SlipExprNum((LONG)X): SlipExprNum((ULONG)X)) { }
+      bool      num(SlipExprNum& Y) const { Y = X; return true; }
+      SlipDatum datum() const { return X.datum(); }
+   }; // class SlipExprConst
+
+   /**
+    * @brief L op R.
+    */
+   template<int OP, class L, class R> class SlipExprBinary {
+      L lhs;
+      R rhs;
+   public:
+      SlipExprBinary(const L& lhs, const R& rhs) : lhs(lhs), rhs(rhs) { }
+      bool num(SlipExprNum& Y) const {
+         SlipExprNum X;
+         if (!lhs.num(Y) || !rhs.num(X)) return false;
+         if (OP != '%') { Y = SlipExprNum::arith(OP, Y, X); return true; }
+         if ((Y.type == eDOUBLE) || (X.type == eDOUBLE)) return false;
+         Y = SlipExprNum::mod(Y, X);
+         return true;
+      }; // bool num(SlipExprNum& Y) const
+      SlipDatum datum() const {
+         SlipDatum Y = lhs.datum();
+         SlipDatum X = rhs.datum();
+         switch(OP) {
+            case '+': return Y + X;
+            case '-': return Y - X;
+            case '*': return Y * X;
+            case '/': return Y / X;
+            default:  return SlipDatum(Y % X);
+         }
+      }; // SlipDatum datum() const
+   }; // template<int OP, class L, class R> class SlipExprBinary
+
+   /**
+    * @brief op E.
+    */
+   template<int OP, class E> class SlipExprUnary {
+      E arg;
+   public:
+      SlipExprUnary(const E& arg) : arg(arg) { }
+      bool num(SlipExprNum& Y) const {
+         if (!arg.num(Y)) return false;
+         Y = SlipExprNum::unary(OP, Y);
+         return true;
+      }; // bool num(SlipExprNum& Y) const
+      SlipDatum datum() const {
+         SlipDatum Y = arg.datum();
+         return (OP == '-')? -Y: +Y;
+      }; // SlipDatum datum() const
+   }; // template<int OP, class E> class SlipExprUnary
+
+   /**
+    * @class SlipExpr
+    * @brief An unevaluated SlipDatum expression.
+    * <p>Operands are held by reference and must outlive the expression.
+    *    The expression is meant to be evaluated in the statement which
+    *    builds it.</p>
+    */
+   template<class E> class SlipExpr {
+      E e;
+   public:
+      SlipExpr(const E& e) : e(e) { }
+      const E&  node() const { return e; }
+      SlipDatum eval() const {                                                  // evaluate the expression
+         SlipExprNum Y;
+         return (e.num(Y))? Y.datum(): e.datum();
+      }; // SlipDatum eval() const
+      operator SlipDatum() const { return eval(); }
+      SlipExpr<SlipExprUnary<'-', E> > operator-() const { return SlipExprUnary<'-', E>(e); }
+      SlipExpr<SlipExprUnary<'+', E> > operator+() const { return SlipExprUnary<'+', E>(e); }
+   }; // template<class E> class SlipExpr
+
+   /**
+    * @brief Start an expression with a SlipDatum operand.
+    */
+   inline SlipExpr<SlipExprLeaf> slipExpr(const SlipDatum& X) { return SlipExprLeaf(X); }
+
+   template<class T> struct SlipExprArg;                                        // Operand to expression node
+   template<class E> struct SlipExprArg<SlipExpr<E> > {
+      typedef E node;
+      static const E& get(const SlipExpr<E>& X) { return X.node(); }
+   }; // template<class E> struct SlipExprArg<SlipExpr<E> >
+   template<> struct SlipExprArg<SlipDatum> {
+      typedef SlipExprLeaf node;
+      static SlipExprLeaf get(const SlipDatum& X) { return SlipExprLeaf(X); }
+   }; // template<> struct SlipExprArg<SlipDatum>
+   template<class T> struct SlipExprArg {
+      typedef SlipExprConst node;
+      static SlipExprConst get(T X) { return SlipExprConst(X); }
+   }; // template<class T> struct SlipExprArg
+
+# define SLIPEXPR_BINARY(op, OP)                                                \
+   template<class L, class R>                                                   \
+   SlipExpr<SlipExprBinary<OP, L, R> >                                          \
+   operator op(const SlipExpr<L>& Y, const SlipExpr<R>& X) {                    \
+      return SlipExprBinary<OP, L, R>(Y.node(), X.node());                      \
+   }                                                                            \
+   template<class L, class T>                                                   \
+   SlipExpr<SlipExprBinary<OP, L, typename SlipExprArg<T>::node> >              \
+   operator op(const SlipExpr<L>& Y, const T& X) {                              \
+      return SlipExprBinary<OP, L, typename SlipExprArg<T>::node>               \
+                           (Y.node(), SlipExprArg<T>::get(X));                  \
+   }                                                                            \
+   template<class T, class R>                                                   \
+   SlipExpr<SlipExprBinary<OP, typename SlipExprArg<T>::node, R> >              \
+   operator op(const T& Y, const SlipExpr<R>& X) {                              \
+      return SlipExprBinary<OP, typename SlipExprArg<T>::node, R>               \
+                           (SlipExprArg<T>::get(Y), X.node());                  \
+   }
+
+   SLIPEXPR_BINARY(+, '+')
+   SLIPEXPR_BINARY(-, '-')
+   SLIPEXPR_BINARY(*, '*')
+   SLIPEXPR_BINARY(/, '/')
+   SLIPEXPR_BINARY(%, '%')
+
+# undef SLIPEXPR_BINARY
+
+}; // namespace slip
+
+#endif	/* _SLIPEXPR_H */
@@ -36,6 +36,7 @@
 # include "SlipPtrOp.h"
 # include "SlipReaderOp.h"
 # include "SlipStringOp.h"
+# include "SlipStringInlineOp.h"
 # include "SlipSublistOp.h"
 # include "SlipUndefinedOp.h"
 # include "SlipUnsignedCharOp.h"
@@ -116,6 +117,7 @@ namespace slip {
    const void* ptrOP          = (void*) new SlipPtrOp();
    const void* readerOP       = (void*) new SlipReaderOp();
    const void* stringOP       = (void*) new SlipStringOp();
+   const void* stringInlineOP = (void*) new SlipStringInlineOp();
    const void* sublistOP      = (void*) new SlipSublistOp();
    const void* undefinedOP    = (void*) new SlipUndefinedOp();
    const void* ucharOP        = (void*) new SlipUnsignedCharOp();
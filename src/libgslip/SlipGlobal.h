@@ -115,6 +115,7 @@ extern const void* longOP;                     //= new SlipLongOp();
 extern const void* ptrOP;                      //= new SlipPtrOp();
 extern const void* readerOP;                   //= new SlipReaderOp();
 extern const void* stringOP;                   //= new SlipStringOp();
+extern const void* stringInlineOP;             //= new SlipStringInlineOp();
 extern const void* sublistOP;                  //= new SlipSublistOp();
 extern const void* undefinedOP;                //= new SlipUndefinedOp();
 extern const void* ucharOP;                    //= new SlipUnsignedCharOp();
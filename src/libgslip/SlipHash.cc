@@ -175,7 +175,7 @@ namespace slip {
     * @return ReturnTuple containing the hash table index, return condition and entry
     */
    SlipHash::ReturnTuple SlipHash::insert(SlipHashEntry& entry) {
-      static int activeFlag = false;
+      static thread_local int activeFlag = false;                               // per thread, reads run concurrently
       ReturnTuple::CONDITION condition = ReturnTuple::FOUND;
       DEBUG(inputDebugFlag,
       cout << left << setw(27) << setfill(' ') << "SlipHash::insert" << entry.toString() << endl;)
@@ -395,7 +395,7 @@ namespace slip {
     * @return <b>true</b> rebuild successful <b>false</b> rebuild failed
     */
    bool SlipHash::rebuild() {
-      static bool activeFlag = false;
+      static thread_local bool activeFlag = false;                              // per thread, reads run concurrently
       bool retval = true;
       DEBUG(hashDebugFlag,
       cout << setw(30) << "SlipHash::rebuild()"
@@ -32,12 +32,19 @@
 # include <fstream>
 # include <iostream>
 # include <cmath>
+# include <cstring>
 # include <ostream>
 # include <sstream>
+# include <streambuf>
 # include <iomanip>
 # include <iostream>
 # include <string>
+# include <mutex>
+# include <atomic>
+# include <unordered_map>
+# include <vector>
 # include "SlipCellBase.h"
+# include "SlipDatum.h"
 # include "SlipDef.h"
 # include "SlipGlobal.h"
 # include "SlipErr.h"
@@ -45,8 +52,10 @@
 # include "SlipOp.h"
 # include "SlipReader.h"
 # include "SlipSequencer.h"
+# include "SlipStringOp.h"
 # include "SlipSublist.h"
 # include "SlipWrite.h"
+# include "SlipWriteBinary.h"
 
 using namespace std;
 
@@ -55,6 +64,204 @@ namespace slip {
    const int    HEADERMIN =  20;                                       // Minimum columns on existing line for new sublist
    const int    NORMALMIN =  11;                                       // Minimum columns on existing line for entry
    const USHORT VISITMASK = 0x8000;                                    // List visit mask
+   const ULONG  DLISTINDEXSIZE = 8;                                    // Descriptor List pairs before a hash index is built
+   const unsigned REDUCEBLOCK = 256;                                   // Cells copied to a buffer for a reduction
+
+   /**
+    * @brief Hash index of a Descriptor List.
+    * <p>Keys and values are hashed separately. Each entry holds the cell in
+    *    the Descriptor List and the position of its pair, a smaller position
+    *    is nearer the list top. Equal cells found in a search are resolved
+    *    to the one nearest the top, as a walk of the list would find.</p>
+    * <p>The index is valid while the Descriptor List header count is
+    *    <em>COUNTINDEXED</em>. Any change to the list makes the count unknown
+    *    and the index is rebuilt on the next search. A key or value changed
+    *    in place, by assignment or <em>replace</em>, is found through
+    *    <em>dListCells</em> and makes the count unknown in the same way.</p>
+    */
+   struct DListIndex {
+      struct Entry {
+         SlipCell* cell;                                               //!< key or value cell in the Descriptor List
+         LONG      pos;                                                //!< position of the pair in the list
+      };
+      typedef unordered_multimap<size_t, Entry> Map;
+      ULONG cells;                                                     //!< number of cells in the Descriptor List
+      LONG  top;                                                       //!< position of the top pair
+      bool  keysOK;                                                    //!< <b>true</b> all keys are in keys
+      bool  valuesOK;                                                  //!< <b>true</b> all values are in values
+      Map   keys;                                                      //!< hashed keys
+      Map   values;                                                    //!< hashed values
+      vector<const SlipCellBase*> members;                             //!< cells entered in dListCells
+   };
+
+   static mutex                                           dListLock;   //!< Guards the Descriptor List indexes
+   static unordered_map<const SlipHeader*, DListIndex*>   dListIndexes;//!< Descriptor List header to its index
+   static unordered_map<const SlipCellBase*, const SlipHeader*> dListCells; //!< indexed Descriptor List cell to its header
+
+   /**
+    * @brief Hash a Descriptor List key or value.
+    * <p>The hash agrees with <em>operator==</em>: cells which compare equal
+    *    have equal hashes. Numeric cells are hashed by their DOUBLE value,
+    *    strings by the string value, sublists and headers by the list header
+    *    address. A cell which can not be hashed this way (PTR, ULONG values
+    *    which compare equal to a negative LONG, and others) returns
+    *    <b>false</b> and is searched for by a walk of the list.</p>
+    * @param[in] X (SlipCell&) key or value
+    * @param[out] hash hash of X
+    * @return <b>true</b> if X is hashed
+    */
+   static bool dListHash(SlipCell& X, size_t& hash) {                 // Hash a Descriptor List key or value
+      DOUBLE num;
+      switch(X.getClassType()) {
+         case eBOOL:
+         case eCHAR:
+         case eUCHAR:
+         case eLONG:
+         case eDOUBLE:
+            num = (DOUBLE)(SlipDatum&)X;
+            hash = std::hash<DOUBLE>()((num == 0)? 0: num);
+            return true;
+         case eULONG:
+            if ((ULONG)(SlipDatum&)X > (ULONG)(~(ULONG)0 >> 1)) return false;
+            hash = std::hash<DOUBLE>()((DOUBLE)(ULONG)(SlipDatum&)X);
+            return true;
+         case eSTRING:
+            hash = SlipStringOp::hash((SlipDatum&)X);
+            return true;
+         case eSUBLIST:
+            hash = std::hash<const void*>()(&((SlipSublist&)X).getHeader());
+            return true;
+         case eHEADER:
+            hash = std::hash<const void*>()(&X);
+            return true;
+         default:
+            return false;
+      }
+   }; // static bool dListHash(SlipCell& X, size_t& hash)
+
+   /**
+    * @brief Sum of a buffer of numbers.
+    * <p>Four partial sums are kept so that the loop can be vectorized. For
+    *    an integer type the result is exact (modulo the type size). For a
+    *    DOUBLE the order of additions differs from a walk of the list.</p>
+    * @param[in] buffer numbers
+    * @param[in] n number of numbers
+    * @return sum of the numbers
+    */
+   template<class T> static T reduceSum(const T* buffer, unsigned n) {
+      T acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+      unsigned i = 0;
+      for (; i + 4 <= n; i += 4) {
+         acc0 += buffer[i];
+         acc1 += buffer[i + 1];
+         acc2 += buffer[i + 2];
+         acc3 += buffer[i + 3];
+      }
+      for (; i < n; i++) acc0 += buffer[i];
+      return (acc0 + acc1) + (acc2 + acc3);
+   }; // template<class T> static T reduceSum(const T* buffer, unsigned n)
+
+   /**
+    * @brief Sum of the products of two buffers of numbers.
+    * @param[in] X numbers
+    * @param[in] Y numbers
+    * @param[in] n number of numbers in each buffer
+    * @return sum of X[i]*Y[i]
+    */
+   static DOUBLE reduceDot(const DOUBLE* X, const DOUBLE* Y, unsigned n) {
+      DOUBLE acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+      unsigned i = 0;
+      for (; i + 4 <= n; i += 4) {
+         acc0 += X[i]     * Y[i];
+         acc1 += X[i + 1] * Y[i + 1];
+         acc2 += X[i + 2] * Y[i + 2];
+         acc3 += X[i + 3] * Y[i + 3];
+      }
+      for (; i < n; i++) acc0 += X[i] * Y[i];
+      return (acc0 + acc1) + (acc2 + acc3);
+   }; // static DOUBLE reduceDot(const DOUBLE* X, const DOUBLE* Y, unsigned n)
+
+   /**
+    * @brief Smallest and largest number in a buffer.
+    * @param[in] buffer numbers
+    * @param[in] n number of numbers
+    * @param[in,out] min smallest number
+    * @param[in,out] max largest number
+    */
+   static void reduceMinMax(const DOUBLE* buffer, unsigned n, DOUBLE& min, DOUBLE& max) {
+      DOUBLE lo = min, hi = max;
+      for (unsigned i = 0; i < n; i++) {
+         lo = (buffer[i] < lo)? buffer[i]: lo;
+         hi = (buffer[i] > hi)? buffer[i]: hi;
+      }
+      min = lo;
+      max = hi;
+   }; // static void reduceMinMax(const DOUBLE* buffer, unsigned n, DOUBLE& min, DOUBLE& max)
+
+   /**
+    * @brief Add a Descriptor List key or value to an index map.
+    * @param[in,out] map key or value map
+    * @param[in,out] ok <b>false</b> when the map is not usable
+    * @param[in] cell key or value cell in the Descriptor List
+    * @param[in] pos position of the pair in the list
+    */
+   static void dListInsert(DListIndex::Map& map, bool& ok, SlipCell* cell, LONG pos) {
+      size_t hash;
+      if (!ok) return;
+      if (dListHash(*cell, hash)) {
+         DListIndex::Entry entry = { cell, pos };
+         map.insert(make_pair(hash, entry));
+      } else {
+         ok = false;
+         map.clear();
+      }
+   }; // static void dListInsert(DListIndex::Map& map, bool& ok, SlipCell* cell, LONG pos)
+
+   /**
+    * @brief Enter a key and value cell of an indexed Descriptor List.
+    * @param[in,out] index Descriptor List index
+    * @param[in] dList Descriptor List header
+    * @param[in] key key cell
+    * @param[in] value value cell
+    */
+   static void dListEnter(DListIndex& index, const SlipHeader* dList, const SlipCellBase* key, const SlipCellBase* value) {
+      dListCells[key]   = dList;
+      dListCells[value] = dList;
+      index.members.push_back(key);
+      index.members.push_back(value);
+   }; // static void dListEnter(DListIndex& index, const SlipHeader* dList, const SlipCellBase* key, const SlipCellBase* value)
+
+   /**
+    * @brief Remove the cells of an index from dListCells.
+    * <p>A cell which has since been entered for another Descriptor List is
+    *    left alone.</p>
+    * @param[in,out] index Descriptor List index
+    * @param[in] dList Descriptor List header
+    */
+   static void dListForget(DListIndex& index, const SlipHeader* dList) {
+      for (const SlipCellBase* cell : index.members) {
+         auto it = dListCells.find(cell);
+         if ((it != dListCells.end()) && (it->second == dList)) dListCells.erase(it);
+      }
+      index.members.clear();
+   }; // static void dListForget(DListIndex& index, const SlipHeader* dList)
+
+   /**
+    * @brief Remove a Descriptor List key or value from an index map.
+    * @param[in,out] map key or value map
+    * @param[in] cell key or value cell in the Descriptor List
+    */
+   static void dListErase(DListIndex::Map& map, SlipCell* cell) {
+      size_t hash;
+      if (!dListHash(*cell, hash)) return;
+      auto range = map.equal_range(hash);
+      for (auto it = range.first; it != range.second; ++it) {
+         if (it->second.cell == cell) {
+            map.erase(it);
+            return;
+         }
+      }
+   }; // static void dListErase(DListIndex::Map& map, SlipCell* cell)
 
    /**
     * @brief Construct a header
@@ -88,6 +295,7 @@ namespace slip {
        setOperator((void*)headOP);
        putMark(0);
        *(getHeadRefCnt()) = (refCnt)? 1: 0;
+       *(getHeadCount())  = COUNTUNKNOWN;
      }
    }; // void SlipHeader::constructHeader(ULONG refCnt)
 
@@ -114,6 +322,8 @@ namespace slip {
             postError(__FILE__, __LINE__, SlipErr::E2010, "SlipHeader::deleteHeader", "", "Header left link and right link are null.", *this);
          } else {
             if (isDList()) getDList().deleteList();
+            countRelease();
+            dListIndexDrop(this);
             addAVSLCells( this              // pointer to first cell
                         , getLeftLink());  // pointer to last cell
          }
@@ -121,6 +331,148 @@ namespace slip {
          *(getHeadRefCnt()) -= 1;
    }; // void SlipHeader::deleteHeader()
 
+   /**
+    * @brief Find a key or value in the Descriptor List.
+    * <p>The search uses the Descriptor List index when X can be hashed and
+    *    the list is large enough to have one, otherwise the list is walked.
+    *    The Descriptor List must exist.</p>
+    * @param[in] X (SlipCell&) search key or value
+    * @param[in] key <b>true</b> search the keys, <b>false</b> the values
+    * @return the first matching key or value cell or NULL
+    */
+   SlipCell* SlipHeader::dListFind(SlipCell& X, bool key) {           // Find a Descriptor List key or value
+      SlipHeader* dList = *(SlipHeader**)getHeadDescList();
+      size_t hash;
+      if (dListHash(X, hash)) {
+         lock_guard<mutex> guard(dListLock);
+         DListIndex* index = dListIndex(*dList);
+         if ((index != NULL) && (key? index->keysOK: index->valuesOK)) {
+            SlipCell* cell = NULL;
+            LONG      pos  = 0;
+            auto range = (key? index->keys: index->values).equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it) {
+               if (((cell == NULL) || (it->second.pos < pos)) && (*it->second.cell == X)) {
+                  cell = it->second.cell;
+                  pos  = it->second.pos;
+               }
+            }
+            return cell;
+         }
+      }
+      for (SlipCellBase* link = dList->getRightLink(); !link->isHeader(); ) {
+         SlipCellBase* value = link->getRightLink();
+         if (value->isHeader()) break;
+         SlipCell& cell = *(SlipCell*)((key)? link: value);
+         if (cell == X) return &cell;
+         link = value->getRightLink();
+      }
+      return NULL;
+   }; // SlipCell* SlipHeader::dListFind(SlipCell& X, bool key)
+
+   /**
+    * @brief Return a valid index for a Descriptor List.
+    * <p>The index is rebuilt if the Descriptor List has changed since it was
+    *    built. A Descriptor List with fewer than DLISTINDEXSIZE pairs, or with
+    *    an odd number of cells, has no index. Must be called with the index
+    *    lock held.</p>
+    * @param[in] dList (SlipHeader&) Descriptor List header
+    * @return the index or NULL
+    */
+   DListIndex* SlipHeader::dListIndex(SlipHeader& dList) {            // Validate or build a Descriptor List index
+      auto it = dListIndexes.find(&dList);
+      DListIndex* index = (it == dListIndexes.end())? NULL: it->second;
+      if ((index != NULL) && (dList.countGet() == COUNTINDEXED)) return index;
+      ULONG cells = dList.sizeWalk();
+      if (index != NULL) dListForget(*index, &dList);
+      if ((cells < 2 * DLISTINDEXSIZE) || ((cells % 2) != 0)) {
+         if (index != NULL) {
+            delete index;
+            dListIndexes.erase(it);
+         }
+         return NULL;
+      }
+      if (index == NULL) {
+         index = new DListIndex();
+         dListIndexes[&dList] = index;
+         dListChange = &SlipHeader::dListIndexChange;
+         dListIndexed.store(true, memory_order_release);
+      }
+      index->cells    = cells;
+      index->top      = 0;
+      index->keysOK   = true;
+      index->valuesOK = true;
+      index->keys.clear();
+      index->values.clear();
+      LONG pos = 0;
+      for (SlipCellBase* link = dList.getRightLink(); !link->isHeader(); pos++) {
+         SlipCell* value = (SlipCell*)link->getRightLink();
+         dListInsert(index->keys, index->keysOK, (SlipCell*)link, pos);
+         dListInsert(index->values, index->valuesOK, value, pos);
+         dListEnter(*index, &dList, link, value);
+         link = value->getRightLink();
+      }
+      dList.countPut(COUNTINDEXED);
+      return index;
+   }; // DListIndex* SlipHeader::dListIndex(SlipHeader& dList)
+
+   /**
+    * @brief Discard the index of a deleted Descriptor List.
+    * @param[in] dList (SlipHeader*) Descriptor List header
+    */
+   void SlipHeader::dListIndexDrop(const SlipHeader* dList) {         // Discard a Descriptor List index
+      if (!dListIndexed.load(memory_order_acquire)) return;
+      lock_guard<mutex> guard(dListLock);
+      auto it = dListIndexes.find(dList);
+      if (it != dListIndexes.end()) {
+         dListForget(*it->second, dList);
+         delete it->second;
+         dListIndexes.erase(it);
+      }
+   }; // void SlipHeader::dListIndexDrop(const SlipHeader* dList)
+
+   /**
+    * @brief Discard the index holding a cell about to be changed in place.
+    * <p>Called before a cell is assigned a new value or replaced in its list.
+    *    If the cell is a key or value of an indexed Descriptor List the list
+    *    count becomes unknown and the index is rebuilt on the next search.</p>
+    * @param[in] cell (SlipCellBase*) changed cell
+    */
+   void SlipHeader::dListIndexChange(const SlipCellBase* cell) {      // Discard the index holding a changed cell
+      lock_guard<mutex> guard(dListLock);
+      auto it = dListCells.find(cell);
+      if (it != dListCells.end()) {
+         const_cast<SlipHeader*>(it->second)->countClear();
+         dListCells.erase(it);
+      }
+   }; // void SlipHeader::dListIndexChange(const SlipCellBase* cell)
+
+   /**
+    * @brief Copy the values of numeric list cells to a buffer.
+    * <p>Cells are copied from <em>link</em> until the list header, a non
+    *    numeric cell or <b>REDUCEBLOCK</b> cells. <em>link</em> is left at the
+    *    first cell not copied.</p>
+    * @param[in,out] link first cell to copy
+    * @param[out] buffer cell values
+    * @param[out] numeric <b>false</b> if the copy stopped at a non numeric cell
+    * @return number of cells copied
+    */
+   unsigned SlipHeader::gather(const SlipCellBase*& link, DOUBLE* buffer, bool& numeric) { // Copy numeric cells to a buffer
+      unsigned n = 0;
+      numeric = true;
+      for (; (n < REDUCEBLOCK) && !link->isHeader(); link = link->getRightLink()) {
+         switch(link->getClassType()) {
+            case eBOOL:   buffer[n++] = *getBool(*link);   break;
+            case eCHAR:   buffer[n++] = *getChar(*link);   break;
+            case eUCHAR:  buffer[n++] = *getUChar(*link);  break;
+            case eLONG:   buffer[n++] = *getLong(*link);   break;
+            case eULONG:  buffer[n++] = *getULong(*link);  break;
+            case eDOUBLE: buffer[n++] = *getDouble(*link); break;
+            default:      numeric = false;                 return n;
+         }
+      }
+      return n;
+   }; // unsigned SlipHeader::gather(const SlipCellBase*& link, DOUBLE* buffer, bool& numeric)
+
    /**
     * @brief Create a copy of the current list.
     * <p>A new SlipHeader object is created and points to a copy of the original
@@ -169,7 +521,7 @@ namespace slip {
 
    /**
     * @brief <b>delete header</b> is illegal.
-    * <p>A <b>delete header</b> is trapped by the SlipHeader destructor. When
+    * <p>A <b>delete header</b> is trapped by <em>~SlipCellBase</em>. When
     *    the trap is triggered, an diagnostic message is output.</p>
     * <p>Using <b>delte header</b> instead of <b>header.deleteList()</b>
     *    causes the list identity to be immediately erased. If there are any
@@ -180,9 +532,9 @@ namespace slip {
     *    <li><b>E3024</b> Delete header is illegal. header.deleteList() must be used.</li>
     * </ul>
     */
-   SlipHeader::~SlipHeader() {                                         // ~SlipHeader() destructor
+   void SlipHeader::release() {                                        // trap delete header
       postError(__FILE__, __LINE__, SlipErr::E3024, "SlipHeader::~SlipHeader", "", "", *this);
-   }; // SlipHeader::~SlipHeader()
+   }; // void SlipHeader::release()
 
 
             /*****************************************
@@ -264,6 +616,8 @@ namespace slip {
     * <ul>
     *    <li><b>E2038</b> Header required. Missing Descriptor List.</li>
     * </ul>
+    * <p>A Descriptor List of DLISTINDEXSIZE or more pairs is searched through
+    *    the hash index of its values.</p>
     * @param[in] value (SlipCell) search value
     * @return <b>true</b> if the value is found
     */
@@ -273,13 +627,7 @@ namespace slip {
       if (dList == NULL) {
          postError(__FILE__, __LINE__, SlipErr::E2038, "SlipHeader::contains", "Missing Descriptor List. ", "", *this);
       } else {
-         SlipCellBase* link     = dList->getRightLink();
-         for (; !link->isHeader(); link = link->getRightLink()) {
-            link = link->getRightLink();
-            SlipCell& cell = *(SlipCell*)link;
-            flag  = (cell == value);
-            if (flag) break;
-         }
+         flag = (dListFind(value, false) != NULL);
       }
       return flag;
    }; // bool SlipHeader::contains(SlipCell& value)
@@ -301,6 +649,8 @@ namespace slip {
     * <ul>
     *    <li><b>E2038</b> Header required. Missing Descriptor List.</li>
     * </ul>
+    * <p>A Descriptor List of DLISTINDEXSIZE or more pairs is searched through
+    *    the hash index of its keys.</p>
     * @param[in] key (SlipCell&) object containing the search key
     * @return <b>true</b> if the key is found
     */
@@ -310,13 +660,7 @@ namespace slip {
       if (dList == NULL) {
          postError(__FILE__, __LINE__, SlipErr::E2038, "SlipHeader::containsKey", "Missing Descriptor List. ", "", *this);
       } else {
-         SlipCellBase* link     = dList->getRightLink();
-         for (; !link->isHeader(); link = link->getRightLink()) {
-            SlipCell& cell = *(SlipCell*)link;
-            flag  = (cell == key);
-            if (flag) break;
-            link = link->getRightLink();
-         }
+         flag = (dListFind(key, true) != NULL);
       }
       return flag;
    }; // SlipHeader::constainsKey(SlipCell& key)
@@ -359,6 +703,7 @@ namespace slip {
     * <ul>
     *    <li><b>E2038</b> Header required. Missing Descriptor List.</li>
     * </ul>
+    * <p>The key and value are removed from the Descriptor List index.</p>
     * @param[in] key (SlipCell&) object containing the search key
     */
    bool SlipHeader::deleteAttribute(SlipCell& key) {                   // delete attribute and value from list
@@ -368,16 +713,27 @@ namespace slip {
          postError(__FILE__, __LINE__, SlipErr::E2038, "SlipHeader::deleteAttribute", "Missing Descriptor List. ", "", *this);
       } else {
          if (dList->isEmpty()) return flag;
-         SlipCell* link = (SlipCell*)dList->getRightLink();
-         while(!(link->isHeader()) && (*link != key)) {
-            link = (SlipCell*)(link->getRightLink())->getRightLink();
-         }
-         if ((!link->isHeader())) {
+         SlipCell* link = dListFind(key, true);
+         if (link != NULL) {
             flag = true;
-            SlipCell& value = ((SlipCell*)link->getRightLink())->unLink();
-            SlipCell& dCell = link->unLink();
-            delete &value;
-            delete &dCell;
+            SlipCell* valueCell = (SlipCell*)link->getRightLink();
+            {
+               lock_guard<mutex> guard(dListLock);
+               auto it = dListIndexes.find(dList);
+               DListIndex* index = ((it != dListIndexes.end()) && (dList->countGet() == COUNTINDEXED))? it->second: NULL;
+               valueCell->unLink();
+               link->unLink();
+               if (index != NULL) {
+                  dListErase(index->keys, link);
+                  dListErase(index->values, valueCell);
+                  dListCells.erase(link);
+                  dListCells.erase(valueCell);
+                  index->cells -= 2;
+                  dList->countPut(COUNTINDEXED);
+               }
+            }
+            delete valueCell;
+            delete link;
          }
       }
       return flag;
@@ -449,6 +805,8 @@ namespace slip {
     * <ul>
     *    <li><b>E2038</b> Header required. Missing Descriptor List.</li>
     * </ul>
+    * <p>The key is found in constant time through the Descriptor List index
+    *    once the list has DLISTINDEXSIZE or more pairs.</p>
     * @param[in] key (SlipCell&) search key
     * @return reference to the associated value or reference to the key
     */
@@ -457,11 +815,8 @@ namespace slip {
       if (dList == NULL) {
          postError(__FILE__, __LINE__, SlipErr::E2038, "SlipHeader::get", "Missing Descriptor List. ", "", *this);
       } else {
-         SlipCellBase* link     = dList->getRightLink();
-         for (; !link->isHeader(); link->getRightLink()) {
-            if (*(SlipCell*)link == key) return *(SlipCell*)link->getRightLink();
-            link->getRightLink();
-         }
+         SlipCell* link = dListFind(key, true);
+         if (link != NULL) return *(SlipCell*)link->getRightLink();
       }
       return key;
    }; // SlipCell& SlipHeader::get(SlipCell& cell)
@@ -509,6 +864,8 @@ namespace slip {
 
    /**
     * @brief Insert a new $lt;key value&gt; pair into the Description List
+    * <p>The pair is pushed on the Description List top and added to the
+    *    Descriptor List index, if there is one.</p>
     * @param[in] key (SlipCell&) to be inserted
     * @param[in] value (SlipCell&) value to be inserted
     * @return reference to the header
@@ -518,16 +875,28 @@ namespace slip {
       if (dList == NULL) {
         postError(__FILE__, __LINE__, SlipErr::E2038, "SlipHeader::put", "Missing Descriptor List. ", "", *this);
       } else if (!containsKey(key)) {
+         lock_guard<mutex> guard(dListLock);
+         auto it = dListIndexes.find(dList);
+         DListIndex* index = ((it != dListIndexes.end()) && (dList->countGet() == COUNTINDEXED))? it->second: NULL;
          dList->push(value);
          dList->push(key);
+         if (index != NULL) {
+            SlipCell* keyCell = &dList->getTop();
+            LONG      pos     = --index->top;
+            dListInsert(index->keys, index->keysOK, keyCell, pos);
+            dListInsert(index->values, index->valuesOK, (SlipCell*)keyCell->getRightLink(), pos);
+            dListEnter(*index, dList, keyCell, keyCell->getRightLink());
+            index->cells += 2;
+            dList->countPut(COUNTINDEXED);
+         }
       }
       return *this;
    }; // SlipCell& SlipHeader::put(SlipCell& key, SlipCell& value)
 
    /**
     * @brief Return the number of &lt;key value&gt; pairs
-    * <p>Count the number of pairs in the Description List. This method isn't
-    *    the fastest in the world, but it is the fastest that can be made.</p>
+    * <p>Count the number of pairs in the Description List. The count is the
+    *    kept cell count of the Description List, see <em>size()</em>.</p>
     * @return the number number of &lt;key value&gt; pairs
     */
    unsigned SlipHeader::size_dList() {                                 // number of <key, value> pairs
@@ -536,8 +905,7 @@ namespace slip {
      if (dList == NULL) {
          postError(__FILE__, __LINE__, SlipErr::E2038, "SlipHeader::size_dList", "Missing Descriptor List. ", "", *this);
       } else {
-         SlipCellBase* link     = dList->getRightLink();
-         for (; !link->isHeader(); link = link->getRightLink()) count++;
+         count = dList->size();
       }
       return count/2;
    }; // unsigned SlipHeader::size_dList()
@@ -575,6 +943,7 @@ namespace slip {
          setLeftLink(cell->getRightLink(), cell->getLeftLink());
          setLeftLink(cell, NULL);
          setRightLink(cell, NULL);
+         countAdd(-1);
       }
       return (SlipCell&)*cell;
    }; // SlipCell& SlipHeader::dequeue()
@@ -731,6 +1100,7 @@ namespace slip {
          addAVSLCells(&getTop(), &getBot());                           // delete cells
          setLeftLink(this);
          setRightLink(this);
+         countEmpty();
       }
        return *this;
    }; // SlipCell& SlipHeader::flush()
@@ -800,6 +1170,7 @@ namespace slip {
          setRightLink(cell->getLeftLink(), cell->getRightLink());
          setLeftLink(cell, NULL);
          setRightLink(cell, NULL);
+         countAdd(-1);
       }
       return (SlipCell&)*cell;
    }; // SlipCell& SlipHeader::pop()
@@ -1521,17 +1892,54 @@ namespace slip {
    }; // SlipCell& SlipHeader::replaceTop(const string* X, bool constFlag)
 
    /**
-    * @brief Return the number of cells in the list.
-    * <p>The list cells counted only include the cell in the top level. Sublists
-    *    are not counted,</p>
+    * @brief Return the number of cells in the list by a walk of the list.
     * @return number of cells in the list
     */
-   unsigned SlipHeader::size() const {                                 // Number of cells in list
+   unsigned SlipHeader::sizeWalk() const {                             // Number of cells in list
       unsigned count = 0;
+      loadList(const_cast<SlipHeader*>(this));
       SlipCellBase* link = this->getRightLink();
       if (!(link == NULL) || (link == UNDEFDATA))
          for(; !link->isHeader(); link = link->getRightLink()) count++;
       return count;
+   }; // unsigned SlipHeader::sizeWalk()
+
+   /**
+    * @brief Return the number of cells in the list.
+    * <p>The list cells counted only include the cell in the top level. Sublists
+    *    are not counted,</p>
+    * <p>The count is kept in the header. Insertion and removal at a list end
+    *    and through the header (push, enqueue, pop, dequeue, flush,
+    *    moveListLeft, moveListRight) keep the count. A split of the list, or
+    *    an insertion or removal between two list cells, where the header is
+    *    not known, makes the count unknown. An unknown count is found by a
+    *    walk of the list and kept until the next such change.</p>
+    * <p>With <b>SLIP_DEBUG_COUNT</b> defined a kept count is checked against
+    *    a walk of the list.</p>
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3027</b> List cell count does not match the list.</li>
+    * </ul>
+    * @return number of cells in the list
+    */
+   unsigned SlipHeader::size() const {                                 // Number of cells in list
+      loadList(const_cast<SlipHeader*>(this));
+      ULONG count = countGet();
+      if (count == COUNTINDEXED) {
+         lock_guard<mutex> guard(dListLock);
+         auto it = dListIndexes.find(this);
+         count = ((it != dListIndexes.end()) && (countGet() == COUNTINDEXED))? it->second->cells: COUNTUNKNOWN;
+      }
+      if (count == COUNTUNKNOWN) {
+         count = sizeWalk();
+         const_cast<SlipHeader*>(this)->countPut(count);
+      }
+# ifdef SLIP_DEBUG_COUNT
+      else if (count != sizeWalk()) {
+         postError(__FILE__, __LINE__, SlipErr::E3027, "SlipHeader::size", "", "", *this);
+      }
+# endif
+      return count;
    }; // unsigned SlipHeader::size()
 
    /**
@@ -1570,10 +1978,10 @@ namespace slip {
                setLeftLink(&getTop(), header);
 
                setRightLink(X.getRightLink());
-               setLeftLink(getBot().getRightLink());
 
                setLeftLink(X.getRightLink(), this);
                setRightLink(&X, header);
+               countClear();
             }
          }
       }
@@ -1620,6 +2028,7 @@ namespace slip {
                setLeftLink(X.getLeftLink());
 
                setLeftLink(&X, header);
+               countClear();
             }
          }
       }
@@ -1691,6 +2100,7 @@ namespace slip {
          flush();
          SlipHeader* to = this;
          SlipHeader* from = const_cast<SlipHeader*>(&X);
+         loadList(from);
          to->putMark(from->getMark());
          SlipCellBase* cell = from->getRightLink();
          for(; !cell->isHeader(); cell = cell->getRightLink())
@@ -1714,6 +2124,7 @@ namespace slip {
          while(from->isDList()) {
             to->create_dList();
             from = &from->getDList();
+            loadList(from);
             cell = from->getRightLink();
             if (cell->isHeader()) break;
             to = &(to->getDList());
@@ -1885,6 +2296,161 @@ namespace slip {
    bool SlipHeader::operator==(const SlipHeader& X) { return (this == &X);}     // Y == X
 
 
+            /*****************************************
+             *              Reductions               *
+            ******************************************/
+
+   /**
+    * @brief Sum of the products of the cells of two lists.
+    * <p>The n<sup>th</sup> cell of each list is multiplied and the products
+    *    are added as DOUBLE values. Runs of cells are copied to a buffer and
+    *    reduced by a loop which can be vectorized.</p>
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3028</b> List cell is not numeric.</li>
+    *    <li><b>E3029</b> Lists are not the same size.</li>
+    * </ul>
+    * @param[in] X (SlipHeader&) list
+    * @return sum of the products, 0 for empty lists
+    */
+   DOUBLE SlipHeader::dot(const SlipHeader& X) const {                 // Sum of the products of the cells of two lists
+      DOUBLE bufferY[REDUCEBLOCK];
+      DOUBLE bufferX[REDUCEBLOCK];
+      DOUBLE total = 0;
+      bool   numericY = true;
+      bool   numericX = true;
+      const SlipCellBase* linkY = getRightLink();
+      const SlipCellBase* linkX = X.getRightLink();
+      while(!linkY->isHeader() && !linkX->isHeader()) {
+         unsigned nY = gather(linkY, bufferY, numericY);
+         unsigned nX = gather(linkX, bufferX, numericX);
+         total += reduceDot(bufferY, bufferX, (nY < nX)? nY: nX);
+         const SlipCellBase* stop = (nY < nX)? linkY: (nX < nY)? linkX
+                                  : (!numericY)? linkY: (!numericX)? linkX: NULL;
+         if (stop != NULL) {
+            if (stop->isHeader())
+               postError(__FILE__, __LINE__, SlipErr::E3029, "SlipHeader::dot", "", "", *this, X);
+            else
+               postError(__FILE__, __LINE__, SlipErr::E3028, "SlipHeader::dot", "", "", *stop);
+            return total;
+         }
+      }
+      if (!linkY->isHeader() || !linkX->isHeader())
+         postError(__FILE__, __LINE__, SlipErr::E3029, "SlipHeader::dot", "", "", *this, X);
+      return total;
+   }; // DOUBLE SlipHeader::dot(const SlipHeader& X) const
+
+   /**
+    * @brief Mean of the list cells.
+    * <p>The cells are added as DOUBLE values and divided by the number of
+    *    cells.</p>
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3028</b> List cell is not numeric.</li>
+    * </ul>
+    * @return mean of the cells, NAN for an empty list
+    */
+   DOUBLE SlipHeader::mean() const {                                   // Mean of the list cells
+      DOUBLE buffer[REDUCEBLOCK];
+      DOUBLE total = 0;
+      ULONG  count = 0;
+      bool   numeric = true;
+      const SlipCellBase* link = getRightLink();
+      while(numeric && !link->isHeader()) {
+         unsigned n = gather(link, buffer, numeric);
+         total += reduceSum(buffer, n);
+         count += n;
+      }
+      if (!numeric) {
+         postError(__FILE__, __LINE__, SlipErr::E3028, "SlipHeader::mean", "", "", *link);
+         return NAN;
+      }
+      return (count == 0)? NAN: total / count;
+   }; // DOUBLE SlipHeader::mean() const
+
+   /**
+    * @brief Smallest and largest list cell.
+    * <p>The cells are compared as DOUBLE values.</p>
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3028</b> List cell is not numeric.</li>
+    * </ul>
+    * @param[out] min smallest cell value
+    * @param[out] max largest cell value
+    * @return <b>false</b> if the list is empty or a cell is not numeric
+    */
+   bool SlipHeader::minmax(DOUBLE& min, DOUBLE& max) const {           // Smallest and largest list cell
+      DOUBLE buffer[REDUCEBLOCK];
+      bool   numeric = true;
+      const SlipCellBase* link = getRightLink();
+      if (link->isHeader()) return false;
+      min = INFINITY;
+      max = -INFINITY;
+      while(numeric && !link->isHeader()) {
+         unsigned n = gather(link, buffer, numeric);
+         reduceMinMax(buffer, n, min, max);
+      }
+      if (!numeric) {
+         postError(__FILE__, __LINE__, SlipErr::E3028, "SlipHeader::minmax", "", "", *link);
+         return false;
+      }
+      return true;
+   }; // bool SlipHeader::minmax(DOUBLE& min, DOUBLE& max) const
+
+   /**
+    * @brief Sum of the list cells.
+    * <p>The result has the type and value of <tt>(LONG)0 + c<sub>1</sub> +
+    *    c<sub>2</sub> + ...</tt> computed with SlipDatum operator+: LONG
+    *    for integer cells, ULONG once a ULONG is added, and DOUBLE once a
+    *    DOUBLE is added. A DOUBLE sum may differ in the last bits because
+    *    the additions are done in a different order.</p>
+    * <p>Numeric cells are copied to a buffer in runs and reduced by a loop
+    *    which can be vectorized, with no SlipOp dispatch. Integer runs are
+    *    added as ULONG values and DOUBLE runs as DOUBLE values. At the first
+    *    cell which is not numeric the remaining cells are added one at a time
+    *    by operator+, which posts the error or calls a user PTR operation.</p>
+    * @return sum of the cells, (LONG)0 for an empty list
+    */
+   SlipDatum SlipHeader::sum() const {                                 // Sum of the list cells
+      ULONG  ibuffer[REDUCEBLOCK];
+      DOUBLE dbuffer[REDUCEBLOCK];
+      ULONG  isum     = 0;
+      DOUBLE dsum     = 0;
+      bool   isULONG  = false;
+      bool   isDOUBLE = false;
+      bool   numeric  = true;
+      const SlipCellBase* link = getRightLink();
+      while(numeric && !isDOUBLE && !link->isHeader()) {
+         unsigned n = 0;
+         for (; (n < REDUCEBLOCK) && !link->isHeader(); link = link->getRightLink()) {
+            ClassType type = link->getClassType();
+            if      (type == eBOOL)  ibuffer[n++] = *getBool(*link);
+            else if (type == eCHAR)  ibuffer[n++] = (ULONG)(LONG)*getChar(*link);
+            else if (type == eUCHAR) ibuffer[n++] = *getUChar(*link);
+            else if (type == eLONG)  ibuffer[n++] = (ULONG)*getLong(*link);
+            else if (type == eULONG) { ibuffer[n++] = *getULong(*link); isULONG = true; }
+            else {
+               isDOUBLE = (type == eDOUBLE);
+               numeric  = isDOUBLE;
+               break;
+            }
+         }
+         isum += reduceSum(ibuffer, n);
+      }
+      if (isDOUBLE) {
+         dsum = (isULONG)? (DOUBLE)isum: (DOUBLE)(LONG)isum;
+         while(numeric && !link->isHeader()) {
+            unsigned n = gather(link, dbuffer, numeric);
+            dsum += reduceSum(dbuffer, n);
+         }
+      }
+      SlipDatum total = (isDOUBLE)? SlipDatum(dsum): (isULONG)? SlipDatum(isum): SlipDatum((LONG)isum);
+      for (; !link->isHeader(); link = link->getRightLink())
+         total = total + (SlipDatum&)*link;
+      return total;
+   }; // SlipDatum SlipHeader::sum() const
+
+
             /*****************************************
              *             Miscellaneous             *
             ******************************************/
@@ -2187,6 +2753,73 @@ namespace slip {
       return retval;
    }; // void SlipHeader::write(string& filename)
 
+   /**
+    * @brief Output the list to a caller provided buffer.
+    * <p>The list is output into the buffer without an intermediate string.
+    *    The returned length is the length of the whole output. If it is
+    *    greater than the buffer length, the buffer holds the first
+    *    <b>length</b> characters and the output can be repeated with a
+    *    larger buffer. The buffer is not terminated with a <b>NUL</b>.</p>
+    * <pre>
+    *    size_t size = list.write(buffer, sizeof(buffer));
+    *    if (size &lt;= sizeof(buffer)) reader.read(buffer, size);
+    * </pre>
+    * @param[out] buffer (char*) output buffer
+    * @param[in] length (size_t) buffer length
+    * @return length of the list output
+    */
+   size_t SlipHeader::write(char* buffer, size_t length) {                      // Output the current list to a buffer
+      class Buffer : public streambuf {
+         size_t lost;                                                           // characters not put in the buffer
+      public:
+         Buffer(char* buffer, size_t length) : lost(0) { setp(buffer, buffer + length); }
+         size_t size() const { return (pptr() - pbase()) + lost; }
+      protected:
+         virtual int_type overflow(int_type c) {
+            if (!traits_type::eq_int_type(c, traits_type::eof())) lost++;
+            return traits_type::not_eof(c);
+         }
+         virtual streamsize xsputn(const char* s, streamsize n) {
+            streamsize room = min(n, (streamsize)(epptr() - pptr()));
+            memcpy(pptr(), s, room);
+            pbump(room);
+            lost += n - room;
+            return n;
+         }
+      }; // class Buffer
+      Buffer  out(buffer, length);
+      ostream stream(&out);
+      SlipWrite write(*this, stream);
+      return out.size();
+   }; // size_t SlipHeader::write(char* buffer, size_t length)
+
+   /**
+    * @brief Output the list in binary form to the user provided stream.
+    * <p>The stream should be opened in binary mode.</p>
+    * @param out (ostream&) output stream
+    * @return <b>true</b> the list was output
+    */
+   bool SlipHeader::writeBinary(ostream& out) {                                 // Output the current list in binary form
+      SlipWriteBinary write(*this, out);
+      return write.getError() == 0;
+   }; // bool SlipHeader::writeBinary(ostream& out)
+
+   /**
+    * @brief Output the list in binary form to a file.
+    * @param filename (string&) output file name
+    * @return <b>true</b> filename was opened and the list was output
+    */
+   bool SlipHeader::writeBinary(string& filename) {                             // Output the current list in binary form
+      ofstream out;
+      out.open(filename.c_str(), ios::trunc | ios::binary);
+      if (!out.is_open()) {
+        postError(__FILE__, __LINE__, SlipErr::E4014, "SlipHeader::writeBinary", filename, "", *this);
+        return false;
+      }
+      SlipWriteBinary write(*this, out);
+      out.close();
+      return write.getError() == 0;
+   }; // bool SlipHeader::writeBinary(string& filename)
 
             /*****************************************
              *             Dump Methods              *
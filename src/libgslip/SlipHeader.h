@@ -35,12 +35,14 @@
 # include <string>
 # include "SlipCell.h"
 # include "SlipGlobal.h"
+# include "SlipIterator.h"
 
 using namespace std;
 
 namespace slip {
    
    class SlipOp;
+   struct DListIndex;
 
 /**
  * @class slip::SlipHeader
@@ -192,6 +194,11 @@ namespace slip {
  *       <li><b>size_dList</b> number of &lt;key value&gt; pairs in the 
  *           Description List.</li>
  *    </ul>
+ *    <p>A Description List with DLISTINDEXSIZE or more pairs is given a hash
+ *       index of its keys and values when it is searched. The list itself is
+ *       unchanged. Any change to the Description List not made by
+ *       <b>put</b> or <b>deleteAttribute</b> discards the index, and it is
+ *       rebuilt by the next search.</p>
  *    <li><b>dequeue</b> remove the last cell on the list.</li>
  *    <li><b>deleteList</b> delete the list. If the reference count is zero,
  *        return the SlipHeader object and all list cells to the AVSL.</li>
@@ -216,7 +223,8 @@ namespace slip {
  *        all cells to the left. This may yield an empty list.</li>
  *    <li><b>splitRight</b> create a new list by splitting the current cell and
  *        all cells to the right. This may yield an empty list.</li>
- *    <li><b>write</b> output a list and preserve list reuse in sublilsts.</li>
+ *    <li><b>write</b> output a list and preserve list reuse in sublilsts.
+ *        The output is to cout, a stream, a file or a caller buffer.</li>
  *    <li><b>writeQuick</b> output a list and do not preserve list reuse in
  *        sublists. The generated list can be input with the following proviso's:</li>
  *       <ul>
@@ -227,6 +235,8 @@ namespace slip {
  *              checking to see if the classes have been declared.</li>
  *       </ul>
  *    <li><b>writeToString</b> direct the output of writeQuick to a string.</li>
+ *    <li><b>writeBinary</b> output a list in binary form, read with
+ *        SlipReadBinary.</li>
  * </ul>
  * <p>Local implementation of methods inherited from SlipCell:</p>
  * <ul>
@@ -241,12 +251,15 @@ namespace slip {
  */
 
    class SlipHeader : public SlipCell {
+      friend class SlipCellBase;
+      friend class SlipCell;
    private:
        /*********************************************************
         *                   Private Functions                   *
        **********************************************************/
          SlipHeader(const SlipHeader& header) { };                              // Copy constructors not allowed
          void   constructHeader(bool refCnt = false);
+         void   release();                                                      // Trap delete header
          
          void   leave(SlipHeader* X);                                           // Exit a list visit
          void   dumpDescriptorList(ostream& out, int& col);                     // Output Descriptor List
@@ -256,14 +269,26 @@ namespace slip {
          static void writeQuick(ostream& out, SlipHeader& list, int& col);      // Output the current list - quickly
          static bool isVisited(const SlipHeader& X);                            // Has a list been visited
 
+         SlipCell*   dListFind(SlipCell& X, bool key);                          // Find a Descriptor List key or value
+         static DListIndex* dListIndex(SlipHeader& dList);                      // Validate or build a Descriptor List index
+         static void dListIndexDrop(const SlipHeader* dList);                   // Discard a Descriptor List index
+         static void dListIndexChange(const SlipCellBase* cell);                // Discard the index holding a changed cell
+         static unsigned gather(const SlipCellBase*& link, DOUBLE* buffer, bool& numeric); // Copy numeric cells to a buffer
+
        /*********************************************************
         *                  Protected Functions                  *
        **********************************************************/
    protected:
 
-      virtual SlipCell& factory();                                              // Create a SlipCell
+              SlipCell& factory();                                              // Create a SlipCell
 
    public:
+      typedef SlipListIterator<SlipCell>          iterator;                     //!< list iterator
+      typedef SlipListIterator<const SlipCell>    const_iterator;               //!< const list iterator
+      typedef std::reverse_iterator<iterator>       reverse_iterator;           //!< list iterator from the bottom
+      typedef std::reverse_iterator<const_iterator> const_reverse_iterator;     //!< const list iterator from the bottom
+      typedef SlipStructuralIterator              structural_iterator;          //!< data cells of a list and sublists
+
             SlipHeader(SlipHeader* header) {
                constructHeader();
                *this = *header;
@@ -271,8 +296,6 @@ namespace slip {
 
             SlipHeader(bool refCnt = false) { constructHeader(refCnt); }        // SlipHeader constructor
 
-     virtual ~SlipHeader();                                                     // ~SlipHeader() destructor
-
      void deleteList();                                                         // destructor
 
       /*********************************************************
@@ -282,22 +305,22 @@ namespace slip {
           /*************************************************
            *             Assignment operators              *
           *************************************************/
-      virtual SlipCell&   operator=(const SlipCell& X);                         // Illegal for non-SlipHeader
-      virtual SlipHeader& operator=(const SlipHeader& X);                       // Flush Y and copy X to Y
-      virtual SlipHeader& operator=(const bool    X);                           // Illegal
-      virtual SlipHeader& operator=(const CHAR    X);                           // Illegal
-      virtual SlipHeader& operator=(const DOUBLE  X);                           // Illegal
-      virtual SlipHeader& operator=(const LONG    X);                           // Illegal
-      virtual SlipHeader& operator=(const UCHAR   X);                           // Illegal
-      virtual SlipHeader& operator=(const ULONG   X);                           // Illegal
-      virtual SlipHeader& operator=(const PTR     X);                           // Illegal
-      virtual SlipHeader& operator=(const string& X);                           // Illegal
-      virtual SlipHeader& operator=(const string* X);                           // Illegal
+              SlipCell&   operator=(const SlipCell& X);                         // Illegal for non-SlipHeader
+              SlipHeader& operator=(const SlipHeader& X);                       // Flush Y and copy X to Y
+              SlipHeader& operator=(const bool    X);                           // Illegal
+              SlipHeader& operator=(const CHAR    X);                           // Illegal
+              SlipHeader& operator=(const DOUBLE  X);                           // Illegal
+              SlipHeader& operator=(const LONG    X);                           // Illegal
+              SlipHeader& operator=(const UCHAR   X);                           // Illegal
+              SlipHeader& operator=(const ULONG   X);                           // Illegal
+              SlipHeader& operator=(const PTR     X);                           // Illegal
+              SlipHeader& operator=(const string& X);                           // Illegal
+              SlipHeader& operator=(const string* X);                           // Illegal
 
           /*************************************************
            *              Logical operators                *
           *************************************************/
-      virtual bool       operator==(const SlipCell& X);                         // Y == X
+              bool       operator==(const SlipCell& X);                         // Y == X
               bool       operator==(const SlipHeader& X);                       // Y == X
 
                /*****************************************
@@ -352,16 +375,16 @@ namespace slip {
       SlipHeader&       push(const string& X, bool constFlag = false);          // Insert x on top of list
       SlipHeader&       push(const string* X, bool constFlag = false);          // Insert X on top of list
 
-      virtual SlipCell& replace(const SlipCell& X);                             // Illegal. List can not be replaced.
-      virtual SlipCell& replace(bool X);                                        // Illegal. List can not be replaced.
-      virtual SlipCell& replace(CHAR X);                                        // Illegal. List can not be replaced.
-      virtual SlipCell& replace(UCHAR X);                                       // Illegal. List can not be replaced.
-      virtual SlipCell& replace(LONG X);                                        // Illegal. List can not be replaced.
-      virtual SlipCell& replace(ULONG X);                                       // Illegal. List can not be replaced.
-      virtual SlipCell& replace(DOUBLE X);                                      // Illegal. List can not be replaced.
-      virtual SlipCell& replace(const PTR X, const void* operation = ptrOP);    // Illegal. List can not be replaced.
-      virtual SlipCell& replace(const string& X, bool constFlag = false);       // Illegal. List can not be replaced.
-      virtual SlipCell& replace(const string* X, bool constFlag = false);       // Illegal. List can not be replaced.
+              SlipCell& replace(const SlipCell& X);                             // Illegal. List can not be replaced.
+              SlipCell& replace(bool X);                                        // Illegal. List can not be replaced.
+              SlipCell& replace(CHAR X);                                        // Illegal. List can not be replaced.
+              SlipCell& replace(UCHAR X);                                       // Illegal. List can not be replaced.
+              SlipCell& replace(LONG X);                                        // Illegal. List can not be replaced.
+              SlipCell& replace(ULONG X);                                       // Illegal. List can not be replaced.
+              SlipCell& replace(DOUBLE X);                                      // Illegal. List can not be replaced.
+              SlipCell& replace(const PTR X, const void* operation = ptrOP);    // Illegal. List can not be replaced.
+              SlipCell& replace(const string& X, bool constFlag = false);       // Illegal. List can not be replaced.
+              SlipCell& replace(const string* X, bool constFlag = false);       // Illegal. List can not be replaced.
      
       SlipCell&         replaceTop(SlipHeader& X);                              // Substitute list TOP value
       SlipCell&         replaceTop(SlipCell& X);                                // Substitute list TOP value
@@ -391,6 +414,31 @@ namespace slip {
       SlipHeader&       splitLeft(SlipCell&  Cell);                             // Split cells to left of X & X to a new list
       SlipHeader&       splitRight(SlipCell&  Cell);                            // Split cells to right of X & X to a new list
 
+               /*****************************************
+                *               Iterators               *
+               ******************************************/
+      iterator          begin()        { return iterator(getRightLink()); }     // List top
+      const_iterator    begin()  const { return const_iterator(getRightLink()); } // List top
+      const_iterator    cbegin() const { return begin(); }                      // List top
+      iterator          end()          { return iterator(this); }               // List header, past the list bottom
+      const_iterator    end()    const { return const_iterator(this); }         // List header, past the list bottom
+      const_iterator    cend()   const { return end(); }                        // List header, past the list bottom
+      reverse_iterator  rbegin()       { return reverse_iterator(end()); }      // List bottom
+      const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); } // List bottom
+      reverse_iterator  rend()         { return reverse_iterator(begin()); }    // List header, before the list top
+      const_reverse_iterator rend()   const { return const_reverse_iterator(begin()); } // List header, before the list top
+      structural_iterator sbegin()     { return structural_iterator(this, true); }  // First data cell, depth first
+      structural_iterator send()       { return structural_iterator(this, false); } // End of a depth first walk
+      SlipStructuralRange structure()  { return SlipStructuralRange(this); }    // Depth first walk for a range based for
+
+               /*****************************************
+                *              Reductions               *
+               ******************************************/
+      DOUBLE            dot(const SlipHeader& X) const;                         // Sum of the products of the cells of two lists
+      DOUBLE            mean() const;                                           // Mean of the list cells
+      bool              minmax(DOUBLE& min, DOUBLE& max) const;                 // Smallest and largest list cell
+      SlipDatum         sum() const;                                            // Sum of the list cells
+
                /*****************************************
                 *             Miscellaneous             *
                ******************************************/
@@ -401,6 +449,7 @@ namespace slip {
       USHORT            getRefCount() const { return *(getHeadRefCnt()); }      // get the list reference count
       USHORT            putMark(const USHORT X);                                // Mark the list
       unsigned          size() const;                                           // Number of cells in list
+      unsigned          sizeWalk() const;                                       // Number of cells in list by a list walk
       void              writeQuick();                                           // Output the current list - quickly
       void              writeQuick(ostream& out);                               // Output the current list - quickly
       void              writeQuick(string& filename);                           // Output the current list - quickly
@@ -408,9 +457,12 @@ namespace slip {
       bool              write(bool testFlag = false);                           // Output the current list
       bool              write(ostream& out, bool testFlag = false);             // Output the current list
       bool              write(string& filename);                                // Output the current list
+      size_t            write(char* buffer, size_t length);                     // Output the current list to a buffer
+      bool              writeBinary(ostream& out);                              // Output the current list in binary form
+      bool              writeBinary(string& filename);                          // Output the current list in binary form
 
-      virtual string    dump() const;                                           // Dump Header
-      virtual void      dump(ostream& out, int& col);                           // Output the current cell
+              string    dump() const;                                           // Dump Header
+              void      dump(ostream& out, int& col);                           // Output the current cell
               void      dumpList();                                             // dump the current list
 
    }; // class SlipHeader
@@ -56,6 +56,8 @@ using namespace slip;
 
 SlipInputMethods::SlipInputMethods(SlipRegister* reg, int debugFlag)
                         : reg(reg)
+                        , errorCount(0)
+                        , includes(NULL)
                         , inputDebugFlag((bool)(debugFlag & SlipRead::INPUT))
                         , debugFlag(debugFlag)
 {
@@ -379,16 +381,28 @@ SlipInputMethods::~SlipInputMethods() {
    
    /**
     * @brief Open an include file
+    * <p>If the include file was parsed in advance and its named lists
+    *    can be merged into the register, the file is not scanned again.
+    *    Otherwise the file is scanned in place.</p>
     * @param[in] title (string) title to be used for debug output
     * @param[in] path (SlipDescription*) path to include file
     */
    void SlipInputMethods::includeFile(string title, SlipDescription* path) {
       if (path == NULL) {
-         cout << "INCLUDE because of previous error." << endl;
+         if (lexerMessage()) cout << "INCLUDE because of previous error." << endl;
       } else {
          DEBUG(inputDebugFlag, debugOut(title, path);)
          SlipDatum* datum = (SlipDatum*)(path->getPtr());
          string filename(datum->toString());
+         if (includes) {
+            map<string, SlipRegister*>::iterator it = includes->find(filename);
+            if ((it != includes->end()) && it->second && reg->merge(*it->second)) {
+               delete it->second;
+               includes->erase(it);
+               path->deleteData();
+               return;
+            }
+         }
          if (!saveLexState(filename)) {
             errorCount++;
             postError(__FILE__, __LINE__, SlipErr::E4007, "parser::parser", "", filename);   
@@ -31,6 +31,7 @@
 #ifndef SLIPINPUTMETHODS_H
 #define	SLIPINPUTMETHODS_H
 
+# include <map>
 # include <string>
 # include "SlipDescription.h"
 # include "SlipRegister.h"
@@ -42,6 +43,7 @@ namespace slip {
       int debugFlag;
       int errorCount;
       bool inputDebugFlag;
+      map<string, SlipRegister*>* includes;                                     // include files parsed in advance
    private:
       SlipInputMethods(const SlipInputMethods& orig);
    public:
@@ -54,6 +56,7 @@ namespace slip {
       int  getErrorCount() { return errorCount; }
       bool getInputFlag()  { return inputDebugFlag; }
       void incErrorCount() { errorCount++; }
+      void setIncludes(map<string, SlipRegister*>* includes) { this->includes = includes; }
       void setParserDebugON(int debugFlag);
       void setParserDebugOFF();
 
@@ -0,0 +1,169 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file    SlipIterator.h
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+#ifndef _SLIPITERATOR_H
+#define	_SLIPITERATOR_H
+
+# include <cstddef>
+# include <iterator>
+# include <type_traits>
+# include <vector>
+# include "SlipCell.h"
+# include "SlipCellBase.h"
+
+using namespace std;
+
+namespace slip {
+
+   /**
+    * @class SlipListIterator
+    * @brief Bidirectional iterator over the cells of one list.
+    * <p>The iterator is a single cell pointer. It is a value type, does no
+    *    allocation, and each increment or decrement is one link access. The
+    *    list header is the end of the list, <b>SlipHeader::begin()</b> is
+    *    the list top and <b>SlipHeader::end()</b> is the list header.</p>
+    * <p>Sublist cells are returned as cells, the sublist is not entered.
+    *    A cell which is removed from the list invalidates an iterator
+    *    referencing it, other iterators are not changed.</p>
+    * <pre>
+    *    for (SlipCell& cell : list) ...
+    *    SlipHeader::iterator it = find_if(list.begin(), list.end(), pred);
+    * </pre>
+    * @tparam Cell SlipCell or const SlipCell
+    */
+   template <class Cell>
+   class SlipListIterator {
+      template <class C> friend class SlipListIterator;
+      typedef typename conditional<is_const<Cell>::value, const SlipCellBase, SlipCellBase>::type Base;
+      Base* link;                                                               // current cell
+   public:
+      typedef bidirectional_iterator_tag iterator_category;                     //!< iterator category
+      typedef Cell                       value_type;                            //!< cell type
+      typedef ptrdiff_t                  difference_type;                       //!< distance type
+      typedef Cell*                      pointer;                               //!< pointer to a cell
+      typedef Cell&                      reference;                             //!< reference to a cell
+
+      SlipListIterator() : link(NULL) { }
+      explicit SlipListIterator(Base* link) : link(link) { }
+      template <class C>
+      SlipListIterator(const SlipListIterator<C>& X) : link(X.link) { }         // iterator to const_iterator
+
+      reference         operator*()  const { return *static_cast<Cell*>(link); } // Current cell
+      pointer           operator->() const { return  static_cast<Cell*>(link); } // Current cell
+      SlipListIterator& operator++()       { link = link->getRightLink(); return *this; }
+      SlipListIterator  operator++(int)    { SlipListIterator X = *this; link = link->getRightLink(); return X; }
+      SlipListIterator& operator--()       { link = link->getLeftLink();  return *this; }
+      SlipListIterator  operator--(int)    { SlipListIterator X = *this; link = link->getLeftLink();  return X; }
+      template <class C>
+      bool operator==(const SlipListIterator<C>& X) const { return link == X.link; }
+      template <class C>
+      bool operator!=(const SlipListIterator<C>& X) const { return link != X.link; }
+   }; // class SlipListIterator
+
+   /**
+    * @class SlipStructuralIterator
+    * @brief Forward iterator over the data cells of a list and its sublists.
+    * <p>The walk is depth first from the list top. A sublist cell is entered
+    *    and its list walked before the walk continues with the cell after
+    *    the sublist cell. Sublist cells and list headers are not returned,
+    *    this is the order of repeated <b>SlipSequencer::advanceSER()</b>
+    *    calls with the return to the enclosing list done as by
+    *    <b>SlipReader::advanceSER()</b>.</p>
+    * <p>The sublist cells entered are held in the iterator. Nesting up to
+    *    <b>DEPTH</b> levels uses storage in the iterator and does no
+    *    allocation, deeper nesting uses heap storage. The list must be
+    *    acyclic, a list which contains itself is walked without end.</p>
+    * <pre>
+    *    DOUBLE total = 0;
+    *    for (SlipCell& cell : list.structure())
+    *       if (cell.isNumber()) total += (DOUBLE)(SlipDatum&)cell;
+    * </pre>
+    */
+   class SlipStructuralIterator {
+   public:
+      static const unsigned DEPTH = 16;                                         //!< sublist levels held in the iterator
+   private:
+      SlipCellBase*          link;                                              // current cell
+      unsigned               depth;                                             // sublist levels entered
+      SlipCellBase*          frame[DEPTH];                                      // sublist cells entered
+      vector<SlipCellBase*>  spill;                                             // sublist cells entered beyond DEPTH
+
+      void enter(SlipCellBase* sublist) {                                       // Enter a sublist
+         if (depth < DEPTH) frame[depth] = sublist; else spill.push_back(sublist);
+         depth++;
+         link = *(SlipCellBase**)SlipCellBase::getSublistHeader(*sublist);
+         SlipCellBase::loadList(link);
+      }; // void enter(SlipCellBase* sublist)
+      void leave() {                                                            // Return to the enclosing list
+         depth--;
+         if (depth < DEPTH) link = frame[depth];
+         else { link = spill.back(); spill.pop_back(); }
+      }; // void leave()
+      void advance() {                                                          // Move to the next data cell
+         for (link = link->getRightLink(); !link->isData(); link = link->getRightLink()) {
+            if (link->isSublist()) enter(link);
+            else if (depth == 0) break;
+            else leave();
+         }
+      }; // void advance()
+   public:
+      typedef forward_iterator_tag       iterator_category;                     //!< iterator category
+      typedef SlipCell                   value_type;                            //!< cell type
+      typedef ptrdiff_t                  difference_type;                       //!< distance type
+      typedef SlipCell*                  pointer;                               //!< pointer to a cell
+      typedef SlipCell&                  reference;                             //!< reference to a cell
+
+      SlipStructuralIterator() : link(NULL), depth(0) { }
+      SlipStructuralIterator(SlipCellBase* head, bool top)                      // list top (true) or list end (false)
+                          : link(head), depth(0) { if (top) { SlipCellBase::loadList(head); advance(); } }
+
+      reference  operator*()  const { return *static_cast<SlipCell*>(link); }  // Current cell
+      pointer    operator->() const { return  static_cast<SlipCell*>(link); }  // Current cell
+      SlipStructuralIterator& operator++()    { advance(); return *this; }
+      SlipStructuralIterator  operator++(int) { SlipStructuralIterator X = *this; advance(); return X; }
+      unsigned   getDepth() const { return depth; }                             // Sublist levels entered
+      bool operator==(const SlipStructuralIterator& X) const { return (link == X.link) && (depth == X.depth); }
+      bool operator!=(const SlipStructuralIterator& X) const { return !(*this == X); }
+   }; // class SlipStructuralIterator
+
+   /**
+    * @class SlipStructuralRange
+    * @brief begin() and end() of a structural walk for a range based for.
+    */
+   class SlipStructuralRange {
+      SlipCellBase* head;                                                       // list header
+   public:
+      explicit SlipStructuralRange(SlipCellBase* head) : head(head) { }
+      SlipStructuralIterator begin() const { return SlipStructuralIterator(head, true); }
+      SlipStructuralIterator end()   const { return SlipStructuralIterator(head, false); }
+   }; // class SlipStructuralRange
+
+}; // namespace slip
+
+#endif	/* _SLIPITERATOR_H */
@@ -0,0 +1,295 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+
+/**
+ * @file    SlipMappedRead.cc
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+ # include <cstring>
+ # include <fcntl.h>
+ # include <sys/mman.h>
+ # include <sys/stat.h>
+ # include <unistd.h>
+ # include "SlipMappedRead.h"
+ # include "SlipErr.h"
+ # include "SlipWriteBinary.h"
+
+namespace slip {
+
+   recursive_mutex                                         SlipMappedRead::loadLock;
+   unordered_map<SlipCellBase*, SlipMappedRead::Unloaded>  SlipMappedRead::unloaded;
+
+   /*********************************************************
+    *               Constructors & Destructors              *
+   **********************************************************/
+
+   /**
+    * @brief Constructor.
+    * @param[in] debugFlag (int) debug mask
+    */
+   SlipMappedRead::SlipMappedRead(int debugFlag) : SlipReadBinary(debugFlag) {
+      init();
+   }; // SlipMappedRead::SlipMappedRead(int debugFlag)
+
+   /**
+    * @brief Constructor.
+    * <p>The register is populated with a single User Data parse method.</p>
+    * @param[in] userData (SlipDatum&) User Data object
+    * @param[in] debugFlag (int) debug mask
+    */
+   SlipMappedRead::SlipMappedRead(SlipDatum& userData, int debugFlag)
+                                 : SlipReadBinary(userData, debugFlag) {
+      init();
+   }; // SlipMappedRead::SlipMappedRead(SlipDatum& userData, int debugFlag)
+
+   /**
+    * @brief Constructor.
+    * <p>The register is populated with multiple User Data parse methods.</p>
+    * @param[in] size (int) number of User Data objects
+    * @param[in] userData (SlipDatum []) list of User Data objects
+    * @param[in] debugFlag (int) debug mask
+    */
+   SlipMappedRead::SlipMappedRead(const int size, SlipDatum const userData[], int debugFlag)
+                                 : SlipReadBinary(size, userData, debugFlag) {
+      init();
+   }; // SlipMappedRead::SlipMappedRead(const int size, SlipDatum const userData[], int debugFlag)
+
+   /**
+    * @brief Constructor.
+    * <p>The register is populated with multiple User Data parse methods.</p>
+    * @param[in] size (int) number of User Data objects
+    * @param[in] userData (SlipDatum* []) list of pointers to User Data objects
+    * @param[in] debugFlag (int) debug mask
+    */
+   SlipMappedRead::SlipMappedRead(const int size, SlipDatum  * const userData[], int debugFlag)
+                                 : SlipReadBinary(size, userData, debugFlag) {
+      init();
+   }; // SlipMappedRead::SlipMappedRead(const int size, SlipDatum  * const userData[], int debugFlag)
+
+   /**
+    * @brief Copy constructor.
+    * <p>This is not available for use.</p>
+    * @param orig (SlipMappedRead&) reference to SlipMappedRead object
+    */
+   SlipMappedRead::SlipMappedRead(const SlipMappedRead& orig) {
+   }; // SlipMappedRead::SlipMappedRead(const SlipMappedRead& orig)
+
+   /**
+    * @brief Destructor.
+    * <p>The file is unmapped. Lists which have not been input remain
+    *    empty.</p>
+    */
+   SlipMappedRead::~SlipMappedRead() {
+      close();
+   }; // SlipMappedRead::~SlipMappedRead()
+
+   /*********************************************************
+    *                    Private Methods                    *
+   **********************************************************/
+
+   /**
+    * @brief Unmap the file.
+    * <p>Lists waiting to be input are no longer waiting. The reference
+    *    held for each list other than the list returned by <b>open()</b>
+    *    is released, as SlipReadBinary does when the input is done.</p>
+    */
+   void SlipMappedRead::close() {                                               // Unmap the file
+      lock_guard<recursive_mutex> guard(loadLock);
+      for (unordered_map<ULONG, SlipHeader*>::iterator it = listNo.begin(); it != listNo.end(); ++it)
+         if (unloaded.erase(it->second)) SlipCellBase::unloadedLists--;
+      for (unordered_map<ULONG, SlipHeader*>::iterator it = listNo.begin(); it != listNo.end(); ++it)
+         if (it->first != 0) it->second->deleteList();
+      listNo.clear();
+      if (base) munmap(base, length);
+      init();
+   }; // void SlipMappedRead::close()
+
+   /**
+    * @brief Input a list when it is entered.
+    * <p>This is the SlipCellBase list loader. A list waiting to be input
+    *    is input, any other list is unchanged.</p>
+    * @param[in] header (SlipCellBase&) list header being entered
+    */
+   void SlipMappedRead::fault(SlipCellBase& header) {                           // Input a list when it is entered
+      lock_guard<recursive_mutex> guard(loadLock);
+      unordered_map<SlipCellBase*, Unloaded>::iterator it = unloaded.find(&header);
+      if (it == unloaded.end()) return;
+      Unloaded entry = it->second;
+      unloaded.erase(it);
+      SlipCellBase::unloadedLists--;
+      if (!entry.file->inputList(entry.number, (SlipHeader&)header)) {
+         entry.file->errorReturn = 1;
+         postError(__FILE__, __LINE__, SlipErr::E4020, "SlipMappedRead::load", "", "");
+      }
+   }; // void SlipMappedRead::fault(SlipCellBase& header)
+
+   /**
+    * @brief Return the list with a list number.
+    * <p>A list not seen before is created empty and waits to be input.</p>
+    * @param[in] number (ULONG) list number
+    * @return list header or <b>NULL</b> if the list number is not valid
+    */
+   SlipHeader* SlipMappedRead::getList(ULONG number) {                          // Return list by list number
+      if (number >= listCount) return NULL;
+      unordered_map<ULONG, SlipHeader*>::iterator it = listNo.find(number);
+      if (it != listNo.end()) return it->second;
+      SlipHeader* header = new SlipHeader();
+      listNo[number] = header;
+      Unloaded entry = { this, number };
+      unloaded[header] = entry;
+      SlipCellBase::unloadedLists++;
+      return header;
+   }; // SlipHeader* SlipMappedRead::getList(ULONG number)
+
+   /**
+    * @brief Initialize the file state.
+    */
+   void SlipMappedRead::init() {                                                // Initialize the file state
+      SlipCellBase::listLoader = &SlipMappedRead::fault;
+      base        = NULL;
+      block       = NULL;
+      in          = NULL;
+      length      = 0;
+      index       = 0;
+      pos         = 0;
+      fill        = 0;
+      listCount   = 0;
+      loadedCount = 0;
+   }; // void SlipMappedRead::init()
+
+   /**
+    * @brief Input a list from the file.
+    * <p>The list position is taken from the list index. The User Data in
+    *    the list is parsed after the list is input. Input of a list can
+    *    enter another list, the file position is restored on return.</p>
+    * @param[in] number (ULONG) list number
+    * @param[in] header (SlipHeader&) list receiving the input
+    * @return <b>false</b> the list in the file is not valid
+    */
+   bool SlipMappedRead::inputList(ULONG number, SlipHeader& header) {           // Input a list from the file
+      size_t   save  = pos;
+      size_t   first = userData.size();
+      uint64_t position;
+      UCHAR    tag;
+      pos = index + (size_t)number * sizeof(uint64_t);
+      bool valid = get(position) && (position < length);
+      if (valid) {
+         pos   = position;
+         valid = get(tag) && (tag == SlipWriteBinary::LIST) && readBody(header);
+      }
+      pos = save;
+      loadedCount++;
+      vector<UserData> entries(userData.begin() + first, userData.end());
+      userData.resize(first);
+      parseUserData(entries);
+      return valid;
+   }; // bool SlipMappedRead::inputList(ULONG number, SlipHeader& header)
+
+   /*********************************************************
+    *                        Methods                        *
+   **********************************************************/
+
+   /**
+    * @brief Return <b>true</b> if a list has been input.
+    * <p>A list which is not from a mapped file has been input.</p>
+    * @param[in] header (SlipHeader&) list header
+    * @return <b>false</b> the list is waiting to be input
+    */
+   bool SlipMappedRead::isLoaded(const SlipHeader& header) {                    // true if the list has been input
+      lock_guard<recursive_mutex> guard(loadLock);
+      return unloaded.find((SlipCellBase*)&header) == unloaded.end();
+   }; // bool SlipMappedRead::isLoaded(const SlipHeader& header)
+
+   /**
+    * @brief Input a list now.
+    * <p>A list waiting to be input is input, any other list is unchanged.</p>
+    * @param[in] header (SlipHeader&) list header
+    * @return header
+    */
+   SlipHeader& SlipMappedRead::load(SlipHeader& header) {                       // Input a list now
+      fault((SlipCellBase&)header);
+      return header;
+   }; // SlipHeader& SlipMappedRead::load(SlipHeader& header)
+
+   /**
+    * @brief Map a binary list file and input its list.
+    * <p>The file identification, the User Data names and the list index
+    *    are checked and the list is input. Its sublists are input when
+    *    they are used. If the file can not be mapped an empty list is
+    *    returned, if the file is not valid the list input before the
+    *    error is returned. A file opened before is unmapped.</p>
+    * @param[in] filename (string) file name and path to be opened
+    * @return list
+    */
+   SlipHeader& SlipMappedRead::open(string filename) {                          // Map a file and input its list
+      lock_guard<recursive_mutex> guard(loadLock);
+      close();
+      errorReturn = 0;
+      int fd = ::open(filename.c_str(), O_RDONLY);
+      struct stat status;
+      if ((fd >= 0) && (fstat(fd, &status) == 0) && (status.st_size > 0)) {
+         length = status.st_size;
+         base   = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+         if (base == MAP_FAILED) base = NULL;
+      }
+      if (fd >= 0) ::close(fd);
+      if (base == NULL) {
+         errorReturn = 2;
+         return *new SlipHeader();
+      }
+      block = (const char*)base;
+      fill  = length;
+
+      const size_t trailer = sizeof(uint64_t) + sizeof(SlipWriteBinary::MAGIC);
+      char     magic[sizeof(SlipWriteBinary::MAGIC)];
+      uint64_t namesPosition;
+      bool valid = readHeader() && (length >= trailer);
+      if (valid) {
+         pos   = length - trailer;
+         valid = get(namesPosition) && get(magic, sizeof(magic))
+              && !memcmp(magic, SlipWriteBinary::MAGIC, sizeof(magic))
+              && (namesPosition < length);
+      }
+      if (valid) {
+         pos   = namesPosition;
+         valid = readNames() && get(listCount) && (listCount > 0)
+              && ((length - pos) / sizeof(uint64_t) >= listCount);
+         index = pos;
+      }
+      SlipHeader* head = new SlipHeader();
+      if (valid) {
+         listNo[0] = head;
+         valid     = inputList(0, *head);
+      }
+      if (!valid) {
+         errorReturn = 1;
+         postError(__FILE__, __LINE__, SlipErr::E4020, "SlipMappedRead::open", "", filename);
+      }
+      for(; head->getRefCount(); ) head->deleteList();
+      return *head;
+   }; // SlipHeader& SlipMappedRead::open(string filename)
+
+}; // namespace slip
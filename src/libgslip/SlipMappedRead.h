@@ -0,0 +1,119 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+
+/**
+ * @file    SlipMappedRead.h
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ * @brief Input a binary list file a list at a time
+ */
+
+#ifndef SLIPMAPPEDREAD_H
+#define	SLIPMAPPEDREAD_H
+
+# include <cstdint>
+# include <mutex>
+# include <string>
+# include <unordered_map>
+# include "SlipDef.h"
+# include "SlipCellBase.h"
+# include "SlipHeader.h"
+# include "SlipReadBinary.h"
+
+using namespace std;
+
+namespace slip {
+
+   /**
+    * @class SlipMappedRead
+    * <p><b>Overview</b></p>
+    * <p>Input a list written by SlipWriteBinary when it is first used. The
+    *    file is mapped into memory and only the list returned by
+    *    <b>open()</b> is input. Each sublist of an input list is an empty
+    *    list header which is input from the mapped file when a SlipReader,
+    *    SlipSequencer, SlipCursor or structural iterator enters it, when
+    *    its header is taken from a sublist cell, when it is counted, copied
+    *    or written, or when <b>load()</b> is called. The cost of opening a file is the cost of
+    *    mapping it and of inputting one list, and the cost of using a list
+    *    is the cost of the parts of it which are used.</p>
+    * <p>A list which has not been input has no cells, no user mark and no
+    *    descriptor list. A walk over the cells of a list does not input the
+    *    lists its sublist cells reference.</p>
+    * <p>The lists input hold the sublist references of the lists in the
+    *    file. A list which is never used is never input. Deleting the
+    *    SlipMappedRead object unmaps the file, lists which have not been
+    *    input remain empty. Lists which have been input are not changed,
+    *    their reference counts are those of a list read by
+    *    SlipReadBinary.</p>
+    * <p>User Data parse methods are registered as for SlipReadBinary and
+    *    called when the list containing the User Data is input.</p>
+    * <pre>
+    *    SlipMappedRead file(userData);
+    *    SlipHeader& list = file.open("archive.slb");
+    *    SlipSequencer seq(list);
+    *    while(!seq.advanceSER().isHeader()) ...   // sublists input when entered
+    * </pre>
+    */
+   class SlipMappedRead : public SlipReadBinary {
+   private:
+      /**
+       * @struct Unloaded
+       * @brief The file and list number of a list waiting to be input.
+       */
+      struct Unloaded {
+         SlipMappedRead* file;                                                  //!< mapped file
+         ULONG           number;                                                //!< list number
+      }; // struct Unloaded
+
+      static recursive_mutex                          loadLock;                 //!< Guards list input
+      static unordered_map<SlipCellBase*, Unloaded>   unloaded;                 //!< Lists waiting to be input
+
+      void*    base;                                                            //!< mapped file
+      size_t   length;                                                          //!< mapped file size
+      size_t   index;                                                           //!< file position of the list index
+      ULONG    listCount;                                                       //!< number of lists in the file
+      ULONG    loadedCount;                                                     //!< number of lists input
+      unordered_map<ULONG, SlipHeader*> listNo;                                 //!< lists created by list number
+   private:
+      SlipMappedRead(const SlipMappedRead& orig);
+      void         close();                                                     // Unmap the file
+      static void  fault(SlipCellBase& header);                                 // Input a list when it is entered
+      virtual SlipHeader* getList(ULONG number);                                // Return list by list number
+      void         init();                                                      // Initialize the file state
+      bool         inputList(ULONG number, SlipHeader& header);                 // Input a list from the file
+   public:
+      SlipMappedRead(int debugFlag = 0);
+      SlipMappedRead(SlipDatum& userData, int debugFlag = 0);
+      SlipMappedRead(const int size, SlipDatum const userData[], int debugFlag = 0);
+      SlipMappedRead(const int size, SlipDatum  * const userData[], int debugFlag = 0);
+      virtual ~SlipMappedRead();
+      ULONG        getListCount()   const { return listCount;   }               // Number of lists in the file
+      ULONG        getLoadedCount() const { return loadedCount; }               // Number of lists input
+      static bool  isLoaded(const SlipHeader& header);                          // true if the list has been input
+      static SlipHeader& load(SlipHeader& header);                              // Input a list now
+      SlipHeader&  open(string filename);                                       // Map a file and input its list
+   }; // class SlipMappedRead
+}; // namespace slip
+
+#endif	/* SLIPMAPPEDREAD_H */
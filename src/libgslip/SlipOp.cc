@@ -29,9 +29,11 @@
  *
  */
 
+# include <cstdlib>
 # include <iostream>
 # include <iomanip>
 # include <sstream>
+# include <type_traits>
 # include "SlipOp.h"
 # include "SlipCell.h"
 # include "SlipCellBase.h"
@@ -630,6 +632,171 @@ namespace slip {
       return num;
    }; // LONG SlipOp::shrOP(const LONG Y, const SlipDatum X)
 
+          /*************************************************
+           *           Arithmetic dispatch tables          *
+          *************************************************/
+   /**
+    * @brief Numeric type traits for the arithmetic kernels.
+    * <p><b>wide</b> is the type the LHS is widened to before the operation,
+    *    <b>get</b> returns the datum. Types which are not numeric have no
+    *    kernels, their operations go through the operator field.</p>
+    */
+   template<ClassType T> struct SlipOp::Arith {
+      static const bool numeric = false;
+   }; // template<ClassType T> struct SlipOp::Arith
+
+   template<> struct SlipOp::Arith<eBOOL> {
+      static const bool numeric = true;
+      typedef LONG   wide;
+      static bool   get(const SlipDatum& X) { return *getBool(X);   }
+   }; // template<> struct SlipOp::Arith<eBOOL>
+
+   template<> struct SlipOp::Arith<eCHAR> {
+      static const bool numeric = true;
+      typedef LONG   wide;
+      static CHAR   get(const SlipDatum& X) { return *getChar(X);   }
+   }; // template<> struct SlipOp::Arith<eCHAR>
+
+   template<> struct SlipOp::Arith<eUCHAR> {
+      static const bool numeric = true;
+      typedef ULONG  wide;
+      static UCHAR  get(const SlipDatum& X) { return *getUChar(X);  }
+   }; // template<> struct SlipOp::Arith<eUCHAR>
+
+   template<> struct SlipOp::Arith<eLONG> {
+      static const bool numeric = true;
+      typedef LONG   wide;
+      static LONG   get(const SlipDatum& X) { return *getLong(X);   }
+   }; // template<> struct SlipOp::Arith<eLONG>
+
+   template<> struct SlipOp::Arith<eULONG> {
+      static const bool numeric = true;
+      typedef ULONG  wide;
+      static ULONG  get(const SlipDatum& X) { return *getULong(X);  }
+   }; // template<> struct SlipOp::Arith<eULONG>
+
+   template<> struct SlipOp::Arith<eDOUBLE> {
+      static const bool numeric = true;
+      typedef DOUBLE wide;
+      static DOUBLE get(const SlipDatum& X) { return *getDouble(X); }
+   }; // template<> struct SlipOp::Arith<eDOUBLE>
+
+   /**
+    * @brief Y op X for two numeric types.
+    * <p>The result is DOUBLE if either operand is DOUBLE. Otherwise it is
+    *    the widened LHS type, except that + and * with a ULONG RHS give a
+    *    ULONG. These are the types produced by the operator field methods.</p>
+    */
+   template<int OP, ClassType Y, ClassType X> struct SlipOp::Kernel<OP, Y, X, true> {
+      typedef typename Arith<Y>::wide WY;
+      typedef typename conditional< is_same<WY, DOUBLE>::value || (X == eDOUBLE), DOUBLE
+            , typename conditional<((OP == ADD) || (OP == MUL)) && (X == eULONG), ULONG, WY>::type
+            >::type R;
+      static SlipDatum apply(const SlipDatum& y, const SlipDatum& x) {
+         R num = (WY)Arith<Y>::get(y);
+         if      (OP == ADD) num += Arith<X>::get(x);
+         else if (OP == SUB) num -= Arith<X>::get(x);
+         else if (OP == MUL) num *= Arith<X>::get(x);
+         else                num /= Arith<X>::get(x);
+         return SlipDatum(num);
+      }
+   }; // template<int OP, ClassType Y, ClassType X> struct SlipOp::Kernel<OP, Y, X, true>
+
+   /**
+    * @brief Y op X where Y or X is not numeric.
+    * <p>The operation is done by the operator field method of Y.</p>
+    */
+   template<int OP, ClassType Y, ClassType X> struct SlipOp::Kernel<OP, Y, X, false> {
+      static SlipDatum apply(const SlipDatum& y, const SlipDatum& x) {
+         const SlipOp* op = *getOperator(y);
+         return (OP == ADD)? op->add(y, x)
+              : (OP == SUB)? op->sub(y, x)
+              : (OP == MUL)? op->mul(y, x)
+              :              op->div(y, x);
+      }
+   }; // template<int OP, ClassType Y, ClassType X> struct SlipOp::Kernel<OP, Y, X, false>
+
+   /**
+    * @brief Y % X for two discrete types.
+    * <p>The remainder is computed in the widened LHS type.</p>
+    */
+   template<ClassType Y, ClassType X> struct SlipOp::Kernel<SlipOp::MOD, Y, X, true> {
+      typedef typename Arith<Y>::wide WY;
+      static LONG apply(const SlipDatum& y, const SlipDatum& x) {
+         WY num = Arith<Y>::get(y);
+         num %= Arith<X>::get(x);
+         return (LONG)num;
+      }
+   }; // template<ClassType Y, ClassType X> struct SlipOp::Kernel<SlipOp::MOD, Y, X, true>
+
+   /**
+    * @brief Y % X where Y or X is not discrete.
+    * <p>The operation is done by the operator field method of Y.</p>
+    */
+   template<ClassType Y, ClassType X> struct SlipOp::Kernel<SlipOp::MOD, Y, X, false> {
+      static LONG apply(const SlipDatum& y, const SlipDatum& x) {
+         return (*getOperator(y))->mod(y, x);
+      }
+   }; // template<ClassType Y, ClassType X> struct SlipOp::Kernel<SlipOp::MOD, Y, X, false>
+
+   /**
+    * @brief The kernels for one LHS type, indexed by the RHS type.
+    */
+   template<int OP, ClassType Y> struct SlipOp::Row {
+      typedef typename conditional<OP == MOD, ModKernel, ArithKernel>::type Entry;
+      static const Entry kernel[eSENTINEL];
+   }; // template<int OP, ClassType Y> struct SlipOp::Row
+
+   template<int OP, ClassType Y>
+   const typename SlipOp::Row<OP, Y>::Entry SlipOp::Row<OP, Y>::kernel[eSENTINEL] = {
+        Kernel<OP, Y, eUNDEFINED>::apply
+      , Kernel<OP, Y, eBOOL>::apply
+      , Kernel<OP, Y, eCHAR>::apply
+      , Kernel<OP, Y, eDOUBLE>::apply
+      , Kernel<OP, Y, eHEADER>::apply
+      , Kernel<OP, Y, eLONG>::apply
+      , Kernel<OP, Y, ePTR>::apply
+      , Kernel<OP, Y, eREADER>::apply
+      , Kernel<OP, Y, eSTRING>::apply
+      , Kernel<OP, Y, eSUBLIST>::apply
+      , Kernel<OP, Y, eUCHAR>::apply
+      , Kernel<OP, Y, eULONG>::apply
+   }; // SlipOp::Row<OP, Y>::kernel
+
+   /**
+    * @brief SlipDatum arithmetic kernels, arithTable[op][Y type][X type].
+    * <p>The table is constant, it is complete before any static
+    *    initialization runs.</p>
+    */
+   const SlipOp::ArithKernel* const SlipOp::arithTable[MOD][eSENTINEL] = {
+      { Row<ADD, eUNDEFINED>::kernel, Row<ADD, eBOOL>::kernel, Row<ADD, eCHAR>::kernel
+        , Row<ADD, eDOUBLE>::kernel, Row<ADD, eHEADER>::kernel, Row<ADD, eLONG>::kernel
+        , Row<ADD, ePTR>::kernel, Row<ADD, eREADER>::kernel, Row<ADD, eSTRING>::kernel
+        , Row<ADD, eSUBLIST>::kernel, Row<ADD, eUCHAR>::kernel, Row<ADD, eULONG>::kernel },
+      { Row<SUB, eUNDEFINED>::kernel, Row<SUB, eBOOL>::kernel, Row<SUB, eCHAR>::kernel
+        , Row<SUB, eDOUBLE>::kernel, Row<SUB, eHEADER>::kernel, Row<SUB, eLONG>::kernel
+        , Row<SUB, ePTR>::kernel, Row<SUB, eREADER>::kernel, Row<SUB, eSTRING>::kernel
+        , Row<SUB, eSUBLIST>::kernel, Row<SUB, eUCHAR>::kernel, Row<SUB, eULONG>::kernel },
+      { Row<MUL, eUNDEFINED>::kernel, Row<MUL, eBOOL>::kernel, Row<MUL, eCHAR>::kernel
+        , Row<MUL, eDOUBLE>::kernel, Row<MUL, eHEADER>::kernel, Row<MUL, eLONG>::kernel
+        , Row<MUL, ePTR>::kernel, Row<MUL, eREADER>::kernel, Row<MUL, eSTRING>::kernel
+        , Row<MUL, eSUBLIST>::kernel, Row<MUL, eUCHAR>::kernel, Row<MUL, eULONG>::kernel },
+      { Row<DIV, eUNDEFINED>::kernel, Row<DIV, eBOOL>::kernel, Row<DIV, eCHAR>::kernel
+        , Row<DIV, eDOUBLE>::kernel, Row<DIV, eHEADER>::kernel, Row<DIV, eLONG>::kernel
+        , Row<DIV, ePTR>::kernel, Row<DIV, eREADER>::kernel, Row<DIV, eSTRING>::kernel
+        , Row<DIV, eSUBLIST>::kernel, Row<DIV, eUCHAR>::kernel, Row<DIV, eULONG>::kernel }
+   }; // SlipOp::arithTable
+
+   /**
+    * @brief SlipDatum remainder kernels, modTable[Y type][X type].
+    */
+   const SlipOp::ModKernel* const SlipOp::modTable[eSENTINEL] = {
+        Row<MOD, eUNDEFINED>::kernel, Row<MOD, eBOOL>::kernel, Row<MOD, eCHAR>::kernel
+      , Row<MOD, eDOUBLE>::kernel, Row<MOD, eHEADER>::kernel, Row<MOD, eLONG>::kernel
+      , Row<MOD, ePTR>::kernel, Row<MOD, eREADER>::kernel, Row<MOD, eSTRING>::kernel
+      , Row<MOD, eSUBLIST>::kernel, Row<MOD, eUCHAR>::kernel, Row<MOD, eULONG>::kernel
+   }; // SlipOp::modTable
+
           /*************************************************
            *                Miscellaneous                  *
           *************************************************/
@@ -293,6 +293,15 @@ namespace slip {
  *    <li><b>relational operator</b> operator->name(SlipDatum& LHS, SlipDatum& RHS).</li>
  *    <li><b>assignment operator</b> operator->name(SlipDatum& LHS, SlipDatum& RHS).</li>
  * </ul>
+ * <p>The binary arithmetic operators (+, -, *, /, %) between two SlipDatum
+ *    objects do not use the operator field. They index
+ *    <b>arithTable</b>[op][LHS type][RHS type] (<b>modTable</b> for %) and
+ *    make one call to a kernel generated from a template for the type pair.
+ *    The kernel widens the LHS (bool, CHAR, LONG to LONG, UCHAR, ULONG to
+ *    ULONG) and applies the operator to the RHS with C++ conversions, giving
+ *    the same result type and value as the operator field methods. Pairs
+ *    which are not both numeric call the operator field method, which posts
+ *    the error or calls the user defined operation.</p>
  *    
  * <p>
  * Casting an object returns the casting type if possible. If the type of the
@@ -1405,45 +1414,40 @@ namespace slip {
  * --------------------------------------------------------------------
  */
 
-   class SlipOp {
+   class SlipOp : public SlipOpTag {
+   public:
+      enum ArithOp { ADD, SUB, MUL, DIV, MOD };                                 //!< arithTable operations
+      typedef SlipDatum (*ArithKernel)(const SlipDatum& Y, const SlipDatum& X); //!< Y op X for one type pair
+      typedef LONG      (*ModKernel)(const SlipDatum& Y, const SlipDatum& X);   //!< Y % X for one type pair
+      static const ArithKernel* const arithTable[MOD][eSENTINEL];               //!< [op][Y type][X type] kernels
+      static const ModKernel*   const modTable[eSENTINEL];                      //!< [Y type][X type] kernels
    private:
+      template<ClassType T> struct Arith;                                       // numeric type traits
+      template<int OP, ClassType Y, ClassType X, bool numeric = Arith<Y>::numeric && Arith<X>::numeric
+                                                             && ((OP != MOD) || ((Y != eDOUBLE) && (X != eDOUBLE)))>
+      struct Kernel;                                                            // Y op X kernel
+      template<int OP, ClassType Y> struct Row;                                 // kernels for one Y type
    protected:
       struct sCell {
-         void*         vptr;                                                    //!< Class vptr (this may be compiler dependent)
          void*         operation;                                               //!< Operations cell can perform
-         SlipCellBase* leftLink;                                                //!< Pointer to preceding cell
-         SlipCellBase* rightLink;                                               //!< Pointer to following cell
+         SlipLink      leftLink;                                                //!< Pointer to preceding cell
+         SlipLink      rightLink;                                               //!< Pointer to following cell
          Data          datum;                                                   //!< SLIP cell data field
       }; // struct sCell
 
       const ULONG      cellType;                                                //!< cell subtype
       const ULONG      ID;                                                      //!< Cell ID
       const string     name;                                                    //!< string representing SlipDatumCell
-      const ClassType  classType;                                               //!< class number
-      const bool       isDataFlag;                                              //!< true if cell is data
-      const bool       isDiscreteFlag;                                          //!< true if cell is a discrete data type
-      const bool       isHeaderFlag;                                            //!< true if cell is a header
-      const bool       isNumberFlag;                                            //!< true if cell is numeric data
-      const bool       isPtrFlag;                                               //!< true if cell is a pointer
-      const bool       isStringFlag;                                            //!< true if cell is a STRING
-      const bool       isSublistFlag;                                           //!< true if cell is sublist
 
       /****************************************
        *       SLIP Protected Functions       *
       *****************************************/
    private:
 
-      SlipOp(const SlipOp& orig) : cellType(0)
+      SlipOp(const SlipOp& orig) : SlipOpTag(eUNDEFINED, DATA)
+                                 , cellType(0)
                                  , ID(0)
-                                 , classType(eUNDEFINED)
                                  , name("SlipOp")
-                                 , isDataFlag(true)
-                                 , isDiscreteFlag(false)
-                                 , isHeaderFlag(false)
-                                 , isNumberFlag(false)
-                                 , isPtrFlag(false)
-                                 , isStringFlag(false)
-                                 , isSublistFlag(false)
       { }
 
 
@@ -1451,32 +1455,20 @@ namespace slip {
        *       SLIP Protected Functions       *
       *****************************************/
    protected:
-      SlipOp() : cellType(0)
+      SlipOp() : SlipOpTag(eUNDEFINED, DATA)
+               , cellType(0)
                , ID(0)
-               , classType(eUNDEFINED)
                , name("SlipOp")
-               , isDataFlag(true)
-               , isDiscreteFlag(false)
-               , isHeaderFlag(false)
-               , isNumberFlag(false)
-               , isPtrFlag(false)
-               , isStringFlag(false)
-               , isSublistFlag(false)
       { }
       SlipOp ( ULONG cellType, ULONG ID, ClassType classType, string name, bool isDataFlag
              , bool isDiscreteFlag, bool  isHeaderFlag,       bool isNumberFlag
              , bool isSublistFlag )
-               : cellType(cellType)
+               : SlipOpTag(classType, (isDataFlag?     DATA:     0)
+                                    | (isDiscreteFlag? DISCRETE: 0)
+                                    | (isNumberFlag?   NUMBER:   0))
+               , cellType(cellType)
                , ID(ID)
-               , classType(classType)
                , name(name)
-               , isDataFlag(isDataFlag)
-               , isDiscreteFlag(isDiscreteFlag)
-               , isHeaderFlag(classType == eHEADER)
-               , isNumberFlag(isNumberFlag)
-               , isPtrFlag(classType == ePTR)
-               , isStringFlag(classType == eSTRING)
-               , isSublistFlag(classType == eSUBLIST)
       { }
      ~SlipOp() { }
      
@@ -1698,18 +1690,18 @@ namespace slip {
            *                Miscellaneous                  *
           *************************************************/
       virtual SlipDatum& copy(const SlipDatum& X) const;                        // Return a reference to a copy of the current cell
-      const ClassType getClassType()const       { return classType;    }        // return the internal class type
+      const ClassType getClassType()const       { return (ClassType)type; }     // return the internal class type
       virtual sAllData getDatumCopy(const SlipDatum& X) const;                  // Return valid datum
       virtual
       const string    getName(SlipDatum* X = NULL) const { return name; }       // string representing SlipDatumCell
-      const bool      isData()      const       { return isDataFlag;    }       // true if cell is data
-      const bool      isDiscrete()  const       { return isDiscreteFlag;}       // true if cell is a discrete numeric type
-      const bool      isHeader()    const       { return isHeaderFlag;  }       // true if cell is a header
-      const bool      isNumber()    const       { return isNumberFlag;  }       // true if cell is numeric data
-      const bool      isPtr()       const       { return isPtrFlag;     }       // true if cell is a pointer
-      const bool      isReal()      const       { return classType == eDOUBLE; }// true if data is a real type
-      const bool      isString()    const       { return isStringFlag;  }       // true if cell a string
-      const bool      isSublist()   const       { return isSublistFlag; }       // true if cell is sublist
+      const bool      isData()      const       { return props & DATA;     }    // true if cell is data
+      const bool      isDiscrete()  const       { return props & DISCRETE; }    // true if cell is a discrete numeric type
+      const bool      isHeader()    const       { return type == eHEADER;  }    // true if cell is a header
+      const bool      isNumber()    const       { return props & NUMBER;   }    // true if cell is numeric data
+      const bool      isPtr()       const       { return type == ePTR;     }    // true if cell is a pointer
+      const bool      isReal()      const       { return type == eDOUBLE;  }    // true if data is a real type
+      const bool      isString()    const       { return type == eSTRING;  }    // true if cell a string
+      const bool      isSublist()   const       { return type == eSUBLIST; }    // true if cell is sublist
       virtual string  dump(const SlipCell& X) const     = 0;                    // unprettyingly dump the data
       static  string  dumpLink(const SlipCellBase& X);                          // format links
       virtual Parse   getParse(SlipDatum& X);                                   // return a pointer to a parser method
@@ -1718,6 +1710,15 @@ namespace slip {
       virtual string  write(const SlipCell& X) const = 0;                       // formatted string for write
 
    }; // class SlipOp
+
+   /**
+    * @brief Return the type tag of the cell operator.
+    * <p>The reference cast needs no test for a null operator.</p>
+    * @return (const SlipOpTag*) tag of the SlipOp of the cell
+    */
+   inline const SlipOpTag* SlipCellBase::getTag() const {                       // Type tag of the cell operator
+      return &static_cast<const SlipOpTag&>(*(const SlipOp*)operation);
+   }; // inline const SlipOpTag* SlipCellBase::getTag() const
 }; // namespace slip
 
 #endif	/* _SLIPOP_H */
@@ -0,0 +1,361 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file    SlipPackedList.cc
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+ # include <sstream>
+ # include <string>
+ # include <vector>
+ # include "SlipPackedList.h"
+ # include "SlipCellBase.h"
+ # include "SlipDatum.h"
+ # include "SlipErr.h"
+ # include "SlipHeader.h"
+
+namespace slip {
+
+   const unsigned PACKEDHEADROOM = 16;                                         // Least free space made above the list top
+
+   /**
+    * @brief Constructor for an empty list.
+    * <p>If the type is not a packable type the type is set by the first
+    *    value inserted.</p>
+    * @param[in] type (ClassType) type of the packed values
+    */
+   SlipPackedList::SlipPackedList(ClassType type)
+                  : type(isPackedType(type)? type: eUNDEFINED), first(0), linked(NULL) {
+   }; // SlipPackedList::SlipPackedList(ClassType type)
+
+   /**
+    * @brief Constructor for a packed copy of a list.
+    * <p>The list cells are copied in order. If the cells are not all of one
+    *    packable type the copy is a linked list. The input list is not
+    *    changed.</p>
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E2016</b> Sublist not allowed. The sublist is not copied.</li>
+    * </ul>
+    * @param[in] list (SlipHeader&) list to copy
+    */
+   SlipPackedList::SlipPackedList(const SlipHeader& list)
+                  : type(eUNDEFINED), first(0), linked(NULL) {
+      for (SlipCellBase* link = list.getRightLink(); !link->isHeader(); link = link->getRightLink()) {
+         if (link->isSublist())
+            postError(__FILE__, __LINE__, SlipErr::E2016, "SlipPackedList::SlipPackedList", "", "", *link);
+         else enqueue((SlipDatum&)*link);
+      }
+   }; // SlipPackedList::SlipPackedList(const SlipHeader& list)
+
+   /**
+    * @brief Destructor. A linked list is deleted.
+    */
+   SlipPackedList::~SlipPackedList() {
+      if (linked != NULL) linked->deleteList();
+   }; // SlipPackedList::~SlipPackedList()
+
+               /*****************************************
+                *             Packed Values             *
+               ******************************************/
+
+   /**
+    * @brief true if values of the type can be packed.
+    * @param[in] type (ClassType) value type
+    * @return <b>true</b> for bool, CHAR, UCHAR, LONG, ULONG and DOUBLE
+    */
+   bool SlipPackedList::isPackedType(ClassType type) {                         // true for a packable type
+      switch(type) {
+         case eBOOL:
+         case eCHAR:
+         case eUCHAR:
+         case eLONG:
+         case eULONG:
+         case eDOUBLE: return true;
+         default:      return false;
+      }
+   }; // bool SlipPackedList::isPackedType(ClassType type)
+
+   /**
+    * @brief Packed value of a numeric SlipDatum.
+    * @param[in] X (SlipDatum&) numeric datum
+    * @return packed value
+    */
+   SlipPackedList::Value SlipPackedList::valueOf(const SlipDatum& X) {         // packed value of X
+      Value value;
+      value.Double = 0;
+      switch(X.getClassType()) {
+         case eBOOL:   value.Bool   = (bool)X;   break;
+         case eCHAR:   value.Chr    = (CHAR)X;   break;
+         case eUCHAR:  value.UChr   = (UCHAR)X;  break;
+         case eLONG:   value.Long   = (LONG)X;   break;
+         case eULONG:  value.ULong  = (ULONG)X;  break;
+         default:      value.Double = (DOUBLE)X; break;
+      }
+      return value;
+   }; // SlipPackedList::Value SlipPackedList::valueOf(const SlipDatum& X)
+
+   /**
+    * @brief SlipDatum for a packed value.
+    * @param[in] type (ClassType) value type
+    * @param[in] X (Value&) packed value
+    * @return SlipDatum with the value
+    */
+   SlipDatum SlipPackedList::datumOf(ClassType type, const Value& X) {         // SlipDatum of a packed value
+      switch(type) {
+         case eBOOL:   return SlipDatum(X.Bool);
+         case eCHAR:   return SlipDatum(X.Chr);
+         case eUCHAR:  return SlipDatum(X.UChr);
+         case eLONG:   return SlipDatum(X.Long);
+         case eULONG:  return SlipDatum(X.ULong);
+         default:      return SlipDatum(X.Double);
+      }
+   }; // SlipDatum SlipPackedList::datumOf(ClassType type, const Value& X)
+
+               /*****************************************
+                *           Private Functions           *
+               ******************************************/
+
+   /**
+    * @brief Insert a value on the list top or bottom.
+    * <p>A value of the list type is packed. A value of another type
+    *    converts the list to a linked list.</p>
+    * <p>Space for a push is made by moving the values up by at least the
+    *    number of values in the list, so that successive pushes take
+    *    constant time.</p>
+    * @param[in] type (ClassType) value type
+    * @param[in] X (Value&) value
+    * @param[in] top <b>true</b> insert on the list top
+    * @return reference to the list
+    */
+   SlipPackedList& SlipPackedList::insert(ClassType type, const Value& X, bool top) { // Insert a value on top or bottom
+      if ((linked == NULL) && (type != this->type) && (size() == 0) && (this->type == eUNDEFINED))
+         this->type = type;
+      if ((linked == NULL) && (type == this->type)) {
+         if (!top) {
+            values.push_back(X);
+         } else {
+            if (first == 0) {
+               unsigned room = (size() < PACKEDHEADROOM)? PACKEDHEADROOM: size();
+               values.insert(values.begin(), room, X);
+               first = room;
+            }
+            values[--first] = X;
+         }
+      } else {
+         unpack();
+         SlipDatum* datum = new SlipDatum(datumOf(type, X));
+         if (top) linked->push(*datum);
+         else     linked->enqueue(*datum);
+      }
+      return *this;
+   }; // SlipPackedList& SlipPackedList::insert(ClassType type, const Value& X, bool top)
+
+   /**
+    * @brief Convert the list to a linked list.
+    * <p>The packed values are moved to a new SlipHeader list and the packed
+    *    storage is released. A linked list is not changed.</p>
+    */
+   void SlipPackedList::unpack() {                                             // Convert to a linked list
+      if (linked != NULL) return;
+      linked = &toList();
+      vector<Value>().swap(values);
+      first = 0;
+   }; // void SlipPackedList::unpack()
+
+               /*****************************************
+                *            Public Functions           *
+               ******************************************/
+
+   /**
+    * @brief Insert X on the list bottom.
+    * <p>A numeric value of the list type is packed, any other value
+    *    converts the list to a linked list. A copy of X is inserted.</p>
+    * @param[in] X (SlipDatum&) value
+    * @return reference to the list
+    */
+   SlipPackedList& SlipPackedList::enqueue(const SlipDatum& X) {               // Insert X on bottom of list
+      if ((linked == NULL) && isPackedType(X.getClassType()))
+         return insert(X.getClassType(), valueOf(X), false);
+      unpack();
+      linked->enqueue(*new SlipDatum(X));
+      return *this;
+   }; // SlipPackedList& SlipPackedList::enqueue(const SlipDatum& X)
+
+   /**
+    * @brief Insert X on the list top.
+    * <p>A numeric value of the list type is packed, any other value
+    *    converts the list to a linked list. A copy of X is inserted.</p>
+    * @param[in] X (SlipDatum&) value
+    * @return reference to the list
+    */
+   SlipPackedList& SlipPackedList::push(const SlipDatum& X) {                  // Insert X on top of list
+      if ((linked == NULL) && isPackedType(X.getClassType()))
+         return insert(X.getClassType(), valueOf(X), true);
+      unpack();
+      linked->push(*new SlipDatum(X));
+      return *this;
+   }; // SlipPackedList& SlipPackedList::push(const SlipDatum& X)
+
+   /**
+    * @brief Remove and return the list bottom.
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E2008</b> dequeue of empty list not allowed.</li>
+    * </ul>
+    * @return list bottom
+    */
+   SlipDatum SlipPackedList::dequeue() {                                       // Remove and return list bottom
+      if (isEmpty()) {
+         postError(__FILE__, __LINE__, SlipErr::E2008, "SlipPackedList::dequeue", "", "");
+         return SlipDatum((LONG)0);
+      }
+      if (linked != NULL) {
+         SlipCell& cell = linked->dequeue();
+         SlipDatum datum((SlipDatum&)cell);
+         delete &cell;
+         return datum;
+      }
+      SlipDatum datum = datumOf(type, values.back());
+      values.pop_back();
+      if (isEmpty()) {
+         values.clear();
+         first = 0;
+      }
+      return datum;
+   }; // SlipDatum SlipPackedList::dequeue()
+
+   /**
+    * @brief Remove and return the list top.
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E2009</b> pop of empty list not allowed.</li>
+    * </ul>
+    * @return list top
+    */
+   SlipDatum SlipPackedList::pop() {                                           // Remove and return list top
+      if (isEmpty()) {
+         postError(__FILE__, __LINE__, SlipErr::E2009, "SlipPackedList::pop", "", "");
+         return SlipDatum((LONG)0);
+      }
+      if (linked != NULL) {
+         SlipCell& cell = linked->pop();
+         SlipDatum datum((SlipDatum&)cell);
+         delete &cell;
+         return datum;
+      }
+      SlipDatum datum = datumOf(type, values[first++]);
+      if (isEmpty()) {
+         values.clear();
+         first = 0;
+      }
+      return datum;
+   }; // SlipDatum SlipPackedList::pop()
+
+   /**
+    * @brief Return the n'th value, the list top is value 0.
+    * <p>A packed value is found by indexing. A linked list is walked.</p>
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3020</b> Unknown or illegal input argument. n is not less
+    *        than the list size.</li>
+    * </ul>
+    * @param[in] n (unsigned) value index
+    * @return the value
+    */
+   SlipDatum SlipPackedList::operator[](unsigned n) const {                    // Return the n'th value
+      if (n >= size()) {
+         postError(__FILE__, __LINE__, SlipErr::E3020, "SlipPackedList::operator[]", "", "");
+         return SlipDatum((LONG)0);
+      }
+      if (linked == NULL) return datumOf(type, values[first + n]);
+      SlipCellBase* link = linked->getRightLink();
+      for (; n > 0; n--) link = link->getRightLink();
+      return SlipDatum((SlipDatum&)*link);
+   }; // SlipDatum SlipPackedList::operator[](unsigned n) const
+
+   /**
+    * @brief Packed values from the list top to the list bottom.
+    * <p>The storage is valid until the list is changed. The value field to
+    *    use is given by <b>getType()</b>.</p>
+    * @return packed values, NULL for an empty or linked list
+    */
+   const SlipPackedList::Value* SlipPackedList::data() const {                 // Packed values, top first
+      return ((linked != NULL) || isEmpty())? NULL: &values[first];
+   }; // const SlipPackedList::Value* SlipPackedList::data() const
+
+   /**
+    * @brief Number of values in the list.
+    * @return number of values
+    */
+   unsigned SlipPackedList::size() const {                                     // Number of values in list
+      return (linked != NULL)? linked->size(): values.size() - first;
+   }; // unsigned SlipPackedList::size() const
+
+   /**
+    * @brief Linked copy of the list.
+    * <p>The copy is a SlipHeader list which can be traversed with a
+    *    SlipReader or SlipSequencer and written. The user is responsible
+    *    for deleting the list.</p>
+    * @return reference to a new list
+    */
+   SlipHeader& SlipPackedList::toList() const {                                // Linked copy of the list
+      SlipHeader* list = new SlipHeader();
+      if (linked != NULL) {
+         for (SlipCellBase* link = linked->getRightLink(); !link->isHeader(); link = link->getRightLink())
+            list->enqueue(*(SlipCell*)link);
+      } else {
+         for (unsigned i = first; i < values.size(); i++)
+            list->enqueue(*new SlipDatum(datumOf(type, values[i])));
+      }
+      return *list;
+   }; // SlipHeader& SlipPackedList::toList() const
+
+   /**
+    * @brief Output the list.
+    * <p>The list is written as a SlipHeader list, so that SlipRead reads
+    *    it back as a list which <b>SlipPackedList(SlipHeader&)</b> packs.</p>
+    * @param[in] out (ostream&) output stream
+    * @return <b>true</b>
+    */
+   bool SlipPackedList::write(ostream& out) const {                            // Output the list
+      SlipHeader& list = toList();
+      bool flag = list.write(out);
+      list.deleteList();
+      return flag;
+   }; // bool SlipPackedList::write(ostream& out) const
+
+   /**
+    * @brief Return an ASCII formated list as a string.
+    * @return formatted list
+    */
+   string SlipPackedList::writeToString() const {                              // Return an ASCII formated list as a string
+      SlipHeader& list = toList();
+      string str = list.writeToString();
+      list.deleteList();
+      return str;
+   }; // string SlipPackedList::writeToString() const
+
+}; // namespace slip
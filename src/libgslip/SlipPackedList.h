@@ -0,0 +1,122 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file    SlipPackedList.h
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+#ifndef _SLIPPACKEDLIST_H
+#define	_SLIPPACKEDLIST_H
+
+# include <ostream>
+# include <string>
+# include <vector>
+# include "SlipDef.h"
+# include "SlipDatum.h"
+# include "SlipHeader.h"
+
+using namespace std;
+
+namespace slip {
+
+   /**
+    * @class SlipPackedList
+    * @brief A list of numeric values of one type held in contiguous storage.
+    * <p>A list of <em>n</em> numbers takes <em>n</em> SLIP cells. A packed
+    *    list holds each number in 8 bytes with no links, so that a scan
+    *    touches consecutive memory and the list is about a fifth of the
+    *    size of the linked list.</p>
+    * <p>The list type is one of bool, CHAR, UCHAR, LONG, ULONG or DOUBLE
+    *    and is set by the constructor or by the first value inserted. A
+    *    value of another type makes the list convert itself to a linked
+    *    SlipHeader list, and all operations are then done on that list.</p>
+    * <p>Traversal with a SlipReader or SlipSequencer, and output, use a
+    *    linked copy of the list made by <b>toList()</b>. A list read by
+    *    SlipRead is packed by <b>SlipPackedList(SlipHeader&)</b>.</p>
+    * <pre>
+    *    SlipPackedList series(eDOUBLE);
+    *    for (int i = 0; i < 1000000; i++) series.enqueue((DOUBLE)i);
+    *    const SlipPackedList::Value* value = series.data();
+    * </pre>
+    */
+   class SlipPackedList {
+   public:
+      union Value {                                                             //!< one packed value
+         bool   Bool;                                                           //!< bool value
+         UCHAR  UChr;                                                           //!< UCHAR value
+         CHAR   Chr;                                                            //!< CHAR value
+         ULONG  ULong;                                                          //!< ULONG value
+         LONG   Long;                                                           //!< LONG value
+         DOUBLE Double;                                                         //!< DOUBLE value
+      }; // union Value
+   private:
+      ClassType      type;                                                      // type of the packed values
+      vector<Value>  values;                                                    // packed values from first
+      unsigned       first;                                                     // index of the list top in values
+      SlipHeader*    linked;                                                    // linked list, NULL when packed
+
+      SlipPackedList(const SlipPackedList& orig) { };                           // Copy constructor not allowed
+      SlipPackedList&  insert(ClassType type, const Value& X, bool top);        // Insert a value on top or bottom
+      void           unpack();                                                  // Convert to a linked list
+   public:
+      static bool      isPackedType(ClassType type);                            // true for a packable type
+      static Value     valueOf(const SlipDatum& X);                             // packed value of X
+      static SlipDatum datumOf(ClassType type, const Value& X);                 // SlipDatum of a packed value
+
+      SlipPackedList(ClassType type = eUNDEFINED);                              // Empty list
+      SlipPackedList(const SlipHeader& list);                                   // Packed copy of a list
+      ~SlipPackedList();
+
+      SlipPackedList& enqueue(const SlipDatum& X);                              // Insert X on bottom of list
+      SlipPackedList& enqueue(bool   X) { Value v; v.Bool   = X; return insert(eBOOL,   v, false); }
+      SlipPackedList& enqueue(UCHAR  X) { Value v; v.UChr   = X; return insert(eUCHAR,  v, false); }
+      SlipPackedList& enqueue(CHAR   X) { Value v; v.Chr    = X; return insert(eCHAR,   v, false); }
+      SlipPackedList& enqueue(ULONG  X) { Value v; v.ULong  = X; return insert(eULONG,  v, false); }
+      SlipPackedList& enqueue(LONG   X) { Value v; v.Long   = X; return insert(eLONG,   v, false); }
+      SlipPackedList& enqueue(DOUBLE X) { Value v; v.Double = X; return insert(eDOUBLE, v, false); }
+      SlipPackedList& push(const SlipDatum& X);                                 // Insert X on top of list
+      SlipPackedList& push(bool   X)    { Value v; v.Bool   = X; return insert(eBOOL,   v, true);  }
+      SlipPackedList& push(UCHAR  X)    { Value v; v.UChr   = X; return insert(eUCHAR,  v, true);  }
+      SlipPackedList& push(CHAR   X)    { Value v; v.Chr    = X; return insert(eCHAR,   v, true);  }
+      SlipPackedList& push(ULONG  X)    { Value v; v.ULong  = X; return insert(eULONG,  v, true);  }
+      SlipPackedList& push(LONG   X)    { Value v; v.Long   = X; return insert(eLONG,   v, true);  }
+      SlipPackedList& push(DOUBLE X)    { Value v; v.Double = X; return insert(eDOUBLE, v, true);  }
+      SlipDatum         dequeue();                                              // Remove and return list bottom
+      SlipDatum         pop();                                                  // Remove and return list top
+
+      SlipDatum         operator[](unsigned n) const;                           // Return the n'th value
+      const Value*      data() const;                                           // Packed values, top first
+
+      ClassType         getType() const { return type; }                        // Type of the packed values
+      bool              isEmpty() const { return size() == 0; }                 // true if the list is empty
+      bool              isPacked() const { return linked == NULL; }             // true if the list is packed
+      unsigned          size() const;                                           // Number of values in list
+      SlipHeader&       toList() const;                                         // Linked copy of the list
+      bool              write(ostream& out) const;                              // Output the list
+      string            writeToString() const;                                  // Return an ASCII formated list as a string
+   }; // class SlipPackedList
+}; // namespace slip
+
+#endif	/* _SLIPPACKEDLIST_H */
@@ -89,4 +89,22 @@ namespace slip {
     * @return (string*) containing the User Definition Data name
     */
    const string* const SlipPointer::getName() const { return name; }
+
+   /**
+    * @brief Return the borrowed string held by the object.
+    * <p>The default User Defined Data object holds no string.</p>
+    * @return NULL
+    */
+   const string* SlipPointer::view() const { return NULL; }
+
+   /**
+    * @brief Put the User Defined Data into a list for a binary write.
+    * <p>SlipWriteBinary writes the list in place of the ASCII string from
+    *    <em>write()</em> and SlipReadBinary passes the list read to the
+    *    User Data parse method. The default User Defined Data object has
+    *    no binary form, the list is not changed.</p>
+    * @param[out] list (SlipHeader&) empty list to receive the contents
+    * @return <b>false</b>
+    */
+   bool SlipPointer::toList(SlipHeader& list) const { return false; }
 } // namespace slip
@@ -120,6 +120,9 @@ namespace slip {
  *    <li><b>getName</b> returns the User Defined Data name.</li>
  *    <li><b>remove</b> deletes the User Defined Data object.</li>
  *    <li><b>toString</b> returns a prettyfied string of the User Defined Data.</li>
+ *    <li><b>toList</b> puts the User Defined Data into a list for the binary
+ *        output method. The list is given to the parse method when the
+ *        binary list file is read. The default returns <b>false</b>.</li>
  * </ul>
  * <p><b>Required Methods</b></p><hr>
  * <p><b>static SlipCatum& parse(SlipHeader& head)</b>
@@ -233,6 +236,13 @@ namespace slip {
  * </ol>
  * @return string formatted for a write
  * 
+ * @fn view() const
+ * @brief Return a pointer to the string held by the object.
+ * <p>The string is borrowed, it is owned by the object and is valid
+ *    while the object is. Objects which do not hold a string return
+ *    NULL, the default. Used to compare strings without a copy.</p>
+ * @return borrowed string or NULL
+ *
  * @fn toString() const
  * @brief Return a pretty version of the User Defined Data object.
  * <p>It is  expected that the string can be output to a file and
@@ -261,7 +271,9 @@ namespace slip {
       virtual Parse  getParse() = 0;                                            // return a pointer to the parse method
       virtual void   remove() const = 0;                                        // delete object and/or contents
       virtual string toString() const = 0;                                      // pretty-print contents
+      virtual bool   toList(SlipHeader& list) const;                            // contents for a binary write
       const   string* const getName() const;                                    // return the object pointer
+      virtual const string* view() const;                                       // borrowed string contents or NULL
       virtual string  write() const = 0;                                        // string formatted for a write
    }; // class SlipPointer
 } // namespace slip
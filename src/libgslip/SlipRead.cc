@@ -29,8 +29,12 @@
  *
  */
 
+# include <algorithm>
 # include <istream>
 # include <cstdarg>
+# include <fstream>
+# include <sstream>
+# include <thread>
 # include "lex.Slip.h"
 # include "Slip.Bison.hpp"
 # include "SlipDatum.h"
@@ -64,7 +68,9 @@ namespace slip {
                                      , inputDebugFlag((bool)(debugFlag & SlipRead::INPUT))
                                      , leakDebugFlag((bool)(debugFlag & SlipRead::LEAK))
                                      , lexerDebugFlag((bool)(debugFlag & SlipRead::LEXER))
-                                     , parserDebugFlag((bool)(debugFlag & SlipRead::PARSER)) {
+                                     , parserDebugFlag((bool)(debugFlag & SlipRead::PARSER))
+                                     , parallelFlag(false)
+                                     , threads(0) {
    }; // SlipRead::SlipRead(int debugFlag)
 
    /**
@@ -82,7 +88,9 @@ namespace slip {
                                            , inputDebugFlag((bool)(debugFlag & SlipRead::INPUT))
                                            , leakDebugFlag((bool)(debugFlag & SlipRead::LEAK))
                                            , lexerDebugFlag((bool)(debugFlag & SlipRead::LEXER))
-                                           , parserDebugFlag((bool)(debugFlag & SlipRead::PARSER)) {
+                                           , parserDebugFlag((bool)(debugFlag & SlipRead::PARSER))
+                                           , parallelFlag(false)
+                                           , threads(0) {
       registerUserData(userData);
    }; // SlipRead::SlipRead(SlipDatum& userData, int universalDeubg)
 
@@ -102,7 +110,9 @@ namespace slip {
                                            , inputDebugFlag((bool)(debugFlag & SlipRead::INPUT))
                                            , leakDebugFlag((bool)(debugFlag & SlipRead::LEAK))
                                            , lexerDebugFlag((bool)(debugFlag & SlipRead::LEXER))
-                                           , parserDebugFlag((bool)(debugFlag & SlipRead::PARSER)) {
+                                           , parserDebugFlag((bool)(debugFlag & SlipRead::PARSER))
+                                           , parallelFlag(false)
+                                           , threads(0) {
       registerUserData(size, userData);
    }; // SlipRead::SlipRead(const int size, SlipDatum const userData[], int debugFlag)
 
@@ -122,7 +132,9 @@ namespace slip {
                                            , inputDebugFlag((bool)(debugFlag & SlipRead::INPUT))
                                            , leakDebugFlag((bool)(debugFlag & SlipRead::LEAK))
                                            , lexerDebugFlag((bool)(debugFlag & SlipRead::LEXER))
-                                           , parserDebugFlag((bool)(debugFlag & SlipRead::PARSER)) {
+                                           , parserDebugFlag((bool)(debugFlag & SlipRead::PARSER))
+                                           , parallelFlag(false)
+                                           , threads(0) {
       registerUserData(size, userData);
    }; // SlipRead::SlipRead(const int size, SlipDatum  * const userData[], int debugFlag)
 
@@ -143,6 +155,131 @@ namespace slip {
       delete reg;
    }; // SlipRead::~SlipRead()
 
+   /*********************************************************
+    *                   Private Functions                   *
+   **********************************************************/
+
+   /**
+    * @brief Diagnostic callback for include files parsed in advance.
+    * <p>The message is not output and the parse is abandoned. The include
+    *    file is parsed again in place and the message is output then.</p>
+    * @return <b>true</b> abandon the parse
+    */
+   static bool abandonInclude(string filename, int lineno, SlipErr::Error err, string message) {
+      return true;
+   }; // static bool abandonInclude(string filename, int lineno, SlipErr::Error err, string message)
+
+   /**
+    * @brief Find the <b>\#include</b> directives of a list file.
+    * <p>The path of each directive outside a comment, string or character
+    *    is returned once in the order found.</p>
+    * @param[in] text (string&) list file text
+    * @return include file paths
+    */
+   static vector<string> findIncludes(const string& text) {
+      vector<string> paths;
+      const size_t size = text.size();
+      size_t ndx = 0;
+      while (ndx < size) {
+         char c = text[ndx];
+         if ((c == '/') && (ndx + 1 < size) && (text[ndx + 1] == '/')) {
+            ndx = text.find('\n', ndx);
+            if (ndx == string::npos) break;
+         } else if ((c == '/') && (ndx + 1 < size) && (text[ndx + 1] == '*')) {
+            ndx = text.find("*/", ndx + 2);
+            if (ndx == string::npos) break;
+            ndx += 2;
+         } else if ((c == '"') || (c == '\'')) {
+            for (ndx++; (ndx < size) && (text[ndx] != c); ndx++)
+               if (text[ndx] == '\\') ndx++;
+            ndx++;
+         } else if (c == '#') {
+            size_t pos = text.find_first_not_of(" \t\r\n", ndx + 1);
+            if ((pos != string::npos) && (text.compare(pos, 7, "include") == 0)) {
+               pos = text.find_first_not_of(" \t\r\n", pos + 7);
+               if ((pos != string::npos) && (text[pos] == '"')) {
+                  size_t end = text.find('"', pos + 1);
+                  if (end == string::npos) break;
+                  string path = text.substr(pos + 1, end - pos - 1);
+                  if (find(paths.begin(), paths.end(), path) == paths.end())
+                     paths.push_back(path);
+                  ndx = end;
+               }
+            }
+            ndx++;
+         } else ndx++;
+      }
+      return paths;
+   }; // static vector<string> findIncludes(const string& text)
+
+   /**
+    * @brief Parse the include files of a list file in advance.
+    * <p>The list file is scanned for <b>\#include</b> directives and the
+    *    include files are parsed on worker threads. The register of each
+    *    successful parse is saved with the include file path, a failed
+    *    parse saves <b>NULL</b>. Nothing is done if the list file can not
+    *    be read, the read in place reports it.</p>
+    * @param[in] filename (string&) list file name
+    * @param[out] includes (map&) include file path and register
+    */
+   void SlipRead::loadIncludes(const string& filename, map<string, SlipRegister*>& includes) {
+      ifstream in(filename.c_str());
+      if (!in) return;
+      stringstream text;
+      text << in.rdbuf();
+      vector<string> paths = findIncludes(text.str());
+      if (paths.empty()) return;
+
+      vector<SlipRegister*> results(paths.size(), (SlipRegister*)NULL);
+      atomic<size_t> next(0);
+      unsigned size = (threads)? threads: thread::hardware_concurrency();
+      if (size == 0) size = 1;
+      if (size > paths.size()) size = paths.size();
+      vector<thread> workers;
+      for (unsigned i = 0; i < size; i++)
+         workers.push_back(thread(parseIncludes, this, &paths, &results, &next));
+      for (unsigned i = 0; i < size; i++)
+         workers[i].join();
+      for (size_t i = 0; i < paths.size(); i++)
+         includes[paths[i]] = results[i];
+   }; // void SlipRead::loadIncludes(const string& filename, map<string, SlipRegister*>& includes)
+
+   /**
+    * @brief Worker thread parse of include files.
+    * <p>Include file paths are taken in turn until none are left. Each is
+    *    parsed by a reader with the User Data entries of the master
+    *    reader. Diagnostics are not output and abandon the parse. The
+    *    reader register is kept if the parse has no diagnostic and the
+    *    include file has no list outside a named list definition.</p>
+    * @param[in] master (SlipRead*) reader of the list file
+    * @param[in] paths (vector*) include file paths
+    * @param[out] results (vector*) register for each path or <b>NULL</b>
+    * @param[in,out] next (atomic*) index of the next path
+    */
+   void SlipRead::parseIncludes(const SlipRead* master, const vector<string>* paths
+                               , vector<SlipRegister*>* results, atomic<size_t>* next) {
+      errorCallback callBack = userThreadCallBack(abandonInclude);
+      setLexerQuietON();
+      for (size_t ndx = (*next)++; ndx < paths->size(); ndx = (*next)++) {
+         SlipRead reader(master->debugFlag);
+         reader.reg->copyUserData(*master->reg);
+         try {
+            SlipHeader& head = reader.read((*paths)[ndx]);
+            bool empty = head.isEmpty();
+            head.deleteList();
+            if (empty && (reader.getError() == 0) && (getLexerMessageCount() == 0)) {
+               (*results)[ndx] = reader.reg;
+               reader.reg = new SlipRegister(master->debugFlag);
+            }
+         } catch (...) {
+            deleteLexState();
+         }
+         setLexerQuietON();
+      }
+      setLexerQuietOFF();
+      userThreadCallBack(callBack);
+   }; // void SlipRead::parseIncludes(const SlipRead* master, ...)
+
    /*********************************************************
     *                        Methods                        *
    **********************************************************/
@@ -176,11 +313,13 @@ namespace slip {
     * <p>The list file is parsed and the return value saved in a local
     *    variable. If the parse was unsuccessful, an empty list is
     *    returned.</p>
+    * @param[in] includes (map*) include files parsed in advance or <b>NULL</b>
     * @return list (SlipHeader*) pointer.
     */
-   SlipHeader& SlipRead::parse() {
-      SlipHeader* head;
+   SlipHeader& SlipRead::parse(map<string, SlipRegister*>* includes) {
+      SlipHeader* head = NULL;
       SlipInputMethods* methods = new SlipInputMethods(reg, debugFlag);
+      methods->setIncludes(includes);
       parser parser(&head, methods);
       DEBUG(parserDebugFlag, parser.set_debug_level(1);)
       DEBUG(lexerDebugFlag, ::setLexerDebugON();)
@@ -202,17 +341,56 @@ namespace slip {
     * <p>Parser operation is initialized and the list file is opened.
     *    If either operation fails, an empty list is returned and an
     *    error value is saved in a class variable.</p>
+    * <p>With parallel loading on, the include files are parsed in
+    *    advance and an include file register which is not merged during
+    *    the parse is deleted.</p>
     * @param filename (string) file name and path to be opened.
     * @return list pointer
     */
    SlipHeader& SlipRead::read(string filename) {
+      map<string, SlipRegister*> includes;
+      if (parallelFlag) loadIncludes(filename, includes);
+      SlipHeader* head;
       if (saveLexState(filename)) {
+         head = &parse((parallelFlag)? &includes: NULL);
+      } else {
+         errorReturn = 2;
+         head = new SlipHeader();
+      }
+      for (map<string, SlipRegister*>::iterator it = includes.begin(); it != includes.end(); it++)
+         delete it->second;
+      return *head;
+   }; // SlipHeader& SlipRead::read()
+
+   /**
+    * @brief Read a list file from an input stream.
+    * <p>The stream is read to its end into the scanner buffer and parsed.
+    *    If the stream can not be read, an empty list is returned and the
+    *    error value is '2'.</p>
+    * @param in (istream&) input stream
+    * @return list
+    */
+   SlipHeader& SlipRead::read(istream& in) {
+      if (saveLexState("<stream>", in)) {
          return parse();
       } else {
          errorReturn = 2;
          return *new SlipHeader();
       }
-   }; // SlipHeader& SlipRead::read()
+   }; // SlipHeader& SlipRead::read(istream& in)
+
+   /**
+    * @brief Read a list file from a character buffer.
+    * <p>The buffer is copied into the scanner buffer and parsed. The
+    *    buffer need not be terminated and is not changed.</p>
+    * @param buffer (const char*) list file characters
+    * @param length (size_t) number of characters in the buffer
+    * @return list
+    */
+   SlipHeader& SlipRead::read(const char* buffer, size_t length) {
+      saveLexState("<buffer>", buffer, length);
+      return parse();
+   }; // SlipHeader& SlipRead::read(const char* buffer, size_t length)
 
    /**
     * @brief Register the name and parse method for a User Data class.
@@ -285,4 +463,25 @@ namespace slip {
       reg->setDebugON(debugFlag);
    }; // void SlipRead::setDebugON()
 
+   /**
+    * @brief Parse include files in place.
+    */
+   void SlipRead::setParallelOFF() {
+      parallelFlag = false;
+   }; // void SlipRead::setParallelOFF()
+
+   /**
+    * @brief Parse the include files of a list file in advance.
+    * <p>A list file read by name has its include files parsed on worker
+    *    threads before it is parsed. Independent include files are parsed
+    *    concurrently and their named lists merged when the include
+    *    directive is parsed.</p>
+    * @param[in] threads (unsigned) maximum worker threads, 0 is the
+    *            hardware concurrency
+    */
+   void SlipRead::setParallelON(unsigned threads) {
+      parallelFlag = true;
+      this->threads = threads;
+   }; // void SlipRead::setParallelON(unsigned threads)
+
 }; // namespace slip
\ No newline at end of file
@@ -32,6 +32,11 @@
 #ifndef SLIPREAD_H
 #define	SLIPREAD_H
 
+# include <atomic>
+# include <istream>
+# include <map>
+# include <string>
+# include <vector>
 # include "SlipDatum.h"
 # include "SlipHeader.h"
 # include "SlipRegister.h"
@@ -65,8 +70,14 @@ namespace slip {
     *       <li>One or more errors detected during parsing the input list file.</li>
     *       <li>Unable to open the input list file.</li>
     *    </ol>
-    *    <li><b>read()</b> Read the input list file.</li>
+    *    <li><b>read()</b> Read the input list file, an input stream or a
+    *        character buffer. A stream or buffer is scanned in memory
+    *        without an intermediate file, an include in it is relative
+    *        to the current directory.</li>
     *    <li><b>registerUserData()</b> Register User Data parse functions.</li>
+    *    <li><b>setParallelON()</b> Parse the include files of a list file
+    *        on worker threads before the list file is parsed.</li>
+    *    <li><b>setParallelOFF()</b> Parse include files in place.</li>
     * </ul>
     * <p><b>Examples</b></p>
     * <p>We assume throughout that:</p>
@@ -170,6 +181,19 @@ namespace slip {
     *    <li>The read, parse, register, and lex methods are flagrantly abusive
     *        of the heap. Be cautious in reading an input file in an embedded
     *        system or in any time sensitive environment.</li>
+    *    <li>The scanner state is held per thread. SlipRead objects on
+    *        different threads read concurrently. A SlipRead object must
+    *        be read and deleted on the same thread, and one thread reads
+    *        one list file at a time.</li>
+    *    <li>With parallel loading on, the <b>\#include</b> directives of a
+    *        list file read by name are found before parsing. Each include
+    *        file is parsed on a worker thread into its own register and
+    *        the named lists are merged into the register when the
+    *        directive is parsed. An include file whose names are already
+    *        defined, which references names it does not define, or which
+    *        has any diagnostic is parsed in place, and the diagnostics are
+    *        those of a serial read. User Data parse functions are called
+    *        on the worker threads and must be thread safe.</li>
     * </ol>
     * <b>Description of the SLIP input grammar</b>
     * <pre><tt>
@@ -386,9 +410,14 @@ namespace slip {
       bool leakDebugFlag;                                                       //!< check for memory leaks
       bool lexerDebugFlag;                                                      //!< lexer debug
       bool parserDebugFlag;                                                     //!< Parser debug
+      bool parallelFlag;                                                        //!< parse include files in advance
+      unsigned threads;                                                         //!< worker threads, 0 is hardware concurrency
    private:
       SlipRead(const SlipRead& orig);
-      SlipHeader& parse();
+      void loadIncludes(const string& filename, map<string, SlipRegister*>& includes);
+      SlipHeader& parse(map<string, SlipRegister*>* includes = NULL);
+      static void parseIncludes(const SlipRead* master, const vector<string>* paths
+                               , vector<SlipRegister*>* results, atomic<size_t>* next);
    public:
       enum { INPUT  = 0x01                                                      //!< debug inputt
            , PARSER = 0x02                                                      //!< debug parser
@@ -405,11 +434,15 @@ namespace slip {
       ~SlipRead();
       int getError();
       SlipHeader& read(string filename);
+      SlipHeader& read(istream& in);
+      SlipHeader& read(const char* buffer, size_t length);
       bool registerUserData(const SlipDatum& userData);
       bool registerUserData(const int size, SlipDatum  * const userData[]);
       bool registerUserData(const int size, SlipDatum const userData[]);
       void setDebugOFF(int debugFlag = 0);
       void setDebugON(int debugFlag = INPUT);
+      void setParallelOFF();
+      void setParallelON(unsigned threads = 0);
       
    }; // class SlipRead
 }
@@ -0,0 +1,477 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+
+/**
+ * @file    SlipReadBinary.cc
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+ # include <algorithm>
+ # include <cstring>
+ # include <fstream>
+ # include <string>
+ # include "SlipReadBinary.h"
+ # include "SlipErr.h"
+ # include "SlipWriteBinary.h"
+
+namespace slip {
+
+   /*********************************************************
+    *               Constructors & Destructors              *
+   **********************************************************/
+
+   /**
+    * @brief Constructor.
+    * <p>Creates the register for recording User Data parse methods.</p>
+    * @param[in] debugFlag (int) debug mask
+    */
+   SlipReadBinary::SlipReadBinary(int debugFlag) : reg(new SlipRegister(debugFlag))
+                                                 , errorReturn(0), in(NULL), block(NULL)
+                                                 , pos(0), fill(0), swap(false) {
+   }; // SlipReadBinary::SlipReadBinary(int debugFlag)
+
+   /**
+    * @brief Constructor.
+    * <p>Creates the register for recording User Data parse methods and
+    *    populates the register with a single User Data parse method.</p>
+    * @param[in] userData (SlipDatum&) User Data object
+    * @param[in] debugFlag (int) debug mask
+    */
+   SlipReadBinary::SlipReadBinary(SlipDatum& userData, int debugFlag)
+                                 : reg(new SlipRegister(debugFlag))
+                                 , errorReturn(0), in(NULL), block(NULL)
+                                 , pos(0), fill(0), swap(false) {
+      registerUserData(userData);
+   }; // SlipReadBinary::SlipReadBinary(SlipDatum& userData, int debugFlag)
+
+   /**
+    * @brief Constructor.
+    * <p>Creates the register for recording User Data parse methods and
+    *    populates the register with multiple User Data parse methods.</p>
+    * @param[in] size (int) number of User Data objects
+    * @param[in] userData (SlipDatum []) list of User Data objects
+    * @param[in] debugFlag (int) debug mask
+    */
+   SlipReadBinary::SlipReadBinary(const int size, SlipDatum const userData[], int debugFlag)
+                                 : reg(new SlipRegister(debugFlag))
+                                 , errorReturn(0), in(NULL), block(NULL)
+                                 , pos(0), fill(0), swap(false) {
+      registerUserData(size, userData);
+   }; // SlipReadBinary::SlipReadBinary(const int size, SlipDatum const userData[], int debugFlag)
+
+   /**
+    * @brief Constructor.
+    * <p>Creates the register for recording User Data parse methods and
+    *    populates the register with multiple User Data parse methods.</p>
+    * @param[in] size (int) number of User Data objects
+    * @param[in] userData (SlipDatum* []) list of pointers to User Data objects
+    * @param[in] debugFlag (int) debug mask
+    */
+   SlipReadBinary::SlipReadBinary(const int size, SlipDatum  * const userData[], int debugFlag)
+                                 : reg(new SlipRegister(debugFlag))
+                                 , errorReturn(0), in(NULL), block(NULL)
+                                 , pos(0), fill(0), swap(false) {
+      registerUserData(size, userData);
+   }; // SlipReadBinary::SlipReadBinary(const int size, SlipDatum  * const userData[], int debugFlag)
+
+   /**
+    * @brief Copy constructor.
+    * <p>This is not available for use.</p>
+    * @param orig (SlipReadBinary&) reference to SlipReadBinary object
+    */
+   SlipReadBinary::SlipReadBinary(const SlipReadBinary& orig) {
+   }; // SlipReadBinary::SlipReadBinary(const SlipReadBinary& orig)
+
+   /**
+    * @brief Destructor.
+    * <p>Deletes the register.</p>
+    */
+   SlipReadBinary::~SlipReadBinary() {
+      delete reg;
+   }; // SlipReadBinary::~SlipReadBinary()
+
+   /*********************************************************
+    *                   Protected Methods                   *
+   **********************************************************/
+
+   /**
+    * @brief Copy bytes from the input block.
+    * <p>A new block is input from the stream when the current block is
+    *    used. Without a stream the block is the whole input.</p>
+    * @param[out] value (void*) destination
+    * @param[in] length (size_t) number of bytes
+    * @return <b>false</b> the input ended before all bytes were copied
+    */
+   bool SlipReadBinary::get(void* value, size_t length) {                       // Input bytes
+      if (length <= fill - pos) {
+         memcpy(value, block + pos, length);
+         pos += length;
+         return true;
+      }
+      char* dest = (char*)value;
+      while (length > 0) {
+         if (pos == fill) {
+            if ((in == NULL) || !in->good()) return false;
+            in->read(buffer.data(), buffer.size());
+            fill = in->gcount();
+            pos  = 0;
+            if (fill == 0) return false;
+         }
+         size_t count = min(length, fill - pos);
+         memcpy(dest, block + pos, count);
+         pos    += count;
+         dest   += count;
+         length -= count;
+      }
+      return true;
+   }; // bool SlipReadBinary::get(void* value, size_t length)
+
+   /**
+    * @brief Return the list with a list number.
+    * <p>List numbers are given in the order lists are referenced, and the
+    *    file is input in the order it was output. A list number is either
+    *    a known list or the next list, which is created.</p>
+    * @param[in] number (ULONG) list number
+    * @return list header or <b>NULL</b> if the list number is not valid
+    */
+   SlipHeader* SlipReadBinary::getList(ULONG number) {                          // Return list by list number
+      if (number < lists.size()) return lists[number];
+      if (number > lists.size()) return NULL;
+      lists.push_back(new SlipHeader());
+      return lists.back();
+   }; // SlipHeader* SlipReadBinary::getList(ULONG number)
+
+   /**
+    * @brief Replace User Data place holders.
+    * <p>Each place holder is replaced by the cell returned by the parse
+    *    method. The parse method owns the User Data list.</p>
+    * @param[in,out] entries (vector&lt;UserData&gt;&) place holders, emptied
+    */
+   void SlipReadBinary::parseUserData(vector<UserData>& entries) {              // Replace User Data place holders
+      for (size_t i = 0; i < entries.size(); i++) {
+         UserData& entry = entries[i];
+         string    name  = (entry.name < names.size())? names[entry.name]: "";
+         Parse     fnc   = reg->getParse(name);
+         if (fnc == NULL) {
+            errorReturn = 1;
+            postError(__FILE__, __LINE__, SlipErr::E4005, "SlipReadBinary::read", "", name);
+            entry.list->deleteList();
+         } else {
+            entry.cell->insLeft(fnc(*entry.list));                              // parse owns the list
+         }
+         delete &entry.cell->unLink();
+      }
+      entries.clear();
+   }; // void SlipReadBinary::parseUserData(vector<UserData>& entries)
+
+   /**
+    * @brief Input the user mark, descriptor list and cells of a list.
+    * @param[in] header (SlipHeader&) list receiving the input
+    * @return <b>false</b> the input is not valid
+    */
+   bool SlipReadBinary::readBody(SlipHeader& header) {                          // Input a list body
+      USHORT mark;
+      UCHAR  dList;
+      if (!get(mark) || !get(dList) || (dList > 1)) return false;
+      header.putMark(mark);
+      if (dList && !readBody(header.create_dList())) return false;
+      for(;;) {
+         UCHAR type;
+         if (!get(type)) return false;
+         switch(type) {
+            case eUNDEFINED:
+               return true;
+            case eBOOL: {
+               UCHAR value;
+               if (!get(value)) return false;
+               header.enqueue((bool)value);
+               break;
+            }
+            case eCHAR: {
+               CHAR value;
+               if (!get(value)) return false;
+               header.enqueue(value);
+               break;
+            }
+            case eUCHAR: {
+               UCHAR value;
+               if (!get(value)) return false;
+               header.enqueue(value);
+               break;
+            }
+            case eLONG: {
+               LONG value;
+               if (!get(value)) return false;
+               header.enqueue(value);
+               break;
+            }
+            case eULONG: {
+               ULONG value;
+               if (!get(value)) return false;
+               header.enqueue(value);
+               break;
+            }
+            case eDOUBLE: {
+               DOUBLE value;
+               if (!get(value)) return false;
+               header.enqueue(value);
+               break;
+            }
+            case eSTRING: {
+               ULONG  length;
+               string str;
+               if (!get(length)) return false;
+               while (str.size() < length) {                                    // grow with the input, not the length
+                  size_t start = str.size();
+                  str.resize(start + min((size_t)(length - start), (size_t)SlipWriteBinary::BUFSIZE));
+                  if (!get(&str[start], str.size() - start)) return false;
+               }
+               header.enqueue(str);
+               break;
+            }
+            case eSUBLIST: {
+               ULONG number;
+               if (!get(number)) return false;
+               SlipHeader* sublist = getList(number);
+               if (sublist == NULL) return false;
+               header.enqueue(*sublist);
+               break;
+            }
+            case ePTR:
+               if (!readUserData(header)) return false;
+               break;
+            default:
+               return false;
+         }
+      }
+   }; // bool SlipReadBinary::readBody(SlipHeader& header)
+
+   /**
+    * @brief Input and check the file identification.
+    * <p>A file written with the other byte order sets the byte order to
+    *    be reversed on input.</p>
+    * @return <b>false</b> the input is not a binary list file
+    */
+   bool SlipReadBinary::readHeader() {                                          // Input the file identification
+      char  magic[sizeof(SlipWriteBinary::MAGIC)];
+      UCHAR version;
+      ULONG order;
+      swap = false;
+      if (!get(magic, sizeof(magic)) || !get(version) || !get(order)) return false;
+      if (memcmp(magic, SlipWriteBinary::MAGIC, sizeof(magic)) || (version != SlipWriteBinary::VERSION))
+         return false;
+      if (order != SlipWriteBinary::ORDER) {
+         reverse((char*)&order, sizeof(order));
+         swap = true;
+      }
+      return order == SlipWriteBinary::ORDER;
+   }; // bool SlipReadBinary::readHeader()
+
+   /**
+    * @brief Input the User Data names.
+    * @return <b>false</b> the input is not valid
+    */
+   bool SlipReadBinary::readNames() {                                           // Input the User Data names
+      ULONG count;
+      if (!get(count)) return false;
+      names.clear();
+      for (ULONG i = 0; i < count; i++) {
+         USHORT length;
+         if (!get(length)) return false;
+         string name(length, ' ');
+         if (!get(&name[0], length)) return false;
+         names.push_back(name);
+      }
+      return true;
+   }; // bool SlipReadBinary::readNames()
+
+   /**
+    * @brief Input a User Data cell.
+    * <p>The User Data list is input and a cell is put in the list to hold
+    *    the place of the User Data cell. The parse method is called after
+    *    the User Data names are input.</p>
+    * @param[in] header (SlipHeader&) list receiving the input
+    * @return <b>false</b> the input is not valid
+    */
+   bool SlipReadBinary::readUserData(SlipHeader& header) {                      // Input a User Data cell
+      ULONG number;
+      if (!get(number)) return false;
+      header.enqueue(false);
+      UserData entry = { &header.getBot(), new SlipHeader(), number };
+      userData.push_back(entry);
+      return readBody(*entry.list);
+   }; // bool SlipReadBinary::readUserData(SlipHeader& header)
+
+   /**
+    * @brief Reverse the byte order of a value.
+    * @param[in,out] value (char*) value bytes
+    * @param[in] length (size_t) number of bytes
+    */
+   void SlipReadBinary::reverse(char* value, size_t length) {                   // Reverse byte order
+      std::reverse(value, value + length);
+   }; // void SlipReadBinary::reverse(char* value, size_t length)
+
+   /*********************************************************
+    *                    Private Methods                    *
+   **********************************************************/
+
+   /**
+    * @brief Input the list file.
+    * <p>The file identification is checked and each list record is input.
+    *    If the file is not valid an error is posted and the lists input
+    *    before the error are returned.</p>
+    * @return list
+    */
+   SlipHeader& SlipReadBinary::parse() {                                        // Input the list file
+      bool valid = readHeader();
+      for (ULONG number = 0; valid; number++) {
+         UCHAR tag;
+         if (!get(tag)) valid = false;
+         else if (tag == SlipWriteBinary::END) {
+            valid = (number == lists.size()) && (number > 0) && readNames();
+            break;
+         } else {
+            SlipHeader* header = getList(number);
+            valid = (tag == SlipWriteBinary::LIST) && header && readBody(*header);
+         }
+      }
+      if (!valid) {
+         errorReturn = 1;
+         postError(__FILE__, __LINE__, SlipErr::E4020, "SlipReadBinary::read", "", "");
+      }
+      release();
+      return (lists.empty())? *new SlipHeader(): *lists[0];
+   }; // SlipHeader& SlipReadBinary::parse()
+
+   /**
+    * @brief Replace User Data place holders and set the reference counts.
+    * <p>The reference count of each list is the number of sublist
+    *    references to the list, as if the list had been created and
+    *    inserted as a sublist by the application. The returned list has
+    *    a reference count of zero.</p>
+    */
+   void SlipReadBinary::release() {                                             // Set reference counts and parse User Data
+      parseUserData(userData);
+      for (size_t i = 1; i < lists.size(); i++) lists[i]->deleteList();
+      if (!lists.empty())
+         for(; lists[0]->getRefCount(); ) lists[0]->deleteList();
+   }; // void SlipReadBinary::release()
+
+   /*********************************************************
+    *                        Methods                        *
+   **********************************************************/
+
+   /**
+    * @brief Return stored read status.
+    * <center><table border="0">
+    * <tr>
+    *    <td><b>'0'</b></td>
+    *    <td>Normal termination. List file successfully input.</td>
+    * </tr>
+    * <tr>
+    *    <td><b>'1'</b></td>
+    *    <td>The list file is not valid or a User Data parse method is not registered.</td>
+    * </tr>
+    * <tr>
+    *    <td><b>'2'</b></td>
+    *    <td>The list file could not be opened.</td>
+    * </tr>
+    * </table></center>
+    * @return error status
+    */
+   int SlipReadBinary::getError() {
+      return errorReturn;
+   }; // int SlipReadBinary::getError()
+
+   /**
+    * @brief Input a list from a stream.
+    * <p>The stream should be opened in binary mode. If the list file is
+    *    not valid the lists input before the error are returned.</p>
+    * @param[in] in (istream&) input stream
+    * @return list
+    */
+   SlipHeader& SlipReadBinary::read(istream& in) {
+      this->in = &in;
+      buffer.resize(SlipWriteBinary::BUFSIZE);
+      block = buffer.data();
+      pos  = fill = 0;
+      swap = false;
+      lists.clear();
+      names.clear();
+      userData.clear();
+      return parse();
+   }; // SlipHeader& SlipReadBinary::read(istream& in)
+
+   /**
+    * @brief Input a list from a file.
+    * <p>If the file can not be opened an empty list is returned.</p>
+    * @param[in] filename (string) file name and path to be opened.
+    * @return list
+    */
+   SlipHeader& SlipReadBinary::read(string filename) {
+      ifstream in(filename.c_str(), ios::binary);
+      if (!in.is_open()) {
+         errorReturn = 2;
+         return *new SlipHeader();
+      }
+      return read(in);
+   }; // SlipHeader& SlipReadBinary::read(string filename)
+
+   /**
+    * @brief Register the name and parse method for a User Data class.
+    * @param userData (SlipDatum&) User Data class instance
+    * @return <b>true</b> registration successful
+    */
+   bool SlipReadBinary::registerUserData(const SlipDatum& userData) {
+      return reg->post(userData);
+   }; // bool SlipReadBinary::registerUserData(const SlipDatum& userData)
+
+   /**
+    * @brief Register an array of pointers to User Data instances.
+    * @param size (int) number of items in the array
+    * @param userData (SlipDatum* []) array of pointers
+    * @return <b>true</b> all input items were successfully registered
+    */
+   bool SlipReadBinary::registerUserData(const int size, SlipDatum  * const userData[]) {
+      bool flag = true;
+      for(int i = 0; i < size; i++)
+         flag &= registerUserData(*userData[i]);
+      return flag;
+   }; // bool SlipReadBinary::registerUserData(const int size, SlipDatum* const userData[])
+
+   /**
+    * @brief Register an array of User Data instances.
+    * @param size (int) number of items in the array
+    * @param userData (SlipDatum []) array of User Data instances
+    * @return <b>true</b> all input items were successfully registered
+    */
+   bool SlipReadBinary::registerUserData(const int size, SlipDatum const userData[]) {
+      bool flag = true;
+      for(int i = 0; i < size; i++)
+         flag &= registerUserData(userData[i]);
+      return flag;
+   }; // bool SlipReadBinary::registerUserData(const int size, SlipDatum const userData[])
+
+}; // namespace slip
@@ -0,0 +1,131 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+
+/**
+ * @file    SlipReadBinary.h
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ * @brief Input a list in binary form
+ */
+
+#ifndef SLIPREADBINARY_H
+#define	SLIPREADBINARY_H
+
+# include <iostream>
+# include <string>
+# include <vector>
+# include "SlipDef.h"
+# include "SlipDatum.h"
+# include "SlipHeader.h"
+# include "SlipRegister.h"
+
+using namespace std;
+
+namespace slip {
+
+   /**
+    * @class SlipReadBinary
+    * <p><b>Overview</b></p>
+    * <p>Input a list written by SlipWriteBinary. The list has the contents,
+    *    user marks, descriptor lists and sublist sharing of the list
+    *    written. There is no scanner or parser, each value is copied from
+    *    an input block.</p>
+    * <p>User Data parse methods are registered as for SlipRead. A User Data
+    *    cell is created by calling the parse method with the list written
+    *    by <b>SlipPointer::toList()</b>. The parse method owns the list.
+    *    The parse methods are called after all lists have been input, a
+    *    User Data list can reference any list in the file.</p>
+    * <p>The list reference counts are those of a list created from its
+    *    sublist references. The returned list has a reference count of
+    *    zero and is deleted by the caller with <b>deleteList()</b>.</p>
+    * <p><b>Methods</b></p>
+    * <ul>
+    *    <li><b>getError()</b> Return the current error value.</li>
+    *    <li><b>read()</b> Input a list file and return the list.</li>
+    *    <li><b>registerUserData()</b> Register User Data parse functions.</li>
+    * </ul>
+    * <pre>
+    *    SlipReadBinary reader(userData);
+    *    ifstream in("list.slb", ios::binary);
+    *    SlipHeader& list = reader.read(in);
+    * </pre>
+    */
+   class SlipReadBinary {
+   protected:
+      /**
+       * @struct UserData
+       * @brief A User Data cell waiting for its parse method.
+       */
+      struct UserData {
+         SlipCell*   cell;                                                      //!< cell to be replaced
+         SlipHeader* list;                                                      //!< User Data list
+         ULONG       name;                                                      //!< User Data name number
+      }; // struct UserData
+
+      SlipRegister* reg;                                                        //!< Pointer to hash table
+      int errorReturn;                                                          //!< error flag
+      istream* in;                                                              //!< input file or NULL
+      vector<char> buffer;                                                      //!< input block
+      const char* block;                                                        //!< input block or whole file
+      size_t pos;                                                               //!< next byte in the block
+      size_t fill;                                                              //!< bytes in the block
+      bool swap;                                                                //!< byte order is reversed
+      vector<SlipHeader*> lists;                                                //!< lists in list number order
+      vector<string> names;                                                     //!< User Data names in name number order
+      vector<UserData> userData;                                                //!< User Data cells waiting for parse
+   protected:
+      bool         get(void* value, size_t length);                             // Input bytes
+      template <class T>
+      bool         get(T& value) {                                              // Input a value
+         if (!get(&value, sizeof(T))) return false;
+         if (swap && (sizeof(T) > 1)) reverse((char*)&value, sizeof(T));
+         return true;
+      }; // bool get(T& value)
+      virtual SlipHeader* getList(ULONG number);                                // Return list by list number
+      void         parseUserData(vector<UserData>& entries);                    // Replace User Data place holders
+      bool         readBody(SlipHeader& header);                                // Input a list body
+      bool         readHeader();                                                // Input the file identification
+      bool         readNames();                                                 // Input the User Data names
+      bool         readUserData(SlipHeader& header);                            // Input a User Data cell
+      static void  reverse(char* value, size_t length);                         // Reverse byte order
+   private:
+      SlipReadBinary(const SlipReadBinary& orig);
+      SlipHeader&  parse();                                                     // Input the list file
+      void         release();                                                   // Set reference counts and parse User Data
+   public:
+      SlipReadBinary(int debugFlag = 0);
+      SlipReadBinary(SlipDatum& userData, int debugFlag = 0);
+      SlipReadBinary(const int size, SlipDatum const userData[], int debugFlag = 0);
+      SlipReadBinary(const int size, SlipDatum  * const userData[], int debugFlag = 0);
+      virtual ~SlipReadBinary();
+      int getError();
+      SlipHeader& read(istream& in);
+      SlipHeader& read(string filename);
+      bool registerUserData(const SlipDatum& userData);
+      bool registerUserData(const int size, SlipDatum  * const userData[]);
+      bool registerUserData(const int size, SlipDatum const userData[]);
+   }; // class SlipReadBinary
+}; // namespace slip
+
+#endif	/* SLIPREADBINARY_H */
@@ -1527,6 +1527,7 @@ namespace slip {
          postError(__FILE__, __LINE__, SlipErr::E3026, "SlipSequncer::SlipSequencer", "", "", *header);
       } else if (getRightLink() == NULL) {
          SlipHeader& castHeader = const_cast<SlipHeader&>(*(SlipHeader*)header);
+         loadList(&castHeader);
          setCurrentCell(castHeader);
          setListHeader(castHeader);
      } else {
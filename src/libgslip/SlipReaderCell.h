@@ -422,6 +422,7 @@ namespace slip {
  */
 
 class SlipReaderCell : public SlipCellBase {
+      friend class SlipCellBase;
     private:
 
     /*********************************************************
@@ -429,6 +430,7 @@ class SlipReaderCell : public SlipCellBase {
     **********************************************************/
       SlipReaderCell* getLink();                                                // Link to preceeding list cell
       void init();                                                              // Initialize cell core
+      void release()                                                            { if (!isDeleted()) addAVSLCells( this, this); }
       void setup(const SlipCell* header);                                       // Utility method for creation
       void setLink(SlipReaderCell& X);                                          // Set link to previous reader cell
       void setCurrentCell(SlipCellBase& X) { setLeftLink(&X);         }         // Set current Slip cell
@@ -455,7 +457,6 @@ class SlipReaderCell : public SlipCellBase {
     public:
        SlipReaderCell(SlipCell* header)                                  { setup(header); }
        SlipReaderCell(const SlipCell& header)                            { setup(&header); }
-       ~SlipReaderCell()                                                 { if (!isDeleted()) addAVSLCells( this, this); }
 
             /*****************************************
              *           Reader Assignment           *
@@ -562,8 +563,8 @@ class SlipReaderCell : public SlipCellBase {
              *             Miscellaneous             *
             ******************************************/
       SlipReaderCell*     deleteCell();                                         // Delete the current cell and move left
-      virtual string      toString() const;                                     // Pretty-print the Reader
-      virtual string      dump() const;                                         // return complete reader description
+              string      toString() const;                                     // Pretty-print the Reader
+              string      dump() const;                                         // return complete reader description
    }; // class SlipReader
 }; // namespace slip
 
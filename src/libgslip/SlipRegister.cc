@@ -476,6 +476,23 @@ const static string sFlag[] = {"false ", "true  "};
       return tuple;
    }; // SlipHash::ReturnTuple SlipRegister::insert(string& name)
 
+   /**
+    * @brief Insert the User Data entries of another register.
+    * <p>Each User Data name and parse method in the input register which
+    *    is not in this register is inserted. Lists are not copied.</p>
+    * @param[in] from (SlipRegister&) register containing User Data entries
+    */
+   void SlipRegister::copyUserData(const SlipRegister& from) {
+      for (int ndx = 0; ndx < from.hashTable->size(); ndx++) {
+         SlipHashEntry* entry = from[ndx];
+         if (entry && (entry->getType() == SlipHashEntry::USERDATA)) {
+            SlipAsciiEntry copy(entry->getAsciiKey(), const_cast<void*>(entry->getBinaryValue())
+                               , SlipHashEntry::USERDATA, debugFlag);
+            hashTable->insert(copy);
+         }
+      }
+   }; // void SlipRegister::copyUserData(const SlipRegister& from)
+
   /**
    * @brief Return a pointer to the User Data parse function.
    * <p>The hash table is searched for the input name. If the name is
@@ -744,6 +761,40 @@ const static string sFlag[] = {"false ", "true  "};
       return retval;
    }; // bool SlipRegister::post(SlipDescription* definition)
 
+   /**
+    * @brief Post the named lists of another register.
+    * <p>The input register holds the named lists of a separately parsed
+    *    list file. Each defined list is posted as a named list definition
+    *    and a list which was referenced in the list file is marked as
+    *    referenced in this register. User Data entries are skipped.</p>
+    * <p>Nothing is posted if a name is already in this register, if a
+    *    list is referenced and not defined, or if a Descriptor List is not
+    *    resolved. The list file must then be parsed in place to report
+    *    the diagnostics.</p>
+    * @param[in] from (SlipRegister&) register of a parsed list file
+    * @return <b>true</b> the named lists were posted
+    */
+   bool SlipRegister::merge(const SlipRegister& from) {
+      for (int ndx = 0; ndx < from.hashTable->size(); ndx++) {
+         SlipHashEntry* entry = from[ndx];
+         if (!entry || (entry->getType() == SlipHashEntry::USERDATA)) continue;
+         if ((entry->getType() == SlipHashEntry::REFERENCED) || !entry->isComplete())
+            return false;
+         if (search(entry->getAsciiKey()).condition == SlipHash::ReturnTuple::FOUND)
+            return false;
+      }
+      for (int ndx = 0; ndx < from.hashTable->size(); ndx++) {
+         SlipHashEntry* entry = from[ndx];
+         if (!entry || (entry->getType() == SlipHashEntry::USERDATA)) continue;
+         string name(entry->getAsciiKey());
+         SlipDescription definition((SlipCell*)const_cast<void*>(entry->getBinaryValue())
+                                   , &name, SlipDescription::NAMED, debugFlag);
+         post(&definition);
+         if (entry->getType() == SlipHashEntry::R_AND_D) getSublist(name);
+      }
+      return true;
+   }; // bool SlipRegister::merge(const SlipRegister& from)
+
    /**
     * @brief Search the Hash Table using the input ASCII key.
     * <p>The input key is hashed until either an entry with the same key is
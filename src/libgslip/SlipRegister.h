@@ -189,6 +189,8 @@ namespace slip {
     * <ul>
     *    <li><b>copyDList</b> Copy a named list to the Descriptor List field
     *        of a list.</li>
+    *    <li><b>copyUserData()</b> Insert the User Data entries of another
+    *        register.</li>
     *    <li><b>getParse()</b>Return a pointer to the parsing method for the 
     *       input name. If the name can not be found in the hash table or
     *       if the name is not a user data type, return <b>NULL</b>.</li>
@@ -200,6 +202,9 @@ namespace slip {
     *       <b>false</b> is returned if this is double post (the name is already
     *       in the hash table) or the table was full and an attempt to allocate 
     *       more space failed.</li>
+    *    <li><b>merge()</b> Post the named lists of another register. No
+    *       list is posted if a name is already in the register or if a
+    *       list is referenced and not defined in the other register.</li>
     *   <li><b>setDebugON()</b> Output debug information to cout.</li>
     *   <li><b>setDebugOFF()</b> Terminate debug output</li>
     *    <li><b>size()</b> Return the number of entries in the hash table.
@@ -297,10 +302,12 @@ namespace slip {
       virtual ~SlipRegister();
       SlipHashEntry* operator[](int ndx) const;
       bool           copyDList(SlipDescription* from, SlipDescription* to);
+      void           copyUserData(const SlipRegister& from);
       void           deleteEntry(const SlipHash::ReturnTuple& tuple) { hashTable->deleteEntry(tuple); }
       Parse          getParse(const string& name) const;
       SlipHeader*    getSublist(const string& name) const;
       string         getSublist(SlipHeader& head) const;
+      bool           merge(const SlipRegister& from);
       bool           post(const SlipDatum& userData);
       bool           post(const string& name);
       bool           post(SlipDescription* definition);
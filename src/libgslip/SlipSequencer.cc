@@ -64,6 +64,7 @@ namespace slip {
       if (header.leftLink == UNDEFDATA)
          postError(__FILE__, __LINE__, SlipErr::E3026, "SlipSequncer::SlipSequencer", "", "", header);
       link = &header;
+      SlipCellBase::loadList(link);
    }; // SlipSequencer::SlipSequencer(SlipHeader& header)
 
    /**
@@ -74,6 +75,7 @@ namespace slip {
     */
    SlipSequencer::SlipSequencer(SlipSublist& sublist) {
       link = (SlipCell*)*(sublist.getSublistHeader());
+      SlipCellBase::loadList(link);
    }; // SlipSequencer::SlipSequencer(SlipSublist& sublist)
 
    /**
@@ -195,6 +197,7 @@ namespace slip {
       while(!cell->isData()) {
          if (cell->isSublist()) {
             cell = (SlipCell*)*(SlipHeader**)SlipCellBase::getSublistHeader(*cell);
+            SlipCellBase::loadList(cell);
          } else if (cell->isHeader()) {
             break;
          }
@@ -224,6 +227,7 @@ namespace slip {
       while(!cell->isData()) {
          if (cell->isSublist()) {
             cell = (SlipCell*)*(SlipHeader**)SlipCellBase::getSublistHeader(*cell);
+            SlipCellBase::loadList(cell);
          } else if (cell->isHeader()) {
            break;
          }
@@ -248,8 +252,10 @@ namespace slip {
     */
    SlipSequencer& SlipSequencer::advanceSNL() {                                 // advance structural name left,     true if element found
       SlipCellBase* cell = (SlipCellBase*)link;
-      if (cell->isSublist())
+      if (cell->isSublist()) {
          cell = (SlipCell*)*(SlipHeader**)SlipCellBase::getSublistHeader(*cell);
+         SlipCellBase::loadList(cell);
+      }
       if (cell->isHeader())
          cell   = cell->getLeftLink();
       while(!cell->isHeader()) {
@@ -276,8 +282,10 @@ namespace slip {
     */
    SlipSequencer& SlipSequencer::advanceSNR() {                                 // advance structural name right,    true if element found
       SlipCellBase* cell = (SlipCellBase*)link;
-      if (cell->isSublist())
+      if (cell->isSublist()) {
          cell = (SlipCell*)*(SlipHeader**)SlipCellBase::getSublistHeader(*cell);
+         SlipCellBase::loadList(cell);
+      }
       if (cell->isHeader())
          cell   = cell->getRightLink();
       while(!cell->isHeader()) {
@@ -302,8 +310,10 @@ namespace slip {
     */
    SlipSequencer& SlipSequencer::advanceSWL() {                                 // advance structural word right,    true if element found
       SlipCellBase* cell = (SlipCellBase*)link;
-      if (cell->isSublist())
+      if (cell->isSublist()) {
          cell = (SlipCell*)*(SlipHeader**)SlipCellBase::getSublistHeader(*cell);
+         SlipCellBase::loadList(cell);
+      }
       cell = cell->getLeftLink();
       link = (SlipCell*)cell;
       return *this;
@@ -322,8 +332,10 @@ namespace slip {
     */
    SlipSequencer& SlipSequencer::advanceSWR() {                                 // advance structural word right,    true if element found
       SlipCellBase* cell = (SlipCellBase*)link;
-      if (cell->isSublist())
+      if (cell->isSublist()) {
          cell = (SlipCell*)*(SlipHeader**)SlipCellBase::getSublistHeader(*cell);
+         SlipCellBase::loadList(cell);
+      }
       cell = cell->getRightLink();
       link = (SlipCell*)cell;
       return *this;
@@ -99,6 +99,12 @@ namespace slip {
     */
    string SlipStringConst::toString() const       { return *str; }                    // Prettify
 
+   /**
+    * @brief The stored string is returned without a copy.
+    * @return (string*) the user string
+    */
+   const string* SlipStringConst::view() const    { return str; }                     // Borrowed string
+
    /**
     * @brief A string formatted for output
     * @return string sorrounded by double quotes, "string"
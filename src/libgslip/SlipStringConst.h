@@ -114,6 +114,7 @@ namespace slip {
       static SlipDatum& parse(SlipHeader& head);                                // input parser
       virtual void   remove()   const;                                          // Delete the object not the data
       virtual string toString() const;                                          // Prettify
+      virtual const string* view() const;                                       // Borrowed string
       virtual string  write() const;                                            // string formatted for a write
    }; // class SlipStringConst : SlipPointer
 
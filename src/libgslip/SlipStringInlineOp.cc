@@ -0,0 +1,97 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file    SlipStringInlineOp.cc
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+ # include <cstring>
+ # include <iomanip>
+ # include <string>
+ # include <sstream>
+ # include "SlipDatum.h"
+ # include "SlipDef.h"
+ # include "SlipGlobal.h"
+ # include "SlipStringInlineOp.h"
+
+using namespace std;
+
+namespace slip {
+
+   /**
+    * @brief Return <b>true</b> if X holds an inline string.
+    * @param[in] X (SlipDatum&) STRING cell
+    * @return <b>true</b> if the string is in the datum field
+    */
+   bool SlipStringInlineOp::isInline(const SlipDatum& X) {                     // true if X holds an inline string
+      return *getOperator(X) == (SlipOp*)stringInlineOP;
+   }; // bool SlipStringInlineOp::isInline(const SlipDatum& X)
+
+   /**
+    * @brief Store a string of at most INLINESIZE bytes in the datum field.
+    * <p>Unused bytes are zeroed so that equal strings have equal datum
+    *    fields.</p>
+    * @param[out] X (SlipDatum&) STRING cell
+    * @param[in] str (string&) string to store
+    */
+   void SlipStringInlineOp::put(SlipDatum& X, const string& str) {             // Store str in the datum field
+      char* bytes = (char*)getData(X);
+      memset(bytes, 0, sizeof(sAllData));
+      memcpy(bytes, str.data(), str.size());
+      bytes[INLINESIZE] = (char)str.size();
+   }; // void SlipStringInlineOp::put(SlipDatum& X, const string& str)
+
+   /**
+    * @brief Return the string in the datum field.
+    * @param[in] X (SlipDatum&) STRING cell
+    * @return (string) inline string
+    */
+   string SlipStringInlineOp::get(const SlipDatum& X) {                        // Return the inline string
+      const char* bytes = (const char*)getData(X);
+      return string(bytes, (UCHAR)bytes[INLINESIZE]);
+   }; // string SlipStringInlineOp::get(const SlipDatum& X)
+
+   sAllData SlipStringInlineOp::getDatumCopy(const SlipDatum& X) const {       // Return valid datum
+      return *getData(X);
+   }; // sAllData SlipStringInlineOp::getDatumCopy(const SlipDatum& X) const
+
+   void SlipStringInlineOp::remove(const SlipDatum& X) {                       // Delete the datum in this cell
+   }; // void SlipStringInlineOp::remove(const SlipDatum& X)
+
+   string SlipStringInlineOp::toString(const SlipCell& X) const {              // pretty print SLIP cell
+      return get((SlipDatum&)X);
+   }; // string SlipStringInlineOp::toString(const SlipCell& X) const
+
+   string SlipStringInlineOp::dump(const SlipCell& X) const {
+      stringstream pretty;
+      pretty << "[string   ] " << dumpLink(X)  << " = (inline)" << get((SlipDatum&)X);
+      return pretty.str();
+   }; // string SlipStringInlineOp::dump(const SlipCell& X) const
+
+   string SlipStringInlineOp::write(const SlipCell& X) const {                 // pretty print SLIP cell
+      return '"' + get((SlipDatum&)X) + '"';
+   }; // string SlipStringInlineOp::write(const SlipCell& X) const
+
+}; // namespace slip
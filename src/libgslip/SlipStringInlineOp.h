@@ -0,0 +1,76 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/** 
+ * @file    SlipStringInlineOp.h
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+#ifndef _SLIPSTRINGINLINEOP_H
+#define	_SLIPSTRINGINLINEOP_H
+
+# include "SlipDef.h"
+# include "SlipStringOp.h"
+# include <string>
+
+using namespace std;
+
+namespace slip {
+
+   /**
+    * @class SlipStringInlineOp
+    * @brief Operations for a short STRING held in the cell datum field.
+    * <p>A non-constant string of up to <b>INLINESIZE</b> (7) bytes is kept
+    *    in the cell datum field instead of in a SlipPointer. The first seven
+    *    bytes hold the characters, zero filled, and the last byte holds
+    *    the length. There is no heap allocation and no pointer to follow.</p>
+    * <p>The cell is a STRING. All STRING operations are inherited from
+    *    SlipStringOp, which reads the characters through <em>text()</em>.
+    *    Only the operations which touch the SlipPointer are replaced: a
+    *    copy is a copy of the datum field and remove does nothing.</p>
+    */
+   class SlipStringInlineOp : public SlipStringOp {
+   private:
+       SlipStringInlineOp(const SlipStringInlineOp& orig) { };
+       ~SlipStringInlineOp() { };
+   public:
+      static const size_t INLINESIZE = sizeof(sAllData) - 1;                    //!< largest inline string
+      SlipStringInlineOp() : SlipStringOp() { }
+      static bool     isInline(const SlipDatum& X);                             // true if X holds an inline string
+      static void     put(SlipDatum& X, const string& str);                     // Store str in the datum field
+      static string   get(const SlipDatum& X);                                  // Return the inline string
+
+               /*****************************************
+                *             Miscellaneous             *
+               ******************************************/
+      virtual sAllData  getDatumCopy(const SlipDatum& X) const;                 // Return valid datum
+      virtual void      remove(const SlipDatum& X);                             // Delete the datum in this cell
+      virtual string    toString(const SlipCell& X) const;                      // pretty print SLIP cell
+      virtual string    dump(const SlipCell& X) const;                          // unprettyingly dump the data
+      virtual string    write(const SlipCell& X) const;                         // "string"
+
+   }; // class SlipStringInlineOp
+}; // namespace slip
+
+#endif	/* _SLIPSTRINGINLINEOP_H */
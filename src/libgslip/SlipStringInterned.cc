@@ -0,0 +1,180 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file    SlipStringInterned.cc
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+ # include <mutex>
+ # include <string>
+ # include <unordered_map>
+ # include "SlipStringInterned.h"
+ # include "SlipDatum.h"
+
+namespace slip {
+   const string SlipStringInterned::name = "StringInterned";                             //!< User Defined Data name
+
+   /**
+    * @brief Hash of the string referenced by a pool key.
+    */
+   struct InternHash {
+      size_t operator()(const string* X) const { return std::hash<string>()(*X); }
+   }; // struct InternHash
+
+   /**
+    * @brief Equality of the strings referenced by two pool keys.
+    */
+   struct InternEqual {
+      bool operator()(const string* X, const string* Y) const { return *X == *Y; }
+   }; // struct InternEqual
+
+   typedef unordered_map<const string*, SlipStringInterned*, InternHash, InternEqual> InternPool;
+
+   static mutex       internLock;                                              //!< pool lock
+   static InternPool  internPool;                                              //!< string pool keyed by the pooled string
+
+   /**
+    * @brief Constructor for an interned string.
+    * <p>The input string is copied locally with a reference count of one.
+    *    The object is placed into the pool by <em>intern</em>.</p>
+    *
+    * @param[in] str (string*) string to be interned
+    */
+   SlipStringInterned::SlipStringInterned(const string* str): SlipPointer(&name), str(*str), refCount(1) { }
+
+   /**
+    * @brief Destructor does nothing.
+    * <p>Deletion of the object is done in <em>remove()</em></p>
+    */
+   SlipStringInterned::~SlipStringInterned()         {  }                               // Delete the string data
+
+   /**
+    * @brief Return the pooled object for a string.
+    * <p>If the string is in the pool the pooled object is returned with
+    *    its reference count incremented, otherwise a new object is created
+    *    and pooled. A pooled object whose count has reached zero is being
+    *    deleted by <em>remove</em> and is never revived, a new object
+    *    replaces it in the pool.</p>
+    * @param[in] str (string&) string to intern
+    * @return (SlipStringInterned*) pooled object
+    */
+   SlipStringInterned* SlipStringInterned::intern(const string& str) {                 // Pooled object for a string
+      lock_guard<mutex> guard(internLock);
+      InternPool::iterator it = internPool.find(&str);
+      if (it != internPool.end()) {
+         ULONG count = it->second->refCount.load();
+         while ((count != 0) && !it->second->refCount.compare_exchange_weak(count, count + 1));
+         if (count != 0) return it->second;
+         internPool.erase(it);                                                 // dying object is replaced
+      }
+      SlipStringInterned* ptr = new SlipStringInterned(&str);
+      internPool[&ptr->str] = ptr;
+      return ptr;
+   }; // SlipStringInterned* SlipStringInterned::intern(const string& str)
+
+   /**
+    * @brief Return the number of strings in the pool.
+    * @return number of distinct interned strings
+    */
+   ULONG SlipStringInterned::poolSize() {                                              // Number of pooled strings
+      lock_guard<mutex> guard(internLock);
+      return internPool.size();
+   }; // ULONG SlipStringInterned::poolSize()
+
+   /**
+    * @brief Share the current object.
+    * <p>The caller holds a reference, so the object can not be released
+    *    while the count is incremented.</p>
+    * @return (SlipStringInterned*) the current object
+    */
+   SlipStringInterned* SlipStringInterned::copy()    { refCount++; return this; }      // Shared object
+
+   /**
+    * @brief A string prefixed with the User Defined Data name is returned.
+    * @return (string) return the string prefixed with the Defined Data name
+    */
+   string SlipStringInterned::dump()     const       { return  "(" + name + ")" + str; }; // Uglify
+
+   /**
+    * @brief Return <b>null</b> for a pointer to the Parse method
+    * <p>The SlipString classes do not have a valid parser by definition.</p>
+    * @return <b></b>
+    */
+   Parse  SlipStringInterned::getParse() {                                            // return a pointer to the parse method
+      return NULL;
+   }; // Parse  SlipStringInterned::getParse()
+
+   /**
+    * @brief Parse the input read list.
+    * <P>This operation is undefined for strings.</p>
+    * @return (SlipPointer&) return
+    */
+    SlipDatum& SlipStringInterned::parse(SlipHeader& head) {                          // input parser
+         return *new SlipDatum("");
+   }; // SlipPointer& SlipStringInterned::parse(SlipHeader& head)
+
+   /**
+    * @brief Release a reference.
+    * <p>The count is decremented without the pool lock. The last reference
+    *    takes the lock, removes the object from the pool and deletes it.
+    *    <em>intern</em> never revives an object with a zero count, so the
+    *    pool entry is checked again under the lock and is only erased if
+    *    it has not been replaced by a new object for the same string.</p>
+    */
+   void   SlipStringInterned::remove()   const {                                     // Release a reference
+      if (refCount.fetch_sub(1) != 1) return;
+      lock_guard<mutex> guard(internLock);
+      InternPool::iterator it = internPool.find(&str);
+      if ((it != internPool.end()) && (it->second == this))
+         internPool.erase(it);
+      delete this;
+   }; // void   SlipStringInterned::remove()   const
+
+   /**
+    * @brief The stored string is returned.
+    * @return (string) return the stored string
+    */
+   string SlipStringInterned::toString() const       { return str; }                     // Prettify
+
+   /**
+    * @brief The stored string is returned without a copy.
+    * @return (string*) the pooled string
+    */
+   const string* SlipStringInterned::view() const    { return &str; }                    // Borrowed string
+
+   /**
+    * @brief A string formatted for output
+    * @return string sorrounded by double quotes, "string"
+    */
+   string SlipStringInterned::write() const {                                            // Output formatted string
+      string out;
+      out.reserve(str.size() + 2);
+      out += '"';
+      out += str;
+      out += '"';
+      return out;
+   }; // string SlipStringInterned::write() const
+
+} // namespace slip
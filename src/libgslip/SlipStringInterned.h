@@ -0,0 +1,117 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/* 
+ * File:   SlipStringInterned.h
+ * Author: A. Schwarz
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef SLIPSTRINGINTERNED_H
+#define	SLIPSTRINGINTERNED_H
+
+   
+# include "SlipPointer.h"
+# include <atomic>
+# include <string>
+
+using namespace std;
+
+namespace slip {
+      
+   /**
+    * @class SlipStringInterned
+    * @brief SLIP Defined Data type for a shared, interned string.
+    * <p><b>Overview</b></p><hr>
+    * <p><b>User Data Type</b></p><hr>
+    * <p>There is one instance of the object for each distinct string
+    *    value. Objects are kept in a string pool, and a request for a
+    *    string already in the pool returns the pooled object with its
+    *    reference count incremented. Token heavy lists, where the same
+    *    string is repeated many times, hold one copy of each string.</p>
+    * <p>The string is never changed. Two STRING cells referencing
+    *    interned strings are equal if and only if they reference the
+    *    same object, and equality is a pointer comparison.</p>
+    * <p>When SLIP creates a new <em>SlipDatum</em> cell using the current
+    *    cell as a model, the reference count is incremented and the same
+    *    object is shared. When the last reference is removed the object
+    *    is taken out of the pool and deleted.</p>
+    * <p>Interned strings are created when interning is enabled, see
+    *    <em>SlipDatum::internStrings(bool)</em>, in place of a
+    *    SlipStringNonConst object. Strings short enough to be held in the
+    *    cell (SlipStringInlineOp) are never interned.</p>
+    * <p><b>Properties</b></p><hr>
+    * <ol>
+    *    <li><b>name</b> an invariant property which is the internal 
+    *        name of the User Defined Data type for an interned string.</li>
+    *    <li><b>str</b> the pooled copy of the string.</li>
+    *    <li><b>refCount</b> the number of cells referencing the object.</li>
+    * </ol>
+    * <p><b>Constructors/Destructors</b></p><hr>
+    * <p>The constructor and destructor are private. Objects are created
+    *    by <b>intern</b> and deleted by <b>remove</b>.</p>
+    * <p><b>SlipStringInterned Operations</b></p><hr>
+    * <ul>
+    *    <li><b>copy</b> increments the reference count and returns the
+    *        current object.</li>
+    *    <li><b>dump></b> returns the string prefixed with the User
+    *        Defined type name.</li>
+    *    <li><b>intern</b> returns the pooled object for a string.</li>
+    *    <li><b>isInterned</b> <b>true</b> if a SlipPointer is an
+    *        interned string.</li>
+    *    <li><b>poolSize</b> the number of strings in the pool.</li>
+    *    <li><b>remove</b> decrements the reference count and deletes the
+    *        object when the count is zero.</li>
+    *    <li><b>toString</b> returns an unadorned string.</li>
+    * </ul>
+    * 
+    * @see slip::SlipDatum
+    * @see slip::SlipPointer
+    * @see slip::SlipStringNonConst
+    */
+   
+   class SlipStringInterned : public SlipPointer {
+      const string str;                                                         //!< string value
+      mutable atomic<ULONG> refCount;                                           //!< number of references
+      static const string name;                                                 //!< type name
+      SlipStringInterned(const string* str);
+      virtual ~SlipStringInterned();                                            // Delete the string data
+   public:
+      static SlipStringInterned* intern(const string& str);                     // Pooled object for a string
+      static bool    isInterned(const SlipPointer* ptr)  { return ptr->getName() == &name; }
+      static ULONG   poolSize();                                                // Number of pooled strings
+      virtual SlipStringInterned* copy();                                       // Shared object
+      virtual Parse  getParse();                                                // return a pointer to the parse method
+      static SlipDatum& parse(SlipHeader& head);                                // parser input
+      virtual void   remove()   const;                                          // Release a reference
+      virtual string dump()     const;                                          // Uglify
+      virtual string toString() const;                                          // Prettify
+      virtual const string* view() const;                                       // Borrowed string
+      virtual string  write() const;                                            // string formatted for a write
+   }; // class SlipStringInterned : SlipPointer
+
+} // namespace slip
+
+
+#endif	/* SLIPSTRINGINTERNED_H */
+
@@ -94,6 +94,12 @@ namespace slip {
     */
    string SlipStringNonConst::toString() const       { return str; }                     // Prettify
 
+   /**
+    * @brief The stored string is returned without a copy.
+    * @return (string*) the local string
+    */
+   const string* SlipStringNonConst::view() const    { return &str; }                    // Borrowed string
+
    /**
     * @brief A string formatted for output
     * @return string sorrounded by double quotes, "string"
@@ -117,6 +117,7 @@ namespace slip {
       virtual void   remove()   const;                                          // Delete object and data
       virtual string dump()     const;                                          // Uglify
       virtual string toString() const;                                          // Prettify
+      virtual const string* view() const;                                       // Borrowed string
       virtual string  write() const;                                            // string formatted for a write
    }; // class SlipStringConst : SlipPointer
 
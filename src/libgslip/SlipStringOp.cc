@@ -30,11 +30,14 @@
  # include <iomanip>
  # include <string>
  # include <sstream>
+ # include <cstdio>
  # include "SlipDatum.h"
  # include "SlipDef.h"
  # include "SlipErr.h"
  # include "SlipGlobal.h"
  # include "SlipPointer.h"
+ # include "SlipStringInlineOp.h"
+ # include "SlipStringInterned.h"
  # include "SlipStringOp.h"
 
 using namespace slip;
@@ -420,122 +423,182 @@ namespace slip {
           /*************************************************
            *               Logical operators               *
           *************************************************/
+   /**
+    * @brief Return the string in a STRING cell without a copy.
+    * <p>The string is borrowed from the SlipPointer. If the SlipPointer
+    *    does not hold a string its <em>toString()</em> is put in copy. An
+    *    inline string is put in copy, it is too short to use the heap.</p>
+    * @param[in] X (SlipDatum&) STRING cell
+    * @param[out] copy string used if there is no borrowed string
+    * @return reference to the borrowed string or to copy
+    */
+   const string& SlipStringOp::text(const SlipDatum& X, string& copy) {          // Borrowed string of a STRING cell
+      if (SlipStringInlineOp::isInline(X)) {
+         copy = SlipStringInlineOp::get(X);
+         return copy;
+      }
+      const string* str = (*getPtr(X))->view();
+      if (str != NULL) return *str;
+      copy = (*getPtr(X))->toString();
+      return copy;
+   }; // const string& SlipStringOp::text(const SlipDatum& X, string& copy)
+
+   /**
+    * @brief Hash the string in a STRING cell.
+    * <p>The borrowed string is hashed, a string held by a SlipPointer is
+    *    not copied. Cells which compare equal hash equal.</p>
+    * @param[in] X (SlipDatum&) STRING cell
+    * @return hash of the string
+    */
+   size_t SlipStringOp::hash(const SlipDatum& X) {                              // Hash a STRING cell without a copy
+      string copy;
+      return std::hash<string>()(text(X, copy));
+   }; // size_t SlipStringOp::hash(const SlipDatum& X)
+
+   /**
+    * @brief Return <b>true</b> if both STRING cells hold interned strings.
+    * <p>Interned strings are unique in the string pool, two interned
+    *    strings are equal if and only if they are the same object.</p>
+    * @param[in] Y (SlipDatum&) left STRING cell
+    * @param[in] X (SlipDatum&) right STRING cell
+    * @return <b>true</b> if equality is an address comparison
+    */
+   bool SlipStringOp::interned(const SlipDatum& Y, const SlipDatum& X) {        // Both strings are interned
+      return !SlipStringInlineOp::isInline(Y) && !SlipStringInlineOp::isInline(X)
+          && SlipStringInterned::isInterned(*getPtr(Y))
+          && SlipStringInterned::isInterned(*getPtr(X));
+   }; // bool SlipStringOp::interned(const SlipDatum& Y, const SlipDatum& X)
+
+   /**
+    * @brief Compare the strings in two STRING cells.
+    * @param[in] Y (SlipDatum&) left STRING cell
+    * @param[in] X (SlipDatum&) right STRING cell
+    * @return &lt;0, 0, &gt;0 as Y is less than, equal to or greater than X
+    */
+   int SlipStringOp::compare(const SlipDatum& Y, const SlipDatum& X) {          // Compare two STRING cells
+      if (*getPtr(Y) == *getPtr(X)) return 0;                                   // shared (interned) or equal inline string
+      string copyY, copyX;
+      return text(Y, copyY).compare(text(X, copyX));
+   }; // int SlipStringOp::compare(const SlipDatum& Y, const SlipDatum& X)
+
+   int SlipStringOp::compare(const SlipDatum& Y, const string& X) {             // Compare a STRING cell and a string
+      string copy;
+      return text(Y, copy).compare(X);
+   }; // int SlipStringOp::compare(const SlipDatum& Y, const string& X)
+
+   int SlipStringOp::compare(const SlipDatum& Y, const char* X) {               // Compare a STRING cell and a C string
+      string copy;
+      return text(Y, copy).compare(X);
+   }; // int SlipStringOp::compare(const SlipDatum& Y, const char* X)
+
+   /**
+    * @brief Compare a STRING cell with a number formatted as a string.
+    * <p>The number is formatted into a stack buffer as an ostream with the
+    *    default format would (%g for DOUBLE), with no heap use.</p>
+    * @param[in] Y (SlipDatum&) STRING cell
+    * @param[in] X number
+    * @return &lt;0, 0, &gt;0 as Y is less than, equal to or greater than X
+    */
+   int SlipStringOp::compare(const SlipDatum& Y, const DOUBLE X) {              // Compare a STRING cell and a formatted number
+      char buf[32];
+      snprintf(buf, sizeof(buf), "%g", X);
+      return compare(Y, buf);
+   }; // int SlipStringOp::compare(const SlipDatum& Y, const DOUBLE X)
+
+   int SlipStringOp::compare(const SlipDatum& Y, const ULONG X) {               // Compare a STRING cell and a formatted number
+      char buf[32];
+      snprintf(buf, sizeof(buf), "%lu", (unsigned long)X);
+      return compare(Y, buf);
+   }; // int SlipStringOp::compare(const SlipDatum& Y, const ULONG X)
+
+   int SlipStringOp::compare(const SlipDatum& Y, const LONG X) {                // Compare a STRING cell and a formatted number
+      char buf[32];
+      snprintf(buf, sizeof(buf), "%ld", (long)X);
+      return compare(Y, buf);
+   }; // int SlipStringOp::compare(const SlipDatum& Y, const LONG X)
+
    bool SlipStringOp::notEqual (const SlipDatum& Y, const SlipDatum& X) const { // operator!=
       if (X.getClassType() != eSTRING) return false;
-      return Y.toString() != X.toString();
+      if (interned(Y, X)) return *getPtr(Y) != *getPtr(X);
+      return compare(Y, X) != 0;
    }; // bool SlipStringOp::notEqual (const SlipDatum& Y, const SlipDatum& X) const
    bool SlipStringOp::lessThan (const SlipDatum& Y, const SlipDatum& X) const { // operator<
       if (X.getClassType() != eSTRING) return false;
-      return Y.toString() < X.toString();
+      return compare(Y, X) < 0;
    }; // bool SlipStringOp::lessThan (const SlipDatum& Y, const SlipDatum& X) const
    bool SlipStringOp::lessEqual (const SlipDatum& Y, const SlipDatum& X) const { // operator<=
       if (X.getClassType() != eSTRING) return false;
-      return Y.toString() <= X.toString();
+      return compare(Y, X) <= 0;
    }; // bool SlipStringOp::lessEqual (const SlipDatum& Y, const SlipDatum& X) const
    bool SlipStringOp::equal (const SlipDatum& Y, const SlipDatum& X) const { // operator==
       if (X.getClassType() != eSTRING) return false;
-      return Y.toString() == X.toString();
+      if (interned(Y, X)) return *getPtr(Y) == *getPtr(X);
+      return compare(Y, X) == 0;
    }; // bool SlipStringOp::equal (const SlipDatum& Y, const SlipDatum& X) const
    bool SlipStringOp::greatEqual(const SlipDatum& Y, const SlipDatum& X) const { // operator>=
       if (X.getClassType() != eSTRING) return false;
-      return Y.toString() >= X.toString();
+      return compare(Y, X) >= 0;
   }; // bool SlipStringOp::greatEqual(const SlipDatum& Y, const SlipDatum& X) const
    bool SlipStringOp::greatThan (const SlipDatum& Y, const SlipDatum& X) const { // operator>
       if (X.getClassType() != eSTRING) return false;
-      return Y.toString() > X.toString();
+      return compare(Y, X) > 0;
    }; // bool SlipStringOp::greatThan (const SlipDatum& Y, const SlipDatum& X) const
 
    bool SlipStringOp::notEqual (const SlipDatum& Y, const DOUBLE X) const { // operator!=
-      stringstream str;
-      str << X;
-      return (Y.toString() != str.str());
+      return compare(Y, X) != 0;
    }; // bool SlipStringOp::notEqual (const SlipDatum& Y, const DOUBLE X) const
    bool SlipStringOp::lessThan (const SlipDatum& Y, const DOUBLE X) const { // operator<
-      stringstream str;
-      str << X;
-      return (Y.toString() < str.str());
+      return compare(Y, X) < 0;
    }; // bool SlipStringOp::lessThan (const SlipDatum& Y, const DOUBLE X) const
    bool SlipStringOp::lessEqual (const SlipDatum& Y, const DOUBLE X) const { // operator<=
-      stringstream str;
-      str << X;
-      return (Y.toString() <= str.str());
+      return compare(Y, X) <= 0;
    }; // bool SlipStringOp::lessEqual (const SlipDatum& Y, const DOUBLE X) const
    bool SlipStringOp::equal (const SlipDatum& Y, const DOUBLE X) const { // operator==
-      stringstream str;
-      str << X;
-      return (Y.toString() == str.str());
+      return compare(Y, X) == 0;
    }; // bool SlipStringOp::equal (const SlipDatum& Y, const DOUBLE X) const
    bool SlipStringOp::greatEqual(const SlipDatum& Y, const DOUBLE X) const { // operator>=
-      stringstream str;
-      str << X;
-      return (Y.toString() >= str.str());
+      return compare(Y, X) >= 0;
    }; // bool SlipStringOp::greatEqual(const SlipDatum& Y, const DOUBLE X) const
    bool SlipStringOp::greatThan (const SlipDatum& Y, const DOUBLE X) const { // operator>
-      stringstream str;
-      str << X;
-      return (Y.toString() > str.str());
+      return compare(Y, X) > 0;
    }; // bool SlipStringOp::greatThan (const SlipDatum& Y, const DOUBLE X) const
 
    bool SlipStringOp::notEqual (const SlipDatum& Y, const ULONG X) const { // operator!=
-      stringstream str;
-      str << X;
-      return (Y.toString() != str.str());
+      return compare(Y, X) != 0;
    }; // bool SlipStringOp::notEqual (const SlipDatum& Y, const ULONG X) const
    bool SlipStringOp::lessThan (const SlipDatum& Y, const ULONG X) const { // operator<
-      stringstream str;
-      str << X;
-      return (Y.toString() < str.str());
+      return compare(Y, X) < 0;
    }; // bool SlipStringOp::lessThan (const SlipDatum& Y, const ULONG X) const
    bool SlipStringOp::lessEqual (const SlipDatum& Y, const ULONG X) const { // operator<=
-      stringstream str;
-      str << X;
-      return (Y.toString() <= str.str());
+      return compare(Y, X) <= 0;
    }; // bool SlipStringOp::lessEqual (const SlipDatum& Y, const ULONG X) const
    bool SlipStringOp::equal (const SlipDatum& Y, const ULONG X) const { // operator==
-      stringstream str;
-      str << X;
-      return (Y.toString() == str.str());
+      return compare(Y, X) == 0;
    }; // bool SlipStringOp::equal (const SlipDatum& Y, const ULONG X) const
    bool SlipStringOp::greatEqual(const SlipDatum& Y, const ULONG X) const { // operator>=
-      stringstream str;
-      str << X;
-      return (Y.toString() >= str.str());
+      return compare(Y, X) >= 0;
    }; // bool SlipStringOp::greatEqual(const SlipDatum& Y, const ULONG X) const
    bool SlipStringOp::greatThan (const SlipDatum& Y, const ULONG X) const { // operator>
-      stringstream str;
-      str << X;
-      return (Y.toString() > str.str());
+      return compare(Y, X) > 0;
    }; // bool SlipStringOp::greatThan (const SlipDatum& Y, const ULONG X) const
 
    bool SlipStringOp::notEqual (const SlipDatum& Y, const LONG X) const { // operator!=
-      stringstream str;
-      str << X;
-      return (Y.toString() != str.str());
+      return compare(Y, X) != 0;
    }; // bool SlipStringOp::notEqual (const SlipDatum& Y, const LONG X) const
    bool SlipStringOp::lessThan (const SlipDatum& Y, const LONG X) const { // operator<
-      stringstream str;
-      str << X;
-      return (Y.toString() < str.str());
+      return compare(Y, X) < 0;
    }; // bool SlipStringOp::lessThan (const SlipDatum& Y, const LONG X) const
    bool SlipStringOp::lessEqual (const SlipDatum& Y, const LONG X) const { // operator<=
-      stringstream str;
-      str << X;
-      return (Y.toString() <= str.str());
+      return compare(Y, X) <= 0;
    }; // bool SlipStringOp::lessEqual (const SlipDatum& Y, const LONG X) const
    bool SlipStringOp::equal (const SlipDatum& Y, const LONG X) const { // operator==
-      stringstream str;
-      str << X;
-      return (Y.toString() == str.str());
+      return compare(Y, X) == 0;
    }; // bool SlipStringOp::equal (const SlipDatum& Y, const LONG X) const
    bool SlipStringOp::greatEqual(const SlipDatum& Y, const LONG X) const { // operator>=
-      stringstream str;
-      str << X;
-      return (Y.toString() >= str.str());
+      return compare(Y, X) >= 0;
    }; // bool SlipStringOp::greatEqual(const SlipDatum& Y, const LONG X) const
    bool SlipStringOp::greatThan (const SlipDatum& Y, const LONG X) const { // operator>
-      stringstream str;
-      str << X;
-      return (Y.toString() > str.str());
+      return compare(Y, X) > 0;
    }; // bool SlipStringOp::greatThan (const SlipDatum& Y, const LONG X) const
 
    bool SlipStringOp::notEqual (const SlipDatum& Y, const PTR X) const { // operator!=
@@ -548,22 +611,22 @@ namespace slip {
    }; // bool SlipStringOp::equal (const SlipDatum& Y, const PTR X) const
 
    bool SlipStringOp::notEqual (const SlipDatum& Y, const string& X) const { // operator!=
-      return Y.toString() != X;
+      return compare(Y, X) != 0;
    }; // bool SlipStringOp::notEqual (const SlipDatum& Y, const string& X) const
    bool SlipStringOp::lessThan (const SlipDatum& Y, const string& X) const { // operator<
-      return Y.toString() < X;
+      return compare(Y, X) < 0;
    }; // bool SlipStringOp::equal (const SlipDatum& Y, const string& X) const
    bool SlipStringOp::lessEqual (const SlipDatum& Y, const string& X) const { // operator<=
-      return Y.toString() <= X;
+      return compare(Y, X) <= 0;
    }; // bool SlipStringOp::notEqual (const SlipDatum& Y, const string& X) const
    bool SlipStringOp::equal (const SlipDatum& Y, const string& X) const { // operator==
-      return Y.toString() == X;
+      return compare(Y, X) == 0;
    }; // bool SlipStringOp::equal (const SlipDatum& Y, const string& X) const
    bool SlipStringOp::greatEqual (const SlipDatum& Y, const string& X) const { // operator>=
-      return Y.toString() >= X;
+      return compare(Y, X) >= 0;
    }; // bool SlipStringOp::notEqual (const SlipDatum& Y, const string& X) const
    bool SlipStringOp::greatThan (const SlipDatum& Y, const string& X) const {   // operator>
-      return Y.toString() > X;
+      return compare(Y, X) > 0;
    }; // bool SlipStringOp::equal (const SlipDatum& Y, const string& X) const
 
    SlipDatum& SlipStringOp::copy(const SlipDatum& X) const {                    // Return a reference to a copy of the current cell
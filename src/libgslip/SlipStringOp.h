@@ -39,9 +39,17 @@ using namespace std;
 namespace slip {
 
    class SlipStringOp : public SlipOp {
-   private:
+   protected:
        SlipStringOp(const SlipStringOp& orig) { };
        ~SlipStringOp() { };
+       static const string& text(const SlipDatum& X, string& copy);            // Borrowed string of a STRING cell
+       static bool interned(const SlipDatum& Y, const SlipDatum& X);           // Both strings are interned
+       static int  compare(const SlipDatum& Y, const SlipDatum& X);            // Compare two STRING cells
+       static int  compare(const SlipDatum& Y, const string& X);               // Compare a STRING cell and a string
+       static int  compare(const SlipDatum& Y, const char* X);                 // Compare a STRING cell and a C string
+       static int  compare(const SlipDatum& Y, const DOUBLE X);                // Compare a STRING cell and a formatted number
+       static int  compare(const SlipDatum& Y, const ULONG X);                 // Compare a STRING cell and a formatted number
+       static int  compare(const SlipDatum& Y, const LONG X);                  // Compare a STRING cell and a formatted number
    public:
       SlipStringOp() : SlipOp ( 8                                  // cellType
                               , 6                                  // ID
@@ -52,6 +60,7 @@ namespace slip {
                               , false                              // isHeaderFlag
                               , false                              // isNumberFlag
                               , false) { }                         // isSublistFlag
+      static size_t hash(const SlipDatum& X);                                   // Hash a STRING cell without a copy
    public:
 
       /*********************************************************
@@ -85,15 +85,15 @@ namespace slip {
    }; // SlipSublist::SlipSublist(SlipCell& X)
 
    /**
-    * @fn SlipSublist::~SlipSublist()
-    * @brief SlipSublist destructor - return cell to AVSL.
+    * @fn SlipSublist::release()
+    * @brief Return cell to AVSL, called by <em>~SlipCellBase</em>.
     * <p><b>ERRORS</b></p>
     * <ul>
     *    <li><b>E2010</b> Can not use header cell. Header in sublist is not a header</p>
     *    <li><b>E2034</b> Attempt to delete a SlipSublist cell that does not have a SlipHeader. </p>
     * </ul>
     */
-   SlipSublist::~SlipSublist() {
+   void SlipSublist::release() {
       if (!isDeleted()) {
          SlipHeader* header = *(SlipHeader**)getSublistHeader();
          if (header == NULL)
@@ -105,7 +105,7 @@ namespace slip {
             addAVSLCells( this, this);
          }
       }
-   }; // SlipSublist::~SlipSublist()
+   }; // void SlipSublist::release()
 
    /**
     * @fn SlipSublist::constructSublist()
@@ -531,7 +531,8 @@ namespace slip {
        * @fn SlipSublist::getHeader() const
        * @brief Return a reference to the header reference in the sublist.
        * <p>A reference to the contained SlipHeader object reference is returned.
-       *    This give the user access to all public SlipHeader methods.</p>
+       *    This give the user access to all public SlipHeader methods. A list
+       *    waiting to be input by SlipMappedRead is input first.</p>
        * @return a reference to the header reference in the sublist
        */
 
@@ -559,7 +560,7 @@ namespace slip {
    SlipCell&  SlipSublist::operator=(const SlipCell& X) {                       // Y = V
       if (checkThat(*this, "operator=") && checkThat(X, "operator=")) {
          bool flag = true;
-         SlipHeader& header = getHeader();                                       // retain reference for subsequent deletion
+         SlipHeader& header = **(SlipHeader**)getSublistHeader();                // retain reference for subsequent deletion
          SlipHeader* newHead =  (SlipHeader*) &X;                                // guess that the input is a header
          if (X.isSublist())
             newHead = (SlipHeader*)*getSublistHeader(X);
@@ -568,6 +569,7 @@ namespace slip {
             postError(__FILE__, __LINE__, SlipErr::E3017, "operator=", "", "", *this, X);
          }
          if (flag) {
+            dListChanged(this);
             *getSublistHeader() = newHead;
             *getHeadRefCnt(*newHead) += 1;
             header.deleteList();                                                // this must follow the reference increment (*this == &X))
@@ -595,8 +597,9 @@ namespace slip {
     */
    SlipSublist& SlipSublist::operator=(const SlipSublist& X) {
       if (checkThat(*this, "operator=") && checkThat(X, "operator=")) {
-         SlipHeader& header = getHeader();                                       // retain reference for subsequent deletion
-         *getSublistHeader() = &X.getHeader();
+         SlipHeader& header = **(SlipHeader**)getSublistHeader();                // retain reference for subsequent deletion
+         dListChanged(this);
+         *getSublistHeader() = *X.getSublistHeader();
          *getHeadRefCnt(X) += 1;
          header.deleteList();
       }
@@ -1017,7 +1020,7 @@ namespace slip {
     * @return <b>true</b> if the same header is referenced
     */
    bool SlipSublist::operator==(const SlipCell& X) {                            // Y == X
-       SlipHeader* head1 = &getHeader();
+       SlipHeader* head1 = *(SlipHeader**)getSublistHeader();
        SlipHeader* head2 = NULL;
        if (X.isSublist()) {
            head2 = *(SlipHeader**)getSublistHeader(X);
@@ -420,11 +420,14 @@ namespace slip {
    class SlipHeader;
     
    class SlipSublist : public SlipCell {
+      friend class SlipCellBase;
+      friend class SlipCell;
        /*********************************************************
         *                   Private Functions                   *
        **********************************************************/
    private:
       SlipSublist(const SlipSublist& sublist) { };                              // Copy constructors not allowed
+      void release();                                                           // Return the cell to the AVSL
 
       void constructSublist() {                                                 // Complete creating a sublist
          setLeftLink(NULL);
@@ -438,7 +441,7 @@ namespace slip {
        **********************************************************/
    protected:
 
-      virtual SlipCell& factory();                                              // Create a SlipCell
+              SlipCell& factory();                                              // Create a SlipCell
 
           /*************************************************
            *           Constructors & Destructors          *
@@ -455,41 +458,40 @@ namespace slip {
       SlipSublist(SlipHeader& X)  { constructSublist(X); }
       SlipSublist(SlipSublist& X) { constructSublist(*(SlipHeader*)*getSublistHeader(X)); }
       SlipSublist(SlipCell& X);
-      virtual ~SlipSublist();
 
           /*************************************************
            *             Assignment operators              *
           *************************************************/
-      virtual SlipCell&    operator=(const SlipCell& X);                        // Y = X
+              SlipCell&    operator=(const SlipCell& X);                        // Y = X
               SlipSublist& operator=(const SlipSublist& X);                     // Y = X
-      virtual SlipSublist& operator=(const bool    X);                          // Y = V
-      virtual SlipSublist& operator=(const CHAR    X);                          // Y = V
-      virtual SlipSublist& operator=(const DOUBLE  X);                          // Y = V
-      virtual SlipSublist& operator=(const LONG    X);                          // Y = V
-      virtual SlipSublist& operator=(const UCHAR   X);                          // Y = V
-      virtual SlipSublist& operator=(const ULONG   X);                          // Y = V
-      virtual SlipSublist& operator=(const PTR     X);                          // Y = V
-      virtual SlipSublist& operator=(const string& X);                          // Y = V
-      virtual SlipSublist& operator=(const string* X);                          // Y = V
+              SlipSublist& operator=(const bool    X);                          // Y = V
+              SlipSublist& operator=(const CHAR    X);                          // Y = V
+              SlipSublist& operator=(const DOUBLE  X);                          // Y = V
+              SlipSublist& operator=(const LONG    X);                          // Y = V
+              SlipSublist& operator=(const UCHAR   X);                          // Y = V
+              SlipSublist& operator=(const ULONG   X);                          // Y = V
+              SlipSublist& operator=(const PTR     X);                          // Y = V
+              SlipSublist& operator=(const string& X);                          // Y = V
+              SlipSublist& operator=(const string* X);                          // Y = V
 
           /*************************************************
            *              Logical operators                *
           *************************************************/
-      virtual bool       operator==(const SlipCell& X);                         // Y == X
+              bool       operator==(const SlipCell& X);                         // Y == X
 
                   /*****************************************
                    *          Manipulating Lists           *
                   ******************************************/
-      virtual SlipCell& replace(const SlipCell& X);                             // Replace a cell on a list with a new cell
-      virtual SlipCell& replace(bool X);                                        // Replace a cell on a list with a new cell
-      virtual SlipCell& replace(CHAR X);                                        // Replace a cell on a list with a new cell
-      virtual SlipCell& replace(UCHAR X);                                       // Replace a cell on a list with a new cell
-      virtual SlipCell& replace(LONG X);                                        // Replace a cell on a list with a new cell
-      virtual SlipCell& replace(ULONG X);                                       // Replace a cell on a list with a new cell
-      virtual SlipCell& replace(DOUBLE X);                                      // Replace a cell on a list with a new cell
-      virtual SlipCell& replace(const PTR X, const void* operation = ptrOP);    // Replace a cell on a list with a new cell
-      virtual SlipCell& replace(const string& X, bool constFlag = false);       // Replace a cell on a list with a new cell
-      virtual SlipCell& replace(const string* X, bool constFlag = false);       // Replace a cell on a list with a new cell
+              SlipCell& replace(const SlipCell& X);                             // Replace a cell on a list with a new cell
+              SlipCell& replace(bool X);                                        // Replace a cell on a list with a new cell
+              SlipCell& replace(CHAR X);                                        // Replace a cell on a list with a new cell
+              SlipCell& replace(UCHAR X);                                       // Replace a cell on a list with a new cell
+              SlipCell& replace(LONG X);                                        // Replace a cell on a list with a new cell
+              SlipCell& replace(ULONG X);                                       // Replace a cell on a list with a new cell
+              SlipCell& replace(DOUBLE X);                                      // Replace a cell on a list with a new cell
+              SlipCell& replace(const PTR X, const void* operation = ptrOP);    // Replace a cell on a list with a new cell
+              SlipCell& replace(const string& X, bool constFlag = false);       // Replace a cell on a list with a new cell
+              SlipCell& replace(const string* X, bool constFlag = false);       // Replace a cell on a list with a new cell
 
                /*****************************************
                 *            Descriptor Lists           *
@@ -585,19 +587,19 @@ namespace slip {
                   ******************************************/
       bool              isDList() const { return (*(SlipHeader**)getSublistHeader())->isDList(); }  // Does the header have a description list
       bool              isEmpty() const { return (*(SlipHeader**)getSublistHeader())->isEmpty(); }  // Is the list empty
-      bool              isEqual(const SlipCell& X) const { return (*(SlipHeader**)getSublistHeader())->isEqual((SlipHeader&)X); }// true the lists are structurally identical
-      USHORT            getMark() const { return (*(SlipHeader**)getSublistHeader())->getMark(); }  // value of list mark
+      bool              isEqual(const SlipCell& X) const { return getHeader().isEqual((SlipHeader&)X); }// true the lists are structurally identical
+      USHORT            getMark() const { return getHeader().getMark(); }       // value of list mark
       USHORT            getRefCount() const { return (*(SlipHeader**)getSublistHeader())->getRefCount(); } // get list reference count
-      USHORT            putMark(const USHORT X) { return (*(SlipHeader**)getSublistHeader())->putMark(X); } // Mark the list
-      unsigned          size() const   { return (*(SlipHeader**)getSublistHeader())->size(); }      // Number of cells in list
-      SlipHeader&       getHeader() const       { return (**(SlipHeader**)getSublistHeader()); }    // Return a SlipHeader reference
+      USHORT            putMark(const USHORT X) { return getHeader().putMark(X); } // Mark the list
+      unsigned          size() const   { return getHeader().size(); }           // Number of cells in list
+      SlipHeader&       getHeader() const       { loadList((SlipCellBase*)*getSublistHeader()); return (**(SlipHeader**)getSublistHeader()); } // Return a SlipHeader reference
       void              dumpList() {             { getHeader().dumpList(); } }  // dump the current list
       
                /*****************************************
                 *             Miscellaneous             *
                ******************************************/
-      virtual string    dump() const;                                           // pretty print SLIP Header cell
-      virtual void      dump(ostream& out, int& col);                           // Output the current cell
+              string    dump() const;                                           // pretty print SLIP Header cell
+              void      dump(ostream& out, int& col);                           // Output the current cell
 
    }; // class SlipSublist
 }; // namespace slip
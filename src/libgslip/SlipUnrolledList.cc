@@ -0,0 +1,417 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file    SlipUnrolledList.cc
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+ # include <cstring>
+ # include <string>
+ # include "SlipUnrolledList.h"
+ # include "SlipCellBase.h"
+ # include "SlipDatum.h"
+ # include "SlipErr.h"
+ # include "SlipHeader.h"
+ # include "SlipPackedList.h"
+
+namespace slip {
+
+   /**
+    * @brief Move to the next value.
+    * @return <b>false</b> if there are no more values
+    */
+   bool SlipUnrolledList::Cursor::advance() {                                  // Move to the next value
+      if (node == NULL) return false;
+      if (++index < node->count) return true;
+      node  = node->right;
+      index = 0;
+      return node != NULL;
+   }; // bool SlipUnrolledList::Cursor::advance()
+
+   /**
+    * @brief Current value as a SlipDatum.
+    * @return current value
+    */
+   SlipDatum SlipUnrolledList::Cursor::current() const {                       // Current value as a SlipDatum
+      return SlipPackedList::datumOf(getType(), getValue());
+   }; // SlipDatum SlipUnrolledList::Cursor::current() const
+
+   /**
+    * @brief Constructor for an empty list.
+    */
+   SlipUnrolledList::SlipUnrolledList() : top(NULL), bot(NULL), cells(0), nodes(0) {
+   }; // SlipUnrolledList::SlipUnrolledList()
+
+   /**
+    * @brief Constructor for a copy of a list.
+    * <p>The numeric cells of the list are copied in order. The input list is
+    *    not changed.</p>
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3028</b> List cell is not numeric. The cell is not copied.</li>
+    * </ul>
+    * @param[in] list (SlipHeader&) list to copy
+    */
+   SlipUnrolledList::SlipUnrolledList(const SlipHeader& list)
+                    : top(NULL), bot(NULL), cells(0), nodes(0) {
+      for (SlipCellBase* link = list.getRightLink(); !link->isHeader(); link = link->getRightLink()) {
+         if (SlipPackedList::isPackedType(link->getClassType()))
+            enqueue((SlipDatum&)*link);
+         else
+            postError(__FILE__, __LINE__, SlipErr::E3028, "SlipUnrolledList::SlipUnrolledList", "", "", *link);
+      }
+   }; // SlipUnrolledList::SlipUnrolledList(const SlipHeader& list)
+
+   /**
+    * @brief Destructor. All chunks are deleted.
+    */
+   SlipUnrolledList::~SlipUnrolledList() {
+      while(top != NULL) dropNode(top);
+   }; // SlipUnrolledList::~SlipUnrolledList()
+
+               /*****************************************
+                *           Private Functions           *
+               ******************************************/
+
+   /**
+    * @brief true if X can be held in the list.
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3028</b> List cell is not numeric.</li>
+    * </ul>
+    * @param[in] X (SlipDatum&) value
+    * @param[in] method (string&) name of the calling method
+    * @return <b>true</b> if X is numeric
+    */
+   bool SlipUnrolledList::check(const SlipDatum& X, const string& method) const { // true if X is numeric
+      if (SlipPackedList::isPackedType(X.getClassType())) return true;
+      postError(__FILE__, __LINE__, SlipErr::E3028, method, "", "", X);
+      return false;
+   }; // bool SlipUnrolledList::check(const SlipDatum& X, const string& method) const
+
+   /**
+    * @brief Chunk holding value n.
+    * <p>The chunks are walked from the nearer end of the list.</p>
+    * @param[in,out] n list position on input, chunk position on output
+    * @return chunk holding value n
+    * @note n is less than the list size.
+    */
+   SlipUnrolledList::Node* SlipUnrolledList::find(unsigned& n) const {         // Chunk holding value n
+      Node* node;
+      if (n < cells / 2) {
+         for (node = top; n >= node->count; node = node->right) n -= node->count;
+      } else {
+         unsigned last = cells;
+         for (node = bot; n < (last - node->count); node = node->left) last -= node->count;
+         n -= last - node->count;
+      }
+      return node;
+   }; // SlipUnrolledList::Node* SlipUnrolledList::find(unsigned& n) const
+
+   /**
+    * @brief Link a new empty chunk to the right of a chunk.
+    * @param[in] left chunk to the left, NULL for the list top
+    * @return the new chunk
+    */
+   SlipUnrolledList::Node* SlipUnrolledList::newNode(Node* left) {             // Link a new chunk to the right of left
+      Node* node  = new Node;
+      node->count = 0;
+      node->left  = left;
+      node->right = (left == NULL)? top: left->right;
+      if (node->left  == NULL) top = node; else node->left->right = node;
+      if (node->right == NULL) bot = node; else node->right->left = node;
+      nodes++;
+      return node;
+   }; // SlipUnrolledList::Node* SlipUnrolledList::newNode(Node* left)
+
+   /**
+    * @brief Unlink and delete a chunk.
+    * @param[in] node chunk to delete
+    */
+   void SlipUnrolledList::dropNode(Node* node) {                               // Unlink and delete a chunk
+      if (node->left  == NULL) top = node->right; else node->left->right = node->right;
+      if (node->right == NULL) bot = node->left;  else node->right->left = node->left;
+      delete node;
+      nodes--;
+   }; // void SlipUnrolledList::dropNode(Node* node)
+
+   /**
+    * @brief Merge a sparse chunk with a neighbour.
+    * <p>A chunk less than a quarter full is merged into the chunk to its
+    *    left or right if the values fit. An empty chunk is deleted.</p>
+    * @param[in] node chunk which has had a value removed
+    */
+   void SlipUnrolledList::merge(Node* node) {                                  // Merge a sparse chunk with a neighbour
+      if (node->count == 0) {
+         dropNode(node);
+         return;
+      }
+      if (node->count >= CHUNKSIZE / 4) return;
+      Node* left  = node->left;
+      Node* right = node->right;
+      if ((left != NULL) && ((left->count + node->count) <= CHUNKSIZE)) {
+         memcpy(&left->type[left->count],  node->type,  node->count * sizeof(node->type[0]));
+         memcpy(&left->value[left->count], node->value, node->count * sizeof(node->value[0]));
+         left->count += node->count;
+         dropNode(node);
+      } else if ((right != NULL) && ((right->count + node->count) <= CHUNKSIZE)) {
+         memmove(&right->type[node->count],  right->type,  right->count * sizeof(right->type[0]));
+         memmove(&right->value[node->count], right->value, right->count * sizeof(right->value[0]));
+         memcpy(right->type,  node->type,  node->count * sizeof(node->type[0]));
+         memcpy(right->value, node->value, node->count * sizeof(node->value[0]));
+         right->count += node->count;
+         dropNode(node);
+      }
+   }; // void SlipUnrolledList::merge(Node* node)
+
+   /**
+    * @brief Insert a value before value n.
+    * <p>A full chunk is split into two half full chunks.</p>
+    * @param[in] n list position, the list size to insert on the bottom
+    * @param[in] type (ClassType) value type
+    * @param[in] X (Value&) value
+    */
+   void SlipUnrolledList::insert(unsigned n, ClassType type, const Value& X) {  // Insert X before value n
+      Node* node;
+      if (n == cells) {
+         node = (bot == NULL)? newNode(NULL): bot;
+         n    = node->count;
+      } else {
+         node = find(n);
+      }
+      if (node->count == CHUNKSIZE) {
+         Node*    right = newNode(node);
+         unsigned half  = CHUNKSIZE / 2;
+         memcpy(right->type,  &node->type[half],  (CHUNKSIZE - half) * sizeof(node->type[0]));
+         memcpy(right->value, &node->value[half], (CHUNKSIZE - half) * sizeof(node->value[0]));
+         right->count = CHUNKSIZE - half;
+         node->count  = half;
+         if (n > half) {
+            node = right;
+            n   -= half;
+         }
+      }
+      memmove(&node->type[n + 1],  &node->type[n],  (node->count - n) * sizeof(node->type[0]));
+      memmove(&node->value[n + 1], &node->value[n], (node->count - n) * sizeof(node->value[0]));
+      node->type[n]  = type;
+      node->value[n] = X;
+      node->count++;
+      cells++;
+   }; // void SlipUnrolledList::insert(unsigned n, ClassType type, const Value& X)
+
+               /*****************************************
+                *            Public Functions           *
+               ******************************************/
+
+   /**
+    * @brief Insert X on the list bottom.
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3028</b> List cell is not numeric.</li>
+    * </ul>
+    * @param[in] X (SlipDatum&) value
+    * @return reference to the list
+    */
+   SlipUnrolledList& SlipUnrolledList::enqueue(const SlipDatum& X) {           // Insert X on bottom of list
+      if (check(X, "SlipUnrolledList::enqueue"))
+         insert(cells, X.getClassType(), SlipPackedList::valueOf(X));
+      return *this;
+   }; // SlipUnrolledList& SlipUnrolledList::enqueue(const SlipDatum& X)
+
+   /**
+    * @brief Insert X on the list top.
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3028</b> List cell is not numeric.</li>
+    * </ul>
+    * @param[in] X (SlipDatum&) value
+    * @return reference to the list
+    */
+   SlipUnrolledList& SlipUnrolledList::push(const SlipDatum& X) {              // Insert X on top of list
+      if (check(X, "SlipUnrolledList::push"))
+         insert(0, X.getClassType(), SlipPackedList::valueOf(X));
+      return *this;
+   }; // SlipUnrolledList& SlipUnrolledList::push(const SlipDatum& X)
+
+   /**
+    * @brief Insert X before value n.
+    * <p>Value n of the list is the n'th from the list top, starting at 0.
+    *    An insertion before the list size is an enqueue.</p>
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3020</b> Unknown or illegal input argument. n is greater
+    *        than the list size.</li>
+    *    <li><b>E3028</b> List cell is not numeric.</li>
+    * </ul>
+    * @param[in] n (unsigned) list position
+    * @param[in] X (SlipDatum&) value
+    * @return reference to the list
+    */
+   SlipUnrolledList& SlipUnrolledList::insert(unsigned n, const SlipDatum& X) { // Insert X before value n
+      if (n > cells)
+         postError(__FILE__, __LINE__, SlipErr::E3020, "SlipUnrolledList::insert", "", "");
+      else if (check(X, "SlipUnrolledList::insert"))
+         insert(n, X.getClassType(), SlipPackedList::valueOf(X));
+      return *this;
+   }; // SlipUnrolledList& SlipUnrolledList::insert(unsigned n, const SlipDatum& X)
+
+   /**
+    * @brief Remove and return the list bottom.
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E2008</b> dequeue of empty list not allowed.</li>
+    * </ul>
+    * @return list bottom
+    */
+   SlipDatum SlipUnrolledList::dequeue() {                                     // Remove and return list bottom
+      if (isEmpty()) {
+         postError(__FILE__, __LINE__, SlipErr::E2008, "SlipUnrolledList::dequeue", "", "");
+         return SlipDatum((LONG)0);
+      }
+      return remove(cells - 1);
+   }; // SlipDatum SlipUnrolledList::dequeue()
+
+   /**
+    * @brief Remove and return the list top.
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E2009</b> pop of empty list not allowed.</li>
+    * </ul>
+    * @return list top
+    */
+   SlipDatum SlipUnrolledList::pop() {                                         // Remove and return list top
+      if (isEmpty()) {
+         postError(__FILE__, __LINE__, SlipErr::E2009, "SlipUnrolledList::pop", "", "");
+         return SlipDatum((LONG)0);
+      }
+      return remove(0);
+   }; // SlipDatum SlipUnrolledList::pop()
+
+   /**
+    * @brief Remove and return value n.
+    * <p>A chunk left less than a quarter full is merged with a
+    *    neighbour.</p>
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3020</b> Unknown or illegal input argument. n is not less
+    *        than the list size.</li>
+    * </ul>
+    * @param[in] n (unsigned) list position
+    * @return value n
+    */
+   SlipDatum SlipUnrolledList::remove(unsigned n) {                            // Remove and return value n
+      if (n >= cells) {
+         postError(__FILE__, __LINE__, SlipErr::E3020, "SlipUnrolledList::remove", "", "");
+         return SlipDatum((LONG)0);
+      }
+      Node* node = find(n);
+      SlipDatum datum = SlipPackedList::datumOf((ClassType)node->type[n], node->value[n]);
+      memmove(&node->type[n],  &node->type[n + 1],  (node->count - n - 1) * sizeof(node->type[0]));
+      memmove(&node->value[n], &node->value[n + 1], (node->count - n - 1) * sizeof(node->value[0]));
+      node->count--;
+      cells--;
+      merge(node);
+      return datum;
+   }; // SlipDatum SlipUnrolledList::remove(unsigned n)
+
+   /**
+    * @brief Replace value n with X.
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3020</b> Unknown or illegal input argument. n is not less
+    *        than the list size.</li>
+    *    <li><b>E3028</b> List cell is not numeric.</li>
+    * </ul>
+    * @param[in] n (unsigned) list position
+    * @param[in] X (SlipDatum&) value
+    * @return reference to the list
+    */
+   SlipUnrolledList& SlipUnrolledList::replace(unsigned n, const SlipDatum& X) { // Replace value n with X
+      if (n >= cells) {
+         postError(__FILE__, __LINE__, SlipErr::E3020, "SlipUnrolledList::replace", "", "");
+      } else if (check(X, "SlipUnrolledList::replace")) {
+         Node* node = find(n);
+         node->type[n]  = X.getClassType();
+         node->value[n] = SlipPackedList::valueOf(X);
+      }
+      return *this;
+   }; // SlipUnrolledList& SlipUnrolledList::replace(unsigned n, const SlipDatum& X)
+
+   /**
+    * @brief Return value n.
+    * <p><b>ERRORS</b></p>
+    * <ul>
+    *    <li><b>E3020</b> Unknown or illegal input argument. n is not less
+    *        than the list size.</li>
+    * </ul>
+    * @param[in] n (unsigned) list position
+    * @return value n
+    */
+   SlipDatum SlipUnrolledList::operator[](unsigned n) const {                  // Return value n
+      if (n >= cells) {
+         postError(__FILE__, __LINE__, SlipErr::E3020, "SlipUnrolledList::operator[]", "", "");
+         return SlipDatum((LONG)0);
+      }
+      Node* node = find(n);
+      return SlipPackedList::datumOf((ClassType)node->type[n], node->value[n]);
+   }; // SlipDatum SlipUnrolledList::operator[](unsigned n) const
+
+   /**
+    * @brief Linked copy of the list.
+    * <p>The user is responsible for deleting the list.</p>
+    * @return reference to a new list
+    */
+   SlipHeader& SlipUnrolledList::toList() const {                              // Linked copy of the list
+      SlipHeader* list = new SlipHeader();
+      for (Cursor cursor(*this); cursor.advance(); )
+         list->enqueue(*new SlipDatum(cursor.current()));
+      return *list;
+   }; // SlipHeader& SlipUnrolledList::toList() const
+
+   /**
+    * @brief Output the list.
+    * <p>The list is written as a SlipHeader list.</p>
+    * @param[in] out (ostream&) output stream
+    * @return <b>true</b>
+    */
+   bool SlipUnrolledList::write(ostream& out) const {                          // Output the list
+      SlipHeader& list = toList();
+      bool flag = list.write(out);
+      list.deleteList();
+      return flag;
+   }; // bool SlipUnrolledList::write(ostream& out) const
+
+   /**
+    * @brief Return an ASCII formated list as a string.
+    * @return formatted list
+    */
+   string SlipUnrolledList::writeToString() const {                            // Return an ASCII formated list as a string
+      SlipHeader& list = toList();
+      string str = list.writeToString();
+      list.deleteList();
+      return str;
+   }; // string SlipUnrolledList::writeToString() const
+
+}; // namespace slip
@@ -0,0 +1,132 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file    SlipUnrolledList.h
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+#ifndef _SLIPUNROLLEDLIST_H
+#define	_SLIPUNROLLEDLIST_H
+
+# include <ostream>
+# include <string>
+# include "SlipDef.h"
+# include "SlipDatum.h"
+# include "SlipHeader.h"
+# include "SlipPackedList.h"
+
+using namespace std;
+
+namespace slip {
+
+   /**
+    * @class SlipUnrolledList
+    * @brief A list of numeric values held in linked chunks.
+    * <p>Each chunk holds up to <b>CHUNKSIZE</b> values and their types,
+    *    with one pair of links for the chunk. Values may be of different
+    *    numeric types (bool, CHAR, UCHAR, LONG, ULONG and DOUBLE).</p>
+    * <p>A walk of the list with a <b>Cursor</b> reads the values of a chunk
+    *    from consecutive memory, and the links cost two pointers for each
+    *    chunk rather than for each value. A chunk takes about a quarter of
+    *    the space of the SLIP cells for the same values.</p>
+    * <p>Values are inserted, removed and replaced by position, the list top
+    *    is position 0. An insertion into a full chunk splits it in two, and
+    *    a chunk left less than a quarter full by a removal is merged with a
+    *    neighbour. <b>toList()</b> makes a linked SlipHeader copy for
+    *    traversal by SlipReader and SlipSequencer, and for output.</p>
+    * <pre>
+    *    SlipUnrolledList series;
+    *    for (int i = 0; i < 1000; i++) series.enqueue((DOUBLE)i);
+    *    for (SlipUnrolledList::Cursor cursor(series); cursor.advance(); )
+    *       total += cursor.getValue().Double;
+    * </pre>
+    */
+   class SlipUnrolledList {
+   public:
+      typedef SlipPackedList::Value Value;                                      //!< one value
+      static const unsigned CHUNKSIZE = 14;                                     //!< values in a chunk
+   private:
+      struct Node {
+         Node*  left;                                                           // chunk to the left
+         Node*  right;                                                          // chunk to the right
+         UCHAR  count;                                                          // values in the chunk
+         UCHAR  type[CHUNKSIZE];                                                // ClassType of each value
+         Value  value[CHUNKSIZE];                                               // values
+      }; // struct Node
+
+      Node*     top;                                                            // first chunk
+      Node*     bot;                                                            // last chunk
+      unsigned  cells;                                                          // number of values
+      unsigned  nodes;                                                          // number of chunks
+
+      SlipUnrolledList(const SlipUnrolledList& orig) { };                       // Copy constructor not allowed
+      Node*     find(unsigned& n) const;                                        // Chunk holding value n
+      Node*     newNode(Node* left);                                            // Link a new chunk to the right of left
+      void      dropNode(Node* node);                                           // Unlink and delete a chunk
+      void      merge(Node* node);                                              // Merge a sparse chunk with a neighbour
+      void      insert(unsigned n, ClassType type, const Value& X);             // Insert X before value n
+      bool      check(const SlipDatum& X, const string& method) const;          // true if X is numeric
+   public:
+      /**
+       * @class Cursor
+       * @brief Walk of the list values from the list top.
+       * <p>The cursor starts before the first value. It is invalid after the
+       *    list is changed.</p>
+       */
+      class Cursor {
+         const Node*  node;                                                     // current chunk
+         int          index;                                                    // current value in node
+      public:
+         Cursor(const SlipUnrolledList& list) : node(list.top), index(-1) { }
+         bool         advance();                                                // Move to the next value
+         ClassType    getType() const  { return (ClassType)node->type[index]; } // Type of the current value
+         const Value& getValue() const { return node->value[index]; }           // Current value
+         SlipDatum    current() const;                                          // Current value as a SlipDatum
+      }; // class Cursor
+
+      SlipUnrolledList();                                                       // Empty list
+      SlipUnrolledList(const SlipHeader& list);                                 // Copy of a list
+      ~SlipUnrolledList();
+
+      SlipUnrolledList& enqueue(const SlipDatum& X);                            // Insert X on bottom of list
+      SlipUnrolledList& push(const SlipDatum& X);                               // Insert X on top of list
+      SlipUnrolledList& insert(unsigned n, const SlipDatum& X);                 // Insert X before value n
+      SlipDatum         dequeue();                                              // Remove and return list bottom
+      SlipDatum         pop();                                                  // Remove and return list top
+      SlipDatum         remove(unsigned n);                                     // Remove and return value n
+      SlipUnrolledList& replace(unsigned n, const SlipDatum& X);                // Replace value n with X
+
+      SlipDatum         operator[](unsigned n) const;                           // Return value n
+
+      unsigned          chunks() const { return nodes; }                        // Number of chunks
+      bool              isEmpty() const { return cells == 0; }                  // true if the list is empty
+      unsigned          size() const { return cells; }                          // Number of values in list
+      SlipHeader&       toList() const;                                         // Linked copy of the list
+      bool              write(ostream& out) const;                              // Output the list
+      string            writeToString() const;                                  // Return an ASCII formated list as a string
+   }; // class SlipUnrolledList
+}; // namespace slip
+
+#endif	/* _SLIPUNROLLEDLIST_H */
@@ -299,6 +299,7 @@ namespace slip {
     * @param[in] head (SlipHeader&) list header
     */
    void SlipWrite::pass1(SlipHeader& head)  {
+      SlipCellBase::loadList(&head);                                           // a list waiting to be input is input
 
       if (head.isDList()) {                                                    // is Descriptor List
          SlipHeader& dList  = **(SlipHeader**)SlipCellBase::getHeadDescList((SlipCellBase&)head);
@@ -308,25 +309,22 @@ namespace slip {
       if (registerSublist(head)) numEntries++;
       else return;
 
-      SlipSequencer* seq = new SlipSequencer(head);
-      seq->advanceLWR();
-      while(*seq != head) {
-         if (seq->isSublist()) {
-            SlipSublist& sublist = (SlipSublist&)seq->currentCell();
+      for (SlipCell& cell : head) {
+         if (cell.isSublist()) {
+            SlipSublist& sublist = (SlipSublist&)cell;
             SlipHeader* header = *(SlipHeader**)SlipCellBase::getSublistHeader(sublist);
+            SlipCellBase::loadList(header);
 //            if ((!header->isEmpty()) || (header->isDList()))
                pass1(*header);
-         } else if (seq->isPtr()) {
-            SlipDatum& userData = (SlipDatum&)(seq->currentCell());
+         } else if (cell.isPtr()) {
+            SlipDatum& userData = (SlipDatum&)cell;
             if (registerUserData(userData)) {
                numEntries++;
                userEntries++;
                nameSize = max(nameSize, (int)((userData.getName()).size()));
             }
          }
-         seq->advanceLWR();
       }
-      delete seq;
    }; // void SlipWrite::pass1(SlipHeader& header)
 
    /**
@@ -481,6 +479,7 @@ namespace slip {
     * @param[in] header (SlipHeader&) list header
     */
    void SlipWrite::writeList(SlipHeader& header) {
+      SlipCellBase::loadList(&header);
       if (header.getMark()) {
          output("{");
          stringstream pretty;
@@ -493,20 +492,18 @@ namespace slip {
          writeDescriptionList(dList);
       }
       if (!header.isEmpty()) {
-         SlipSequencer* seq = new SlipSequencer(header);
-         seq->advanceLWR();
-         while(!seq->isHeader()) {
-            SlipCell& cell = seq->currentCell();
-            if (seq->isPtr()) {
+         for (SlipCell& cell : header) {
+            if (cell.isPtr()) {
                SlipDatum& datum = (SlipDatum&)cell;
                output(datum.getName());
                output(datum.write());
-            } else if (seq->isData()) {
+            } else if (cell.isData()) {
                SlipDatum& datum = (SlipDatum&)cell;
                output(datum.write());
             } else {                                                            // sublist
                SlipHeader& sublist = (SlipHeader&)cell;
                SlipHeader& header = **(SlipHeader**)SlipCellBase::getSublistHeader(sublist);
+               SlipCellBase::loadList(&header);
                string name = getSublistName(header);
                if (name != "") output("{" + name + "}");
                else {
@@ -515,9 +512,7 @@ namespace slip {
                   output(")");
                }
             }
-            seq->advanceLWR();
          }
-         delete seq;
       }
    }; // void SlipWrite::writeList(SlipHeader& header))
 
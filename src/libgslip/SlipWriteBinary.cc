@@ -0,0 +1,233 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+
+/**
+ * @file    SlipWriteBinary.cc
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ */
+
+ # include <string>
+ # include "SlipWriteBinary.h"
+ # include "SlipCellBase.h"
+ # include "SlipDatum.h"
+ # include "SlipErr.h"
+ # include "SlipPointer.h"
+ # include "SlipSublist.h"
+
+namespace slip {
+
+   const char SlipWriteBinary::MAGIC[4] = { 'S', 'L', 'P', 'B' };
+
+   /*********************************************************
+    *               Constructors & Destructors              *
+   **********************************************************/
+
+   /**
+    * @brief Output a list to a stream.
+    * <p>The stream should be opened in binary mode.</p>
+    * @param[in] head (SlipHeader&) list to be output
+    * @param[in] out (ostream&) output stream
+    */
+   SlipWriteBinary::SlipWriteBinary(SlipHeader& head, ostream& out)
+                                   : errorReturn(0), out(out), written(0) {
+      buffer.reserve(BUFSIZE);
+      writeDriver(head);
+   }; // SlipWriteBinary::SlipWriteBinary(SlipHeader& head, ostream& out)
+
+   /**
+    * @brief Copy constructor.
+    * <p>This is not available for use.</p>
+    * @param orig (SlipWriteBinary&) reference to SlipWriteBinary object
+    */
+   SlipWriteBinary::SlipWriteBinary(const SlipWriteBinary& orig) : out(orig.out) {
+   }; // SlipWriteBinary::SlipWriteBinary(const SlipWriteBinary& orig)
+
+   /*********************************************************
+    *                        Methods                        *
+   **********************************************************/
+
+   /**
+    * @brief Output the buffer to the stream.
+    */
+   void SlipWriteBinary::flush() {                                              // Output the buffer
+      if (!buffer.empty()) out.write(buffer.data(), buffer.size());
+      written += buffer.size();
+      buffer.clear();
+   }; // void SlipWriteBinary::flush()
+
+   /**
+    * @brief Return the list number of a list.
+    * <p>A list not seen before is given the next list number and is
+    *    queued for output.</p>
+    * @param[in] header (SlipHeader&) list header
+    * @return list number
+    */
+   ULONG SlipWriteBinary::getListNo(SlipHeader& header) {                       // Number a list
+      pair<unordered_map<const SlipHeader*, ULONG>::iterator, bool> entry =
+                         listNo.insert(make_pair(&header, (ULONG)lists.size()));
+      if (entry.second) lists.push_back(&header);
+      return entry.first->second;
+   }; // ULONG SlipWriteBinary::getListNo(SlipHeader& header)
+
+   /**
+    * @brief Put a value into the buffer.
+    * <p>The buffer is output when it is full. A value larger than the
+    *    buffer is output directly.</p>
+    * @param[in] value (void*) value bytes
+    * @param[in] size (size_t) number of bytes
+    */
+   void SlipWriteBinary::put(const void* value, size_t size) {                  // Buffer a value
+      if (buffer.size() + size > BUFSIZE) {
+         flush();
+         if (size > BUFSIZE) {
+            out.write((const char*)value, size);
+            written += size;
+            return;
+         }
+      }
+      buffer.insert(buffer.end(), (const char*)value, (const char*)value + size);
+   }; // void SlipWriteBinary::put(const void* value, size_t size)
+
+   /**
+    * @brief Output the user mark, descriptor list and cells of a list.
+    * <p>The descriptor list is output in place, it can not be shared.</p>
+    * @param[in] header (SlipHeader&) list header
+    */
+   void SlipWriteBinary::writeBody(SlipHeader& header) {                        // Output a list body
+      SlipCellBase::loadList(&header);
+      put<USHORT>(header.getMark());
+      if (header.isDList()) {
+         put<UCHAR>(1);
+         writeBody(**(SlipHeader**)SlipCellBase::getHeadDescList((SlipCellBase&)header));
+      } else {
+         put<UCHAR>(0);
+      }
+      for (SlipCell& cell : header) writeCell(cell);
+      put<UCHAR>(eUNDEFINED);
+   }; // void SlipWriteBinary::writeBody(SlipHeader& header)
+
+   /**
+    * @brief Output a cell.
+    * @param[in] cell (SlipCell&) data or sublist cell
+    */
+   void SlipWriteBinary::writeCell(SlipCell& cell) {                            // Output a cell
+      ClassType type = cell.getClassType();
+      put<UCHAR>(type);
+      switch(type) {
+         case eBOOL:
+            put<UCHAR>(*SlipCellBase::getBool(cell));
+            break;
+         case eCHAR:
+            put<CHAR>(*SlipCellBase::getChar(cell));
+            break;
+         case eUCHAR:
+            put<UCHAR>(*SlipCellBase::getUChar(cell));
+            break;
+         case eLONG:
+            put<LONG>(*SlipCellBase::getLong(cell));
+            break;
+         case eULONG:
+            put<ULONG>(*SlipCellBase::getULong(cell));
+            break;
+         case eDOUBLE:
+            put<DOUBLE>(*SlipCellBase::getDouble(cell));
+            break;
+         case eSTRING: {
+            string str = ((SlipDatum&)cell).toString();
+            put<ULONG>(str.size());
+            put(str.data(), str.size());
+            break;
+         }
+         case eSUBLIST:
+            put<ULONG>(getListNo(((SlipSublist&)cell).getHeader()));
+            break;
+         case ePTR:
+            writeUserData((SlipDatum&)cell);
+            break;
+         default:
+            break;
+      }
+   }; // void SlipWriteBinary::writeCell(SlipCell& cell)
+
+   /**
+    * @brief Output the list and all lists it references.
+    * <p>Lists are output in list number order. A list referenced by a
+    *    list being output is numbered and queued, the queue ends when
+    *    every referenced list has been output. The User Data names and
+    *    the list index follow the lists. The User Data lists are deleted
+    *    after the output, their sublists are numbered by address and must
+    *    not be reused during the output.</p>
+    * @param[in] head (SlipHeader&) list to be output
+    */
+   void SlipWriteBinary::writeDriver(SlipHeader& head) {                        // Execute write actions
+      put(MAGIC, sizeof(MAGIC));
+      put<UCHAR>(VERSION);
+      put<ULONG>(ORDER);
+      getListNo(head);
+      for (size_t i = 0; i < lists.size(); i++) {
+         position.push_back(tell());
+         put<UCHAR>(LIST);
+         writeBody(*lists[i]);
+      }
+      put<UCHAR>(END);
+      uint64_t namesPosition = tell();
+      put<ULONG>(names.size());
+      for (size_t i = 0; i < names.size(); i++) {
+         put<USHORT>(names[i].size());
+         put(names[i].data(), names[i].size());
+      }
+      put<ULONG>(position.size());
+      for (size_t i = 0; i < position.size(); i++) put<uint64_t>(position[i]);
+      put<uint64_t>(namesPosition);
+      put(MAGIC, sizeof(MAGIC));
+      flush();
+      out.flush();
+      if (!out.good()) errorReturn = 2;
+      for (size_t i = 0; i < userLists.size(); i++) userLists[i]->deleteList();
+   }; // void SlipWriteBinary::writeDriver(SlipHeader& head)
+
+   /**
+    * @brief Output a User Data cell.
+    * <p>The User Data name number is output, the names are output after
+    *    the lists. The User Data is put into a list by
+    *    <b>SlipPointer::toList()</b> and the list body is output.</p>
+    * @param[in] datum (SlipDatum&) User Data cell
+    */
+   void SlipWriteBinary::writeUserData(SlipDatum& datum) {                      // Output a User Data cell
+      string name = datum.getName();
+      pair<unordered_map<string, ULONG>::iterator, bool> entry =
+                         nameNo.insert(make_pair(name, (ULONG)nameNo.size()));
+      put<ULONG>(entry.first->second);
+      if (entry.second) names.push_back(name);
+      SlipHeader& list = *new SlipHeader();
+      userLists.push_back(&list);
+      if (!(*SlipCellBase::getPtr(datum))->toList(list)) {
+         postError(__FILE__, __LINE__, SlipErr::E4021, "SlipWriteBinary::writeUserData", "", name);
+         errorReturn = 1;
+      }
+      writeBody(list);
+   }; // void SlipWriteBinary::writeUserData(SlipDatum& datum)
+
+}; // namespace slip
@@ -0,0 +1,141 @@
+// Copyright (C) 2014 Arthur I. Schwarz
+//
+// This file is part of the C++ SLIP library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+
+/**
+ * @file    SlipWriteBinary.h
+ * @author  A. Schwarz
+ * @date    October 17, 2026
+ *
+ * @brief Output a list in binary form
+ */
+
+#ifndef SLIPWRITEBINARY_H
+#define	SLIPWRITEBINARY_H
+
+# include <cstdint>
+# include <iostream>
+# include <string>
+# include <unordered_map>
+# include <vector>
+# include "SlipDef.h"
+# include "SlipHeader.h"
+
+using namespace std;
+
+namespace slip {
+
+   /**
+    * @class SlipWriteBinary
+    * <p><b>Overview</b></p>
+    * <p>Output a single list onto a stream in a compact binary form. The
+    *    list is read with SlipReadBinary. The binary form holds the same
+    *    information as the ASCII form written by SlipWrite, and is not
+    *    formatted, scanned or parsed:</p>
+    * <ul>
+    *    <li>Numbers are written as their bytes. A DOUBLE is read back with
+    *        the same bit pattern, there is no conversion to and from text.</li>
+    *    <li>Each list is written once. A list referenced from several
+    *        sublist cells, or from itself, is written as a list number and
+    *        the input list has the same sharing.</li>
+    *    <li>The user mark and the descriptor list of every list are
+    *        written.</li>
+    *    <li>User Data is written as its name and the list returned by
+    *        <b>SlipPointer::toList()</b>. The list is given to the User
+    *        Data parse method when the file is read. User Data without a
+    *        binary form is written with an empty list and a warning.</li>
+    * </ul>
+    * <p>Output is buffered and a block is written to the stream when the
+    *    buffer is full. The writer makes one pass over each list, lists
+    *    are numbered as they are found in sublist cells and written in
+    *    number order. The list reference counts are not written, they are
+    *    recreated by the reader from the sublist references.</p>
+    * <p>The file ends with the User Data names and an index of the file
+    *    position of each list. SlipMappedRead uses the index to input a
+    *    list when it is first used.</p>
+    * <p><b>Format</b></p>
+    * <p>Values are in the byte order of the writer, the reader converts
+    *    the byte order when required.</p>
+    * <pre><tt>
+    *    file:      "SLPB" version(UCHAR) order(ULONG) list... END names index trailer
+    *    list:      LIST body
+    *    body:      mark(USHORT) dlist cell... eUNDEFINED
+    *    dlist:     0 | 1 body
+    *    cell:      eBOOL     value(UCHAR)
+    *             | eCHAR     value(CHAR)
+    *             | eUCHAR    value(UCHAR)
+    *             | eLONG     value(LONG)
+    *             | eULONG    value(ULONG)
+    *             | eDOUBLE   value(DOUBLE)
+    *             | eSTRING   size(ULONG) bytes
+    *             | eSUBLIST  list number(ULONG)
+    *             | ePTR      name number(ULONG) body
+    *    names:     count(ULONG) { size(USHORT) bytes }...
+    *    index:     count(ULONG) { list position(uint64_t) }...
+    *    trailer:   names position(uint64_t) "SLPB"
+    * </tt></pre>
+    * <p>The tags are the ClassType values. List number 0 is the output
+    *    list. File positions are byte offsets from the start of the file.</p>
+    * <pre>
+    *    ofstream out("list.slb", ios::binary);
+    *    SlipWriteBinary write(list, out);
+    * </pre>
+    */
+   class SlipWriteBinary {
+   public:
+      enum { VERSION = 1                                                        //!< binary format version
+           , ORDER   = 0x01020304                                               //!< byte order mark
+           , LIST    = 0xF0                                                     //!< list record tag
+           , END     = 0xFF                                                     //!< end of file tag
+           , BUFSIZE = 65536                                                    //!< output block size
+      };
+      static const char MAGIC[4];                                               //!< file identification
+   private:
+      int errorReturn;                                                          //!< Error flag
+      ostream& out;                                                             //!< Output file
+      vector<char> buffer;                                                      //!< Output block
+      vector<SlipHeader*> lists;                                                //!< lists in list number order
+      vector<SlipHeader*> userLists;                                            //!< User Data lists written
+      vector<uint64_t> position;                                                //!< file position of each list
+      vector<string> names;                                                     //!< User Data names in name number order
+      uint64_t written;                                                         //!< bytes output to the stream
+      unordered_map<const SlipHeader*, ULONG> listNo;                           //!< list number of each list
+      unordered_map<string, ULONG> nameNo;                                      //!< name number of each User Data name
+   private:
+      SlipWriteBinary(const SlipWriteBinary& orig);
+      void   flush();                                                           // Output the buffer
+      ULONG  getListNo(SlipHeader& header);                                     // Number a list
+      uint64_t tell() const { return written + buffer.size(); }                 // Current file position
+      void   put(const void* value, size_t size);                               // Buffer a value
+      template <class T>
+      void   put(T value) { put(&value, sizeof(T)); }                           // Buffer a value
+      void   writeBody(SlipHeader& header);                                     // Output a list body
+      void   writeCell(SlipCell& cell);                                         // Output a cell
+      void   writeDriver(SlipHeader& head);                                     // Execute write actions
+      void   writeUserData(SlipDatum& datum);                                   // Output a User Data cell
+   public:
+      SlipWriteBinary(SlipHeader& head, ostream& out);
+      int    getError() const { return errorReturn; }                           // Return the write status
+   }; // class SlipWriteBinary
+}; // namespace slip
+
+#endif	/* SLIPWRITEBINARY_H */
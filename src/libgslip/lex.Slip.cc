@@ -196,9 +196,9 @@ typedef struct yy_buffer_state *YY_BUFFER_STATE;
 typedef size_t yy_size_t;
 #endif
 
-extern yy_size_t Slipleng;
+extern thread_local yy_size_t Slipleng;
 
-extern FILE *Slipin, *Slipout;
+extern thread_local FILE *Slipin, *Slipout;
 
 #define EOB_ACT_CONTINUE_SCAN 0
 #define EOB_ACT_END_OF_FILE 1
@@ -288,9 +288,9 @@ struct yy_buffer_state
 #endif /* !YY_STRUCT_YY_BUFFER_STATE */
 
 /* Stack of input buffers. */
-static size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
-static size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
-static YY_BUFFER_STATE * yy_buffer_stack = 0; /**< Stack as an array. */
+static thread_local size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
+static thread_local size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
+static thread_local YY_BUFFER_STATE * yy_buffer_stack = 0; /**< Stack as an array. */
 
 /* We provide macros for accessing buffer states in case in the
  * future we want to put the buffer states in a more general
@@ -308,19 +308,19 @@ static YY_BUFFER_STATE * yy_buffer_stack = 0; /**< Stack as an array. */
 #define YY_CURRENT_BUFFER_LVALUE (yy_buffer_stack)[(yy_buffer_stack_top)]
 
 /* yy_hold_char holds the character lost when Sliptext is formed. */
-static char yy_hold_char;
-static yy_size_t yy_n_chars;		/* number of characters read into yy_ch_buf */
-yy_size_t Slipleng;
+static thread_local char yy_hold_char;
+static thread_local yy_size_t yy_n_chars;		/* number of characters read into yy_ch_buf */
+thread_local yy_size_t Slipleng;
 
 /* Points to current character in buffer. */
-static char *yy_c_buf_p = (char *) 0;
-static int yy_init = 0;		/* whether we need to initialize */
-static int yy_start = 0;	/* start state number */
+static thread_local char *yy_c_buf_p = (char *) 0;
+static thread_local int yy_init = 0;		/* whether we need to initialize */
+static thread_local int yy_start = 0;	/* start state number */
 
 /* Flag which is used to allow Slipwrap()'s to do buffer switches
  * instead of setting up a fresh Slipin.  A bit of a hack ...
  */
-static int yy_did_buffer_switch_on_eof;
+static thread_local int yy_did_buffer_switch_on_eof;
 
 void Sliprestart (FILE *input_file  );
 void Slip_switch_to_buffer (YY_BUFFER_STATE new_buffer  );
@@ -375,15 +375,15 @@ void Slipfree (void *  );
 
 typedef unsigned char YY_CHAR;
 
-FILE *Slipin = (FILE *) 0, *Slipout = (FILE *) 0;
+thread_local FILE *Slipin = (FILE *) 0, *Slipout = (FILE *) 0;
 
 typedef int yy_state_type;
 
-extern int Sliplineno;
+extern thread_local int Sliplineno;
 
-int Sliplineno = 1;
+thread_local int Sliplineno = 1;
 
-extern char *Sliptext;
+extern thread_local char *Sliptext;
 #define yytext_ptr Sliptext
 
 static yy_state_type yy_get_previous_state (void );
@@ -749,11 +749,11 @@ static yyconst flex_int16_t yy_chk[996] =
 
     } ;
 
-static yy_state_type yy_last_accepting_state;
-static char *yy_last_accepting_cpos;
+static thread_local yy_state_type yy_last_accepting_state;
+static thread_local char *yy_last_accepting_cpos;
 
-extern int Slip_flex_debug;
-int Slip_flex_debug = 0;
+extern thread_local int Slip_flex_debug;
+thread_local int Slip_flex_debug = 0;
 
 /* The intent behind this definition is that it'll catch
  * any uses of REJECT which flex missed.
@@ -762,17 +762,20 @@ int Slip_flex_debug = 0;
 #define yymore() yymore_used_but_not_detected
 #define YY_MORE_ADJ 0
 #define YY_RESTORE_YY_MORE_OFFSET
-char *Sliptext;
+thread_local char *Sliptext;
 /*
   * Maintenance:
   * Compile: flex --noline slip.lex
   * Fixup:   cp lex.Slip.c ../slip/lex.Slip.cpp;
+  *          declare the scanner state thread_local, each thread scans
+  *          with its own buffer stack, include stack and position.
  */
 # include <stdio.h>
 # include <cerrno>
 # include <cstdlib>
 # include <cstring>
 # include <ctype.h>
+# include <istream>
 # include <string>
 # include <stdint.h>
 # include "lex.Slip.h"
@@ -799,12 +802,14 @@ double myatof(char * const);
    
    using namespace std;
    
-   bool  lexerDebugFlag = false;
+   thread_local bool lexerDebugFlag = false;
+   thread_local bool lexerQuietFlag = false;       /* count, do not output messages */
+   thread_local int  lexerMessageCount = 0;        /* messages seen since quiet on */
 
    string getFileName();                           /* get current file name */
 
-   int  col = 1;                                   /* start column of token */
-   int  lineno = 1;                                /* line number of token  */
+   thread_local int col = 1;                       /* start column of token */
+   thread_local int lineno = 1;                    /* line number of token  */
    
 #define INITIAL 0
 #define COMMENT 1
@@ -1433,7 +1438,7 @@ YY_RULE_SETUP
                                    } while (xTable[(int)*ptr]);
                                    unput(*ptr);
                                    *ptr = 0;
-                                   printf("Lex: %s:%d.%d illegal character(s) in file \"%s\"\n"
+                                   if (lexerMessage()) printf("Lex: %s:%d.%d illegal character(s) in file \"%s\"\n"
                                          , getFileName().c_str(), lineno, col, buffer);
                                    col += (ptr - buffer);
                                  }
@@ -1514,7 +1519,7 @@ YY_RULE_SETUP
                                        col += Slipleng;
                                        BEGIN(INITIAL); 
                                        if (string_buf->size() > 1) {
-                                          printf("Lex: %s:%d.%d converting to string \"%s\"\n"
+                                          if (lexerMessage()) printf("Lex: %s:%d.%d converting to string \"%s\"\n"
                                                         , getFileName().c_str(), lineno, col, string_buf->c_str());
                                           yylval->STRING = string_buf;
                                           return TOKEN::STRING;
@@ -1533,7 +1538,7 @@ YY_RULE_SETUP
 case YY_STATE_EOF(STRING_CHAR):
 { DEBUG(lexerDebugFlag, printf("Lex: %3d:%4d END STRING FAIL    \"%s\"\n", lineno, col, string_buf->c_str());) 
                                    col += Slipleng;
-                                   printf("Lex: %s:%d.%d EOF file before terminal quote \"%s\": ignored\n"
+                                   if (lexerMessage()) printf("Lex: %s:%d.%d EOF file before terminal quote \"%s\": ignored\n"
                                                  , getFileName().c_str(), lineno, col, string_buf->c_str());
                                    BEGIN(INITIAL); 
                                    yylval->STRING = string_buf;
@@ -1574,7 +1579,7 @@ YY_RULE_SETUP
                                    r.array[4] = 0;
                                    (void) sscanf( (Sliptext + 1), "%d", &r.result );
                                    if (r.result > 0xFF) {
-                                     printf("Lex: %s:%d.%d illegal decimal number in file \"%s\": ignored\n"
+                                     if (lexerMessage()) printf("Lex: %s:%d.%d illegal decimal number in file \"%s\": ignored\n"
                                                    , getFileName().c_str(), lineno, col, Sliptext);
                                    } else string_buf->append(&r.array[0]);
                                  }
@@ -2632,7 +2637,7 @@ using namespace std;
  * @brief Instantiation of state push/pop functionality
  */
 class LexStateVariables;
-LexStateVariables * variables = NULL;
+thread_local LexStateVariables * variables = NULL;
 
 /**
  * @class LexStateVariables
@@ -2793,7 +2798,7 @@ class LexStateVariables {
     * @param[out] col (int) column number of previous context
     */
    void restoreLexState(int* lineno, int* col) {
-      fclose(stack[ndx-1].file);
+      if (stack[ndx-1].file) fclose(stack[ndx-1].file);
       Slippop_buffer_state();
       pop(lineno, col);
       return;
@@ -2813,7 +2818,7 @@ class LexStateVariables {
       errno = 0;
       FILE * file = fopen(fileName.c_str(), "r");
       if (!file) {
-         printf("Lexer:saveLexState Open File Error %s\n", strerror(errno));
+         if (lexerMessage()) printf("Lexer:saveLexState Open File Error %s\n", strerror(errno));
          errno = 0;
          retval = false;
       } else {
@@ -2824,6 +2829,37 @@ class LexStateVariables {
       }
       return retval;
    }; // bool saveLexState(string fileName)
+
+   /*
+    * @brief Stack the current state and scan a memory block.
+    *
+    * <p>The block is scanned in place as by Slip_scan_buffer. The block
+    *    must have room for the two end of buffer characters after the
+    *    input, the scanner owns the block and frees it when the state
+    *    is restored.</p>
+    *
+    * @param[in] name (string) name of the input used in messages
+    * @param[in] base (char*) block allocated with Slipalloc
+    * @param[in] length (yy_size_t) number of input characters in the block
+    */
+   void saveLexState(string name, char* base, yy_size_t length) {
+      base[length] = base[length+1] = YY_END_OF_BUFFER_CHAR;
+      YY_BUFFER_STATE state = (YY_BUFFER_STATE) Slipalloc(sizeof(struct yy_buffer_state));
+      if (!state)
+         YY_FATAL_ERROR( "out of dynamic memory in saveLexState()" );
+      state->yy_buf_size       = length;
+      state->yy_buf_pos        = state->yy_ch_buf = base;
+      state->yy_is_our_buffer  = 1;
+      state->yy_input_file     = 0;
+      state->yy_n_chars        = length;
+      state->yy_is_interactive = 0;
+      state->yy_at_bol         = 1;
+      state->yy_fill_buffer    = 0;
+      state->yy_buffer_status  = YY_BUFFER_NEW;
+      Slippush_buffer_state(state);
+      push(lineno, col, name, NULL);
+      lineno = col = 1;
+   }; // void saveLexState(string name, char* base, yy_size_t length)
    
    /**
     * @brief pretty print an entry from the stack.
@@ -2845,6 +2881,7 @@ class LexStateVariables {
  */
 void deleteLexState() {
    if (variables) delete variables;
+   variables = NULL;
    while(YY_CURRENT_BUFFER) Slippop_buffer_state ( );
 }; // void deleteLexState()
 
@@ -2891,7 +2928,7 @@ string getFileName() {
 FILE* openFile(string filename) {
    FILE * file = fopen(filename.c_str(), "r");
    if (!file) {
-      printf("Lexer:saveLexState Open File Error %s\n", strerror(errno));
+      if (lexerMessage()) printf("Lexer:saveLexState Open File Error %s\n", strerror(errno));
    }
    return file;
 }; // FILE* openFile(string filename)
@@ -2911,8 +2948,10 @@ FILE* openFile(string filename) {
  */
 bool restoreLexState() {
    bool flag = YY_CURRENT_BUFFER;
-   if (!flag) delete variables;
-   else variables->restoreLexState(&lineno, &col);
+   if (!flag) {
+      delete variables;
+      variables = NULL;
+   } else variables->restoreLexState(&lineno, &col);
    return flag;
 }; // bool restoreLexState()
 
@@ -2939,6 +2978,82 @@ bool saveLexState(const string filename) {
    return variables->saveLexState(filename);
 }; // bool saveLexState(string filename)
 
+/**
+ * @brief Stack the current state and scan a character buffer.
+ *
+ * <p>The buffer is copied once into a scanner buffer and scanned there,
+ *    there is no intermediate file. The caller keeps ownership of the
+ *    buffer.</p>
+ *
+ * @param[in] name (string) name of the input used in messages
+ * @param[in] buffer (const char*) characters to be scanned
+ * @param[in] length (size_t) number of characters in the buffer
+ * @return <b>true</b> save successful
+ */
+bool saveLexState(const string name, const char* buffer, size_t length) {
+   char* base = (char*) Slipalloc(length + 2);
+   if (!base)
+      YY_FATAL_ERROR( "out of dynamic memory in saveLexState()" );
+   memcpy(base, buffer, length);
+   if (variables == 0)
+      variables = new LexStateVariables();
+   variables->saveLexState(name, base, length);
+   return true;
+}; // bool saveLexState(const string name, const char* buffer, size_t length)
+
+/**
+ * @brief Stack the current state and scan an input stream.
+ *
+ * <p>The stream is read to its end into a scanner buffer which grows
+ *    geometrically, and the buffer is scanned in place. There is no
+ *    intermediate file.</p>
+ *
+ * @param[in] name (string) name of the input used in messages
+ * @param[in] in (istream&) input stream
+ * @return <b>true</b> the stream was read without error
+ */
+bool saveLexState(const string name, istream& in) {
+   yy_size_t size   = YY_BUF_SIZE;
+   yy_size_t length = 0;
+   char* base = (char*) Slipalloc(size + 2);
+   while (base) {
+      in.read(base + length, size - length);
+      length += in.gcount();
+      if (length < size) break;
+      size *= 2;
+      base  = (char*) Sliprealloc(base, size + 2);
+   }
+   if (!base)
+      YY_FATAL_ERROR( "out of dynamic memory in saveLexState()" );
+   if (in.bad()) {
+      if (lexerMessage()) printf("Lexer:saveLexState Stream Read Error\n");
+      Slipfree(base);
+      return false;
+   }
+   if (variables == 0)
+      variables = new LexStateVariables();
+   variables->saveLexState(name, base, length);
+   return true;
+}; // bool saveLexState(const string name, istream& in)
+
+/**
+ * @brief Count a scanner or parser message.
+ * <p>When quiet is on the message is counted and not output.</p>
+ * @return <b>true</b> output the message
+ */
+bool lexerMessage() {
+   lexerMessageCount++;
+   return !lexerQuietFlag;
+}; // bool lexerMessage()
+
+/**
+ * @brief Return the number of messages counted since quiet was turned on.
+ * @return number of messages
+ */
+int getLexerMessageCount() {
+   return lexerMessageCount;
+}; // int getLexerMessageCount()
+
 /**
  * @brief Turn debugging on.
 */
@@ -2953,6 +3068,21 @@ void setLexerDebugOFF() {
    lexerDebugFlag = false;
 }; // void setLexerDebugOFF()
 
+/**
+ * @brief Turn quiet on, messages are counted and not output.
+*/
+void setLexerQuietON() {
+   lexerQuietFlag = true;
+   lexerMessageCount = 0;
+}; // void setLexerQuietON()
+
+/**
+ * @brief Turn quiet off, messages are output.
+*/
+void setLexerQuietOFF() {
+   lexerQuietFlag = false;
+}; // void setLexerQuietOFF()
+
 /**
  * @brief Converts a <i>hexfloat</i> into a double.
  * <p>The conforms to the IEEE 754 layout of double precision 64-bit) floating
@@ -33,6 +33,7 @@
 #ifndef LEX_SLIP_H
 #define	LEX_SLIP_H
 
+# include <istream>
 # include <string>
 # include "Slip.Bison.hpp"
 
@@ -77,6 +78,18 @@ extern bool restoreLexState();
   */
 extern bool saveLexState(string fileName);
 
+ /**
+  * @brief Save the current state and scan a character buffer.
+  * @return <b>true</b> save successful
+  */
+extern bool saveLexState(const string name, const char* buffer, size_t length);
+
+ /**
+  * @brief Save the current state and scan an input stream.
+  * @return <b>true</b> the stream was read
+  */
+extern bool saveLexState(const string name, istream& in);
+
 /**
  * @brief Turn debugging on.
 */
@@ -87,6 +100,28 @@ extern void setLexerDebugON();
 */
 extern void setLexerDebugOFF();
 
+/**
+ * @brief Turn quiet on, messages are counted and not output.
+*/
+extern void setLexerQuietON();
+
+/**
+ * @brief Turn quiet off, messages are output.
+*/
+extern void setLexerQuietOFF();
+
+/**
+ * @brief Count a scanner or parser message.
+ * @return <b>true</b> output the message
+ */
+extern bool lexerMessage();
+
+/**
+ * @brief Return the number of messages counted since quiet was turned on.
+ * @return number of messages
+ */
+extern int getLexerMessageCount();
+
 /**
  *@brief Scanner Name.
  */
@@ -82,6 +82,7 @@ int main(int argc, char** argv) {
                         , testSplitRight
                         , testMoveLeft
                         , testMoveRight
+                        , testHeaderSize
                         , testReplace
                         , testDList
                         , testReader
@@ -89,6 +90,10 @@ int main(int argc, char** argv) {
                         , testOperators
                         , testIO
                         , testErrors
+                        , testThreads
+                        , testGrowth
+                        , testReclaim
+                        , testTrim
    };
    totalTests = sizeof(tests)/sizeof(tests[0]);
    
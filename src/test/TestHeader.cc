@@ -39,15 +39,22 @@
 # include "../libgslip/SlipCell.h"
 # include "../libgslip/SlipDatum.h"
 # include "../libgslip/SlipHeader.h"
+# include "../libgslip/SlipPackedList.h"
 # include "../libgslip/SlipSublist.h"
+# include "../libgslip/SlipUnrolledList.h"
 
 using namespace slip;
 using namespace std;
 
 bool testDListCore();
 bool testDListNonCore();
+bool testDListIndexed();
+bool testHeaderReduce();
+bool testPackedList();
+bool testUnrolledList();
 bool checkHeaderInsert(string str, SlipHeader* head, USHORT before);
 bool checkHeaderDelete(string str, SlipHeader* head, USHORT before);
+bool checkHeaderSize(string str, SlipHeader* head);
 
 bool checkHeaderInsert(string str, SlipHeader* head, USHORT before) {
    bool flag = true;
@@ -104,6 +111,7 @@ bool testDList() {
    bool flag = true;
    flag = (testDListCore())? flag: false;
    flag = (testDListNonCore())? flag: false;
+   flag = (testDListIndexed())? flag: false;
    
    high_resolution_clock::time_point end =  high_resolution_clock::now();
    duration<double> seconds = duration_cast<duration<double>>(end - start);
@@ -313,6 +321,96 @@ bool testDListNonCore() {
    return flag;
 }; // bool testDlistNonCore()
 
+bool testDListIndexed() {
+   stringstream pretty;
+   bool flag = true;
+   const LONG pairs = 64;
+   SlipHeader* header = new SlipHeader();
+   header->create_dList();
+   for (LONG i = 0; i < pairs; i++) {
+      stringstream value;
+      value << "value " << i;
+      header->put(*new SlipDatum(i), *new SlipDatum(value.str()));
+   }
+   SlipDatum* key0   = new SlipDatum((LONG)0);
+   SlipDatum* value0 = new SlipDatum((LONG)-1);
+   header->put(*key0, *value0);
+   delete key0;
+   delete value0;
+   if (header->size_dList() != (unsigned)pairs) {
+      flag = false;
+      pretty << "Test[ 1] put of an existing key changed the Descriptor List size " << header->size_dList();
+   }
+   for (LONG i = 0; flag && (i < pairs); i++) {
+      stringstream value;
+      value << "value " << i;
+      SlipDatum key((DOUBLE)i);
+      SlipDatum datum(value.str());
+      if (!header->containsKey(key) || !header->contains(datum) || (header->get(key) != datum)) {
+         flag = false;
+         pretty << "Test[ 2] key " << i << " not found through the index";
+      }
+   }
+   for (LONG i = 0; i < pairs; i += 2) {
+      SlipDatum key(i);
+      header->deleteAttribute(key);
+   }
+   for (LONG i = 0; flag && (i < pairs); i++) {
+      SlipDatum key((ULONG)i);
+      if (header->containsKey(key) != ((i % 2) != 0)) {
+         flag = false;
+         pretty << "Test[ 3] key " << i << " wrong after deleteAttribute";
+      }
+   }
+   SlipHeader& dList = header->getDList();
+   SlipCell&   top   = dList.getTop();
+   SlipDatum   key((SlipDatum&)top);
+   delete &dList.pop();
+   delete &dList.pop();
+   if (flag && header->containsKey(key)) {
+      flag = false;
+      pretty << "Test[ 4] key " << key.toString() << " found after a direct pop";
+   }
+   if (flag && (header->size_dList() != (unsigned)(pairs / 2 - 1))) {
+      flag = false;
+      pretty << "Test[ 5] Descriptor List size " << header->size_dList();
+   }
+   SlipDatum oldKey((LONG)1);
+   SlipDatum newKey((LONG)1001);
+   SlipDatum newValue((LONG)-1001);
+   SlipCell& value1 = header->get(oldKey);
+   value1 = (LONG)-1001;
+   if (flag && !header->contains(newValue)) {
+      flag = false;
+      pretty << "Test[ 6] value assigned through get() not found";
+   }
+   value1.replace((LONG)-1002);
+   newValue = (LONG)-1002;
+   if (flag && !header->contains(newValue)) {
+      flag = false;
+      pretty << "Test[ 7] value replaced through get() not found";
+   }
+   SlipCellBase* keyCell = header->getDList().getRightLink();
+   while ((keyCell != &header->getDList()) && !(*(SlipCell*)keyCell == oldKey))
+      keyCell = keyCell->getRightLink()->getRightLink();
+   *(SlipCell*)keyCell = (LONG)1001;
+   if (flag && (header->containsKey(oldKey) || !header->containsKey(newKey))) {
+      flag = false;
+      pretty << "Test[ 8] key assigned in place not found";
+   }
+   ++(SlipDatum&)*keyCell;
+   newKey = (LONG)1002;
+   if (flag && !header->containsKey(newKey)) {
+      flag = false;
+      pretty << "Test[ 9] key incremented in place not found";
+   }
+   if (!flag) writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   header->deleteList();
+   if (!flag)
+      testResultOutput("Test Descriptor List indexed ", 0.0, flag);
+   return flag;
+}; // bool testDListIndexed()
+
 
 bool testEnqueue() {
    high_resolution_clock::time_point start =  high_resolution_clock::now();
@@ -426,6 +524,215 @@ bool testHeaderMisc() {
    return flag;
 }; // void testHeaderMisc()
 
+bool testHeaderReduce() {
+   bool flag = true;
+   stringstream pretty;
+   SlipHeader* head  = new SlipHeader();
+   SlipHeader* other = new SlipHeader();
+   for (LONG i = 1; i <= 1000; i++) head->enqueue(i);
+   for (LONG i = 1; i <= 1000; i++) other->enqueue((DOUBLE)i);
+
+   SlipDatum total = head->sum();
+   DOUBLE    min, max;
+   if ((total.getClassType() != eLONG) || ((LONG)total != 500500) || (head->mean() != 500.5)
+    || !head->minmax(min, max) || (min != 1) || (max != 1000) || (head->dot(*other) != 333833500.0)) {
+      flag = false;
+      pretty << "Test Header Reduce LONG sum " << total.toString() << " mean " << head->mean();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   head->enqueue((ULONG)1);
+   total = head->sum();
+   if ((total.getClassType() != eULONG) || ((ULONG)total != 500501)) {
+      flag = false;
+      pretty << "Test Header Reduce ULONG sum " << total.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   head->push((DOUBLE)0.5).push((CHAR)-1);
+   total = head->sum();
+   if (!total.isReal() || ((DOUBLE)total != 500500.5)) {
+      flag = false;
+      pretty << "Test Header Reduce DOUBLE sum " << total.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   try {
+      head->dot(*other);
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "Test Header Reduce dot() of different sizes");
+   } catch(SlipException& e) { }
+   head->deleteList();
+   other->deleteList();
+
+   if (!flag) testResultOutput("Test Header Reduce ", 0.0, flag);
+   return flag;
+}; // bool testHeaderReduce()
+
+bool testPackedList() {
+   bool flag = true;
+   stringstream pretty;
+   SlipPackedList packed(eDOUBLE);
+   for (int i = 0; i < 100; i++) packed.enqueue((DOUBLE)i);
+   packed.push((DOUBLE)-1);
+
+   if (!packed.isPacked() || (packed.size() != 101) || (packed.data()[0].Double != -1)
+    || (packed.data()[100].Double != 99) || ((DOUBLE)packed[50] != 49)) {
+      flag = false;
+      pretty << "Test Packed List size " << packed.size();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   SlipHeader& list = packed.toList();
+   SlipPackedList copy(list);
+   if (!copy.isPacked() || (copy.size() != 101) || (copy.writeToString() != list.writeToString())
+    || (packed.writeToString() != list.writeToString())) {
+      flag = false;
+      pretty << "Test Packed List round trip " << copy.writeToString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   list.deleteList();
+   SlipDatum top = packed.pop();
+   SlipDatum bot = packed.dequeue();
+   if (((DOUBLE)top != -1) || ((DOUBLE)bot != 99) || (packed.size() != 99)) {
+      flag = false;
+      pretty << "Test Packed List pop/dequeue " << top.toString() << " " << bot.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   packed.enqueue((LONG)7);
+   if (packed.isPacked() || (packed.size() != 100) || ((LONG)packed[99] != 7)
+    || ((DOUBLE)packed[0] != 0) || !packed.dequeue().isData()) {
+      flag = false;
+      pretty << "Test Packed List linked " << packed.writeToString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+
+   if (!flag) testResultOutput("Test Packed List ", 0.0, flag);
+   return flag;
+}; // bool testPackedList()
+
+bool testUnrolledList() {
+   bool flag = true;
+   stringstream pretty;
+   SlipUnrolledList unrolled;
+   for (int i = 0; i < 100; i++) unrolled.enqueue(SlipDatum((LONG)i));
+   unrolled.push(SlipDatum((DOUBLE)-1));
+   unrolled.insert(50, SlipDatum((ULONG)500));
+
+   if ((unrolled.size() != 102) || ((DOUBLE)unrolled[0] != -1) || ((ULONG)unrolled[50] != 500)
+    || ((LONG)unrolled[51] != 49) || ((LONG)unrolled[101] != 99)) {
+      flag = false;
+      pretty << "Test Unrolled List insert " << unrolled.writeToString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   DOUBLE total = 0;
+   for (SlipUnrolledList::Cursor cursor(unrolled); cursor.advance(); )
+      total += (DOUBLE)cursor.current();
+   if (total != (4950 - 1 + 500)) {
+      flag = false;
+      pretty << "Test Unrolled List cursor sum " << total;
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   SlipHeader& list = unrolled.toList();
+   SlipUnrolledList copy(list);
+   if ((copy.size() != 102) || (copy.writeToString() != list.writeToString())
+    || (unrolled.writeToString() != list.writeToString())) {
+      flag = false;
+      pretty << "Test Unrolled List round trip " << copy.writeToString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   list.deleteList();
+   unsigned chunks = unrolled.chunks();
+   for (int i = 0; i < 90; i++) unrolled.remove(5);
+   if ((unrolled.size() != 12) || (unrolled.chunks() >= chunks)
+    || ((LONG)unrolled[4] != 3) || ((LONG)unrolled[5] != 93)) {
+      flag = false;
+      pretty << "Test Unrolled List remove " << unrolled.chunks() << " " << unrolled.writeToString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   unrolled.replace(0, SlipDatum((CHAR)'a'));
+   SlipDatum top = unrolled.pop();
+   SlipDatum bot = unrolled.dequeue();
+   if (((CHAR)top != 'a') || ((LONG)bot != 99) || (unrolled.size() != 10)) {
+      flag = false;
+      pretty << "Test Unrolled List pop/dequeue " << top.toString() << " " << bot.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   while (!unrolled.isEmpty()) unrolled.pop();
+   if (unrolled.chunks() != 0) {
+      flag = false;
+      pretty << "Test Unrolled List empty " << unrolled.chunks();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+
+   if (!flag) testResultOutput("Test Unrolled List ", 0.0, flag);
+   return flag;
+}; // bool testUnrolledList()
+
+bool checkHeaderSize(string str, SlipHeader* head) {
+   unsigned walk = 0;
+   for (SlipCellBase* link = head->getRightLink(); !link->isHeader(); link = link->getRightLink()) walk++;
+   unsigned count = head->size();
+   if (count != walk) {
+      stringstream pretty;
+      pretty << "Test Header Size " << str << " size() " << count << " != " << walk;
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+      return false;
+   }
+   return true;
+}; // bool checkHeaderSize(string str, SlipHeader* head)
+
+bool testHeaderSize() {
+   high_resolution_clock::time_point start =  high_resolution_clock::now();
+   bool flag              = true;
+   SlipHeader* header     = new SlipHeader();
+   SlipHeader* other      = new SlipHeader();
+   flag = (checkHeaderSize("empty", header))? flag: false;
+   for (LONG i = 0; i < 10; i++) header->enqueue(i);
+   flag = (checkHeaderSize("enqueue", header))? flag: false;
+   header->push((LONG)-1);
+   flag = (checkHeaderSize("push", header))? flag: false;
+   delete &header->pop();
+   delete &header->dequeue();
+   flag = (checkHeaderSize("pop/dequeue", header))? flag: false;
+   for (LONG i = 0; i < 4; i++) other->enqueue(i);
+   other->size();
+   SlipCell& middle = *(SlipCell*)header->getTop().getRightLink();
+   middle.insLeft((LONG)100);
+   flag = (checkHeaderSize("interior insLeft", header))? flag: false;
+   (*(SlipCell*)other->getTop().getRightLink()).insRight((LONG)100);
+   flag = (checkHeaderSize("interior insRight other list", other))? flag: false;
+   other->flush();
+   header->size();
+   delete &middle.unLink();
+   flag = (checkHeaderSize("interior unLink", header))? flag: false;
+   delete &header->getBot().unLink();
+   flag = (checkHeaderSize("bottom unLink", header))? flag: false;
+   for (LONG i = 0; i < 4; i++) other->enqueue(i);
+   other->size();
+   header->getBot().moveListRight(*other);
+   flag = (checkHeaderSize("moveListRight", header))? flag: false;
+   flag = (checkHeaderSize("moveListRight source", other))? flag: false;
+   for (LONG i = 0; i < 4; i++) other->enqueue(i);
+   header->getTop().moveListLeft(*other);
+   flag = (checkHeaderSize("moveListLeft", header))? flag: false;
+   SlipHeader& left = header->splitLeft(*(SlipCell*)header->getTop().getRightLink()->getRightLink());
+   flag = (checkHeaderSize("splitLeft", header))? flag: false;
+   flag = (checkHeaderSize("splitLeft new list", &left))? flag: false;
+   SlipHeader& right = header->splitRight(*(SlipCell*)header->getTop().getRightLink());
+   flag = (checkHeaderSize("splitRight", header))? flag: false;
+   flag = (checkHeaderSize("splitRight new list", &right))? flag: false;
+   header->flush();
+   flag = (checkHeaderSize("flush", header))? flag: false;
+   left.deleteList();
+   right.deleteList();
+   other->deleteList();
+   header->deleteList();
+   flag = (testHeaderReduce())? flag: false;
+   flag = (testPackedList())? flag: false;
+   flag = (testUnrolledList())? flag: false;
+   high_resolution_clock::time_point end =  high_resolution_clock::now();
+   duration<double> seconds = duration_cast<duration<double>>(end - start);
+   testResultOutput("Test Header Size", seconds.count(), flag);
+   return flag;
+}; // bool testHeaderSize()
+
 bool testMoveLeft() {
    stringstream pretty;
    high_resolution_clock::time_point start =  high_resolution_clock::now();
@@ -36,6 +36,7 @@ extern bool testDequeue();
 extern bool testDList();
 extern bool testEnqueue();
 extern bool testHeaderMisc();
+extern bool testHeaderSize();
 extern bool testMoveLeft();
 extern bool testMoveRight();
 extern bool testPop();
@@ -22,16 +22,21 @@
 
 # include <cstdio>
 # include <cstdio>
+# include <cstring>
 # include <ctime>
 # include <fstream>
 # include <iostream>
 # include <sstream>
+# include <thread>
 # include <unistd.h>
+# include <vector>
 
 # include "../libgslip/SlipDatum.h"
 # include "../libgslip/SlipHeader.h"
+# include "../libgslip/SlipMappedRead.h"
 # include "../libgslip/SlipPointer.h"
 # include "../libgslip/SlipRead.h"
+# include "../libgslip/SlipReadBinary.h"
 # include "../libgslip/SlipSequencer.h"
 
 # include "TestGlobal.h"
@@ -442,6 +447,415 @@ bool testUserDataIO() {
    return flag;
 }; // testUserDataIO()1
 
+/**
+ * @brief Test binary I/O.
+ * <p>A list with each data type, a shared sublist, user marks, a
+ *    descriptor list and User Data is output and input in binary form.
+ *    The input list must be the same as the output list, the shared
+ *    sublist must be shared and DOUBLE values must be exact.</p>
+ * @return <b>true</b> if test successful
+ */
+bool testBinaryIO() {
+   stringstream pretty;
+   bool flag = true;
+   class BP : public SlipPointer {
+      SlipHeader* list;
+      static
+      const string* bpName() { static const string name("BP"); return &name; }
+   public:
+      BP(SlipHeader* list) : SlipPointer(bpName()), list(list) {}
+      virtual ~BP() { list->deleteList(); }
+      virtual BP*      copy( )        {return new BP(new SlipHeader(list)); }
+      virtual Parse    getParse()     { return &parse; };
+      static  SlipDatum& parse(SlipHeader& head) { return *new SlipDatum(new BP(&head)); };
+      virtual void     remove() const { delete this; }
+      virtual string   dump() const   { return list->dump(); }
+      virtual string   toString() const { return list->writeToString(); }
+      virtual string   write() const    { return toString(); }
+      virtual bool     toList(SlipHeader& out) const {
+         for (SlipCell& cell : *list) out.enqueue(cell);
+         return true;
+      }
+   }; // class BP : SlipPointer
+
+   SlipHeader* shared = new SlipHeader();
+   SlipHeader* empty  = new SlipHeader();
+   SlipHeader* udList = new SlipHeader();
+   SlipHeader* output = new SlipHeader();
+
+   shared->enqueue((LONG)-7).enqueue((string)"shared").putMark(3);
+   udList->enqueue((LONG)42).enqueue(*shared);
+   output->enqueue(true).enqueue((CHAR)-5).enqueue((UCHAR)250)
+          .enqueue((LONG)-123456).enqueue((ULONG)4000000000u)
+          .enqueue(0.1).enqueue(1.0/3.0).enqueue(-2.5e-300)
+          .enqueue((string)"s").enqueue((string)"a string too long to be held in a cell")
+          .enqueue(*shared).enqueue(*empty).enqueue(*shared)
+          .enqueue(*new SlipDatum(new BP(udList)));
+   output->create_dList().enqueue((LONG)1).enqueue(*shared);
+   output->putMark(12);
+   shared->deleteList();
+   empty->deleteList();
+
+   SlipDatum& udDatum = (SlipDatum&)output->getBot();
+   stringstream binary;
+   if (!output->writeBinary(binary)) {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "writeBinary failed");
+   }
+   SlipReadBinary reader(udDatum);
+   SlipHeader& input = reader.read(binary);
+   if (reader.getError() != 0) {
+      flag = false;
+      pretty << "read error " << reader.getError();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   if (!compareLists(*output, input)) {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "error on binary list");
+      pretty << "output " << output->writeToString();
+      writeDiagnostics(__FILE__, pretty.str());
+      pretty << "input  " << input.writeToString();
+      writeDiagnostics(__FILE__, pretty.str());
+   }
+
+   vector<SlipHeader*> sublists;
+   for (SlipCell& cell : input)
+      if (cell.isSublist()) sublists.push_back(&((SlipSublist&)cell).getHeader());
+   if ((sublists.size() != 3) || (sublists[0] != sublists[2]) || (sublists[0] == sublists[1])) {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "shared sublist is not shared");
+   } else {
+      SlipCell& dCell = input.getDList().getBot();
+      if (!dCell.isSublist() || (&((SlipSublist&)dCell).getHeader() != sublists[0])) {
+         flag = false;
+         writeDiagnostics(__FILE__, __LINE__, "descriptor list sublist is not shared");
+      }
+      if (sublists[0]->getRefCount() != 3) {                                   // 4 references less the creator
+         flag = false;
+         pretty << "shared sublist reference count " << sublists[0]->getRefCount() << " != 3";
+         writeDiagnostics(__FILE__, __LINE__, pretty.str());
+      }
+   }
+
+   SlipHeader::iterator in = input.begin();
+   for (SlipCell& cell : *output) {
+      if (cell.isData() && (cell.getClassType() == eDOUBLE) && in->isData()) {
+         DOUBLE x = (DOUBLE)(SlipDatum&)cell;
+         DOUBLE y = (DOUBLE)(SlipDatum&)*in;
+         if (memcmp(&x, &y, sizeof(DOUBLE))) {
+            flag = false;
+            pretty << "DOUBLE " << setprecision(17) << x << " != " << y;
+            writeDiagnostics(__FILE__, __LINE__, pretty.str());
+         }
+      }
+      ++in;
+   }
+
+   SlipCell& udInput = input.getBot();
+   if (!udInput.isPtr() || (udInput.toString() != udDatum.toString())) {
+      flag = false;
+      pretty << "User Data output " << udDatum.toString() << " input " << udInput.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   input.deleteList();
+
+   string binName = filenameBase + ".slb";
+   if (output->writeBinary(binName)) {
+      SlipReadBinary fileReader(udDatum);
+      SlipHeader& fileInput = fileReader.read(binName);
+      if ((fileReader.getError() != 0) || !compareLists(*output, fileInput)) {
+         flag = false;
+         writeDiagnostics(__FILE__, __LINE__, "error on binary list file");
+      }
+      fileInput.deleteList();
+      remove(binName.c_str());
+   } else {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "writeBinary to a file failed");
+   }
+
+   output->deleteList();
+
+   if (!flag) testResultOutput("Test Binary I/O", 0.0, flag);
+   return flag;
+}; // bool testBinaryIO()
+
+/**
+ * @brief Test mapped binary input.
+ * <p>A list with nested and shared sublists is output in binary form
+ *    and input from the mapped file. Only the top list is input when the
+ *    file is opened, a sublist is input when it is entered or loaded.
+ *    The input list must be the same as the output list and the shared
+ *    sublist must be shared.</p>
+ * @return <b>true</b> if test successful
+ */
+bool testMappedIO() {
+   stringstream pretty;
+   bool flag = true;
+   SlipHeader* nested = new SlipHeader();
+   SlipHeader* inner  = new SlipHeader();
+   SlipHeader* shared = new SlipHeader();
+   SlipHeader* last   = new SlipHeader();
+   SlipHeader* output = new SlipHeader();
+
+   nested->enqueue((LONG)3).enqueue(2.5);
+   inner->enqueue((LONG)2).enqueue(*nested).putMark(5);
+   shared->enqueue((string)"shared");
+   last->enqueue((LONG)4);
+   output->enqueue((LONG)1).enqueue(*inner).enqueue(*shared)
+          .enqueue(*shared).enqueue(*last);
+   nested->deleteList();
+   inner->deleteList();
+   shared->deleteList();
+   last->deleteList();
+
+   string binName = filenameBase + ".slb";
+   if (!output->writeBinary(binName)) {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "writeBinary to a file failed");
+   } else {
+      SlipMappedRead* file = new SlipMappedRead();
+      SlipHeader& input = file->open(binName);
+      vector<SlipSublist*> sublists;
+      for (SlipCell& cell : input)
+         if (cell.isSublist()) sublists.push_back(&(SlipSublist&)cell);
+      if ((file->getError() != 0) || (file->getListCount() != 5) || (file->getLoadedCount() != 1)) {
+         flag = false;
+         pretty << "open error " << file->getError() << " lists " << file->getListCount()
+                << " loaded " << file->getLoadedCount();
+         writeDiagnostics(__FILE__, __LINE__, pretty.str());
+      } else if ((sublists.size() != 4) || !(*sublists[1] == *sublists[2])) {
+         flag = false;
+         writeDiagnostics(__FILE__, __LINE__, "shared sublist is not shared");
+      } else {
+         if ((sublists[3]->getHeader().size() != 1) || !SlipMappedRead::isLoaded(sublists[3]->getHeader())
+           || (file->getLoadedCount() != 2)) {
+            flag = false;
+            writeDiagnostics(__FILE__, __LINE__, "sublist is not input when it is used");
+         }
+         string copyName = filenameBase + "Mapped.slb";
+         SlipHeader* copy = new SlipHeader();
+         *copy = input;
+         if (!copy->writeBinary(copyName)) {
+            flag = false;
+            writeDiagnostics(__FILE__, __LINE__, "writeBinary of a mapped list failed");
+         } else {
+            SlipReadBinary reader;
+            SlipHeader& reread = reader.read(copyName);
+            if (!compareLists(*output, reread)) {
+               flag = false;
+               writeDiagnostics(__FILE__, __LINE__, "mapped list is not written whole");
+            }
+            reread.deleteList();
+            remove(copyName.c_str());
+         }
+         copy->deleteList();
+         if (!compareLists(*output, input)) {
+            flag = false;
+            writeDiagnostics(__FILE__, __LINE__, "error on mapped list");
+         }
+         if ((file->getLoadedCount() != file->getListCount()) || (file->getError() != 0)) {
+            flag = false;
+            pretty << "lists " << file->getListCount() << " loaded " << file->getLoadedCount();
+            writeDiagnostics(__FILE__, __LINE__, pretty.str());
+         }
+      }
+      delete file;
+      input.deleteList();
+      remove(binName.c_str());
+   }
+   output->deleteList();
+
+   if (!flag) testResultOutput("Test Mapped I/O", 0.0, flag);
+   return flag;
+}; // bool testMappedIO()
+
+/**
+ * @brief Test list I/O through memory.
+ * <p>A list with a shared sublist is output to a caller buffer and input
+ *    from the buffer and from a stream without a file. The list is large
+ *    enough for the stream input to grow the scanner buffer. A buffer
+ *    which is too small must return the length of the whole output.</p>
+ * @return <b>true</b> if test successful
+ */
+bool testMemoryIO() {
+   stringstream pretty;
+   bool flag = true;
+   SlipHeader* shared = new SlipHeader();
+   SlipHeader* output = new SlipHeader();
+   shared->enqueue((LONG)1).enqueue((string)"shared").putMark(7);
+   output->enqueue(*shared).enqueue((ULONG)2).enqueue(*shared);
+   for (LONG i = 0; i < 4000; i++) output->enqueue(i);
+   shared->deleteList();
+
+   char small[16];
+   stringstream text;
+   output->write(text);
+   size_t length = output->write(small, sizeof(small));
+   if ((length != text.str().size()) || memcmp(small, text.str().data(), sizeof(small))) {
+      flag = false;
+      pretty << "write to a small buffer length " << length << " != " << text.str().size();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+
+   vector<char> buffer(length);
+   if (output->write(buffer.data(), buffer.size()) != length) {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "write to a buffer failed");
+   } else {
+      SlipRead* reader = new SlipRead();
+      SlipHeader& input = reader->read(buffer.data(), buffer.size());
+      if ((reader->getError() != 0) || !compareLists(*output, input)) {
+         flag = false;
+         writeDiagnostics(__FILE__, __LINE__, "error on list read from a buffer");
+      }
+      delete reader;
+      input.deleteList();
+   }
+
+   istringstream in(text.str());
+   SlipRead* reader = new SlipRead();
+   SlipHeader& input = reader->read(in);
+   if ((reader->getError() != 0) || !compareLists(*output, input)) {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "error on list read from a stream");
+   } else if (&((SlipSublist&)input.getTop()).getHeader()
+           != &((SlipSublist&)*input.getTop().getRightLink()->getRightLink()).getHeader()) {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "shared sublist is not shared");
+   }
+   delete reader;
+   input.deleteList();
+   output->deleteList();
+
+   if (!flag) testResultOutput("Test Memory I/O", 0.0, flag);
+   return flag;
+}; // bool testMemoryIO()
+
+/**
+ * @brief Read list files from a buffer on a thread.
+ * @param[in] text (const string*) list file
+ * @param[out] input (vector&lt;SlipHeader*&gt;*) lists read
+ */
+static void readLists(const string* text, vector<SlipHeader*>* input) {
+   for (size_t i = 0; i < input->size(); i++) {
+      SlipRead reader;
+      SlipHeader& list = reader.read(text->data(), text->size());
+      (*input)[i] = (reader.getError() == 0)? &list: NULL;
+   }
+}; // static void readLists(const string* text, vector<SlipHeader*>* input)
+
+/**
+ * @brief Test concurrent list input.
+ * <p>Each thread reads a different list file several times with its
+ *    own SlipRead object. Each list read must be the same as the list
+ *    written.</p>
+ * @return <b>true</b> if test successful
+ */
+bool testConcurrentIO() {
+   const int THREADS = 4;
+   const int READS   = 8;
+   stringstream pretty;
+   bool flag = true;
+   SlipHeader*                 output[THREADS];
+   string                      text[THREADS];
+   vector<SlipHeader*>         input[THREADS];
+   vector<thread>              workers;
+
+   for (int i = 0; i < THREADS; i++) {
+      SlipHeader* shared = new SlipHeader();
+      shared->enqueue((LONG)i).enqueue((string)"shared");
+      output[i] = new SlipHeader();
+      output[i]->enqueue(*shared).enqueue((string)"list").enqueue(*shared);
+      for (LONG j = 0; j < 500 * (i + 1); j++) output[i]->enqueue(j);
+      shared->deleteList();
+      stringstream out;
+      output[i]->write(out);
+      text[i] = out.str();
+      input[i].resize(READS);
+   }
+   for (int i = 0; i < THREADS; i++)
+      workers.push_back(thread(readLists, &text[i], &input[i]));
+   for (int i = 0; i < THREADS; i++)
+      workers[i].join();
+
+   for (int i = 0; i < THREADS; i++) {
+      for (int j = 0; j < READS; j++) {
+         if ((input[i][j] == NULL) || !compareLists(*output[i], *input[i][j])) {
+            flag = false;
+            pretty << "error on thread " << i << " read " << j;
+            writeDiagnostics(__FILE__, __LINE__, pretty.str());
+         }
+         if (input[i][j]) input[i][j]->deleteList();
+      }
+      output[i]->deleteList();
+   }
+
+   if (!flag) testResultOutput("Test Concurrent I/O", 0.0, flag);
+   return flag;
+}; // bool testConcurrentIO()
+
+/**
+ * @brief Test parallel loading of include files.
+ * <p>A list file includes independent include files and an include file
+ *    which references a list of another include file. The list read
+ *    with parallel loading must be the same as the list read in place.</p>
+ * @return <b>true</b> if test successful
+ */
+bool testParallelIO() {
+   stringstream pretty;
+   bool flag = true;
+   const int FILES = 3;
+   string includeName[FILES];
+   string includeFileData[FILES] = { "list1 ( 1 2 );"
+                                   , "list2 ( 3 {list1} );"
+                                   , "list3 ( < 4 5 > 6 7 );"
+                                   };
+   string listFileData;
+   ofstream out;
+
+   for (int i = 0; i < FILES; i++) {
+      pretty.str("");
+      pretty << filenameBase << "_" << i;
+      includeName[i] = pretty.str();
+      listFileData += "# include \"" + includeName[i] + "\"\n";
+      if (flag && (flag = openFile(out, includeName[i]))) {
+         out << includeFileData[i];
+         out.close();
+      }
+   }
+   listFileData += " ( {list1} {list2} {list3} )";
+   pretty.str("");
+
+   if (flag && (flag = openFile(out, filename))) {
+      out << listFileData;
+      out.close();
+      SlipRead* serial = new SlipRead();
+      SlipHeader& output = serial->read(filename);
+      SlipRead* parallel = new SlipRead();
+      parallel->setParallelON(FILES);
+      SlipHeader& input = parallel->read(filename);
+      if ((parallel->getError() != 0) || !compareLists(output, input)) {
+         flag = false;
+         writeDiagnostics(__FILE__, __LINE__, "error on parallel include");
+         pretty << "serial    " << output.writeToString();
+         writeDiagnostics(__FILE__, pretty.str());
+         pretty.str("");
+         pretty << "parallel  " << input.writeToString();
+         writeDiagnostics(__FILE__, pretty.str());
+      }
+      delete serial;
+      delete parallel;
+      output.deleteList();
+      input.deleteList();
+      remove(filename.c_str());
+   }
+   for (int i = 0; i < FILES; i++) remove(includeName[i].c_str());
+
+   if (!flag) testResultOutput("Test Parallel Include", 0.0, flag);
+   return flag;
+}; // bool testParallelIO()
+
 /**
  * @brief Test driver
  * @return <b>true</b> if all subtests are successful
@@ -468,6 +882,11 @@ bool testIO() {
    flag = (testMarkListIO())?        flag: false;
    flag = (testUserDataIO())?        flag: false;
    flag = (testInclude())?           flag: false;
+   flag = (testBinaryIO())?          flag: false;
+   flag = (testMappedIO())?          flag: false;
+   flag = (testMemoryIO())?          flag: false;
+   flag = (testConcurrentIO())?      flag: false;
+   flag = (testParallelIO())?        flag: false;
 
    remove(filename.c_str());
    
@@ -32,6 +32,9 @@
 # include <iomanip>
 # include <iostream>
 # include <sstream>
+# include <atomic>
+# include <thread>
+# include <vector>
 
 # include "TestMisc.h"
 # include "TestGlobal.h"
@@ -149,3 +152,262 @@ bool testDatum() {
    testResultOutput("Test Datum", seconds.count(), flag);
    return flag;
 }; // void testDatum()
+
+static void buildList(int size) {
+   for (int j = 0; j < 4; j++) {
+      SlipHeader* header = new SlipHeader();
+      for (int i = 0; i < size; i++)
+         header->enqueue((LONG)i);
+      header->deleteList();
+   }
+}; // static void buildList(int size)
+
+static void growLists(int size, atomic<int>* bad) {
+   const int LISTS = 4;
+   SlipHeader* header[LISTS];
+   try {
+      for (int j = 0; j < LISTS; j++) {
+         header[j] = new SlipHeader();
+         for (int i = 0; i < size; i++)
+            header[j]->enqueue((LONG)i);
+      }
+   } catch (SlipException& e) {                                                 // E3022 cell not in the fragment index
+      bad->fetch_add(1);
+      return;
+   }
+   for (int j = 0; j < LISTS; j++) {
+      int cells = 0;
+      for (SlipCellBase* link = header[j]->getRightLink(); !link->isHeader(); link = link->getRightLink())
+         cells++;
+      if (cells != size) bad->fetch_add(1);
+      header[j]->deleteList();
+   }
+}; // static void growLists(int size, atomic<int>* bad)
+
+bool testThreads() {
+   high_resolution_clock::time_point start =  high_resolution_clock::now();
+   const int THREADS = 4;
+   SlipState state = SlipCellBase::getSlipState();
+   ULONG     total = state.total;
+   ULONG     used  = state.total - state.avail;
+   bool      flag  = true;
+   vector<thread> workers;
+
+   for (int i = 0; i < THREADS; i++)
+      workers.push_back(thread(buildList, 1000 * (i + 1)));
+   for (int i = 0; i < THREADS; i++)
+      workers[i].join();
+
+   state = SlipCellBase::getSlipState();
+   used += (state.total - total) / INITIALALLOCATION;                           // one fragment list cell per heap allocation
+   if ((state.total - state.avail) > used) {
+      flag = false;
+      stringstream msg;
+      msg << "Test Threads cells in use " << (state.total - state.avail)
+          << " should be at most " << used;
+      writeDiagnostics(__FILE__, __LINE__, msg.str());
+   }
+
+   /*
+    * The threads together hold more cells than are free, so the AVSL
+    * grows while they compete for cells. A cell taken from a fragment
+    * not yet in the fragment index is refused by insLeft and leaks on
+    * delete.
+    */
+   const int GROWERS = 8;
+   atomic<int> bad(0);
+   total   = state.total;
+   used    = state.total - state.avail;
+   workers.clear();
+   SlipCellBase::setAVSLGrowth(2, 5000);                                        // fragments larger than a cache batch
+   for (int i = 0; i < GROWERS; i++)
+      workers.push_back(thread(growLists, (int)(state.avail / (4 * GROWERS)) + 20000, &bad));
+   for (int i = 0; i < GROWERS; i++)
+      workers[i].join();
+   SlipCellBase::setAVSLGrowth(1, DELTAALLOCATION);
+   state = SlipCellBase::getSlipState();
+   used += (state.total - total) / INITIALALLOCATION;                           // one fragment list cell per heap allocation
+   if ((bad.load() != 0) || ((state.total - state.avail) > used)) {
+      flag = false;
+      stringstream msg;
+      msg << "Test Threads growth, lists wrong " << bad.load() << " cells in use "
+          << (state.total - state.avail) << " should be at most " << used;
+      writeDiagnostics(__FILE__, __LINE__, msg.str());
+   }
+
+   high_resolution_clock::time_point end =  high_resolution_clock::now();
+   duration<double> seconds = duration_cast<duration<double>>(end - start);
+   testResultOutput("Test Threads", seconds.count(), flag);
+   return flag;
+}; // bool testThreads()
+
+bool testGrowth() {
+   high_resolution_clock::time_point start =  high_resolution_clock::now();
+   const int SIZE  = 5000;
+   SlipState state = SlipCellBase::getSlipState();
+   ULONG     total = state.total;
+   ULONG     used  = state.total - state.avail;
+   bool      flag  = true;
+
+   SlipCellBase::setAVSLGrowth(2, 1000);
+   SlipCellBase::setAVSLSource(eMap);
+   SlipHeader* header = new SlipHeader();
+   for (int i = 0; i < SIZE; i++)
+      header->enqueue((LONG)i);
+   LONG sum = 0;
+   SlipSequencer* sequencer = new SlipSequencer(*header);
+   while(!sequencer->advanceLWR().isHeader())
+      sum += (LONG)(SlipDatum&)sequencer->currentCell();
+   delete sequencer;
+   header->deleteList();
+   SlipCellBase::setAVSLSource(eHeap);
+   SlipCellBase::setAVSLGrowth(1, DELTAALLOCATION);
+
+   if (sum != (SIZE * (SIZE - 1)) / 2) {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "Test Growth list sum is wrong");
+   }
+   state = SlipCellBase::getSlipState();
+   ULONG fragments = (state.total - total) / INITIALALLOCATION;                 // upper bound on new fragments
+   if ((state.total - state.avail) > used + fragments) {
+      flag = false;
+      stringstream msg;
+      msg << "Test Growth cells in use " << (state.total - state.avail)
+          << " should be at most " << (used + fragments);
+      writeDiagnostics(__FILE__, __LINE__, msg.str());
+   }
+
+   high_resolution_clock::time_point end =  high_resolution_clock::now();
+   duration<double> seconds = duration_cast<duration<double>>(end - start);
+   testResultOutput("Test Growth", seconds.count(), flag);
+   return flag;
+}; // bool testGrowth()
+
+bool testReclaim() {
+   high_resolution_clock::time_point start =  high_resolution_clock::now();
+   const int SIZE  = 2000;
+   const int CELLS = 100;
+   SlipState state = SlipCellBase::getSlipState();
+   ULONG     total = state.total;
+   ULONG     used  = state.total - state.avail;
+   bool      flag  = true;
+
+   SlipCellBase::setReclaimBudget(4);
+   SlipHeader* header = new SlipHeader();
+   SlipHeader* other  = new SlipHeader();
+   for (int i = 0; i < SIZE; i++)
+      header->enqueue((LONG)i);
+   for (int i = 0; i < CELLS; i++)
+      other->enqueue((LONG)i);
+   SlipDatum* stale = (SlipDatum*)header->getLeftLink();                        // bottom cell of the deferred list
+   SlipState before = SlipCellBase::getSlipState();
+   header->deleteList();
+   other->deleteList();
+   header->deleteList();                                                        // deferred list is already deleted
+   delete stale;                                                                // deferred cell is already deleted
+   state = SlipCellBase::getSlipState();
+   if (state.total - state.avail != before.total - before.avail) {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "Test Reclaim stale deferred cell was deleted again");
+   }
+   state = SlipCellBase::getSlipState();
+   if (state.avail != before.avail) {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "Test Reclaim list cells were not deferred");
+   }
+   SlipDatum* data[CELLS];
+   for (int i = 0; i < CELLS; i++)
+      data[i] = new SlipDatum((LONG)i);
+   state = SlipCellBase::getSlipState();
+   if (state.total != before.total) {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "Test Reclaim deferred cells were not reused");
+   }
+   for (int i = 0; i < CELLS; i++)
+      delete data[i];
+   while(SlipCellBase::reclaim(100) > 0);
+   SlipCellBase::setReclaimBudget(0);
+
+   state = SlipCellBase::getSlipState();
+   if ((state.total - state.avail) < used) {
+      flag = false;
+      stringstream msg;
+      msg << "Test Reclaim cells in use " << (state.total - state.avail)
+          << " should be at least " << used;
+      writeDiagnostics(__FILE__, __LINE__, msg.str());
+   }
+   ULONG fragments = (state.total - total) / INITIALALLOCATION;                 // upper bound on new fragments
+   if ((state.total - state.avail) > used + fragments) {
+      flag = false;
+      stringstream msg;
+      msg << "Test Reclaim cells in use " << (state.total - state.avail)
+          << " should be at most " << (used + fragments);
+      writeDiagnostics(__FILE__, __LINE__, msg.str());
+   }
+
+   high_resolution_clock::time_point end =  high_resolution_clock::now();
+   duration<double> seconds = duration_cast<duration<double>>(end - start);
+   testResultOutput("Test Reclaim", seconds.count(), flag);
+   return flag;
+}; // bool testReclaim()
+
+bool testTrim() {
+   high_resolution_clock::time_point start =  high_resolution_clock::now();
+   const int SIZE  = 5000;
+   bool      flag  = true;
+
+   SlipCellBase::trim();
+   SlipState before = SlipCellBase::getSlipState();
+   SlipCellBase::setAVSLGrowth(2, 2000);
+   SlipCellBase::setAVSLSource(eMap);
+   SlipHeader* header = new SlipHeader();
+   SlipHeader* inner  = new SlipHeader();
+   inner->enqueue((LONG)0);
+   for (int i = 0; i < SIZE; i++) {
+      if      ((i % 1000) == 0) header->enqueue(*inner);
+      else if ((i % 2) == 0)    header->enqueue(string("trim"));
+      else                      header->enqueue((LONG)i);
+   }
+   inner->deleteList();
+   header->deleteList();
+   SlipCellBase::setAVSLSource(eHeap);
+   SlipCellBase::setAVSLGrowth(1, DELTAALLOCATION);
+
+   SlipState state = SlipCellBase::getSlipState();
+   ULONG     used  = state.total - state.avail;
+   size_t    bytes = SlipCellBase::trim();
+   SlipState after = SlipCellBase::getSlipState();
+   if ((bytes == 0) || (after.total > before.total)) {
+      flag = false;
+      stringstream msg;
+      msg << "Test Trim released " << bytes << " bytes, total cells "
+          << state.total << " -> " << after.total << " should be at most " << before.total;
+      writeDiagnostics(__FILE__, __LINE__, msg.str());
+   }
+   if ((after.total - after.avail) > used) {
+      flag = false;
+      stringstream msg;
+      msg << "Test Trim cells in use " << (after.total - after.avail)
+          << " should be at most " << used;
+      writeDiagnostics(__FILE__, __LINE__, msg.str());
+   }
+
+   header = new SlipHeader();
+   for (int i = 0; i < SIZE; i++)
+      header->enqueue((LONG)i);
+   LONG sum = 0;
+   SlipSequencer* sequencer = new SlipSequencer(*header);
+   while(!sequencer->advanceLWR().isHeader())
+      sum += (LONG)(SlipDatum&)sequencer->currentCell();
+   delete sequencer;
+   header->deleteList();
+   if (sum != (SIZE * (SIZE - 1)) / 2) {
+      flag = false;
+      writeDiagnostics(__FILE__, __LINE__, "Test Trim list sum is wrong after trim");
+   }
+
+   high_resolution_clock::time_point end =  high_resolution_clock::now();
+   duration<double> seconds = duration_cast<duration<double>>(end - start);
+   testResultOutput("Test Trim", seconds.count(), flag);
+   return flag;
+}; // bool testTrim()
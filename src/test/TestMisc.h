@@ -35,7 +35,11 @@
 extern bool testAllocation();
 extern bool testDatum();
 extern bool testGetSpace();
+extern bool testGrowth();
 extern bool testIntrinsics();
+extern bool testReclaim();
+extern bool testThreads();
+extern bool testTrim();
 
 #endif	/* TESTMISC_H */
 
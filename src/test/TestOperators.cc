@@ -35,7 +35,9 @@
 # include <typeinfo>
 
 # include "../libgslip/Slip.h"
+# include "../libgslip/SlipExpr.h"
 # include "../libgslip/SlipSublist.h"
+# include "../libgslip/SlipStringInterned.h"
 # include "TestOperators.h"
 # include "TestGlobal.h"
 # include "TestUtilities.h"
@@ -826,6 +828,78 @@ bool testArithmeticNonDiscreteOperators() {
  * <op>      is any of (+=, -=, *=, /=, %=, <<=, >>=, &=, |=, ^=)
  *           as appropriate
  *******************************************************************/
+bool testArithmeticTable() {
+   bool flag = true;
+   stringstream pretty;
+   SlipDatum  b((bool)true);
+   SlipDatum  c((CHAR)-5);
+   SlipDatum  uc((UCHAR)200);
+   SlipDatum  l((LONG)-7);
+   SlipDatum  ul((ULONG)13);
+   SlipDatum  d((DOUBLE)2.5);
+
+   SlipDatum  sum = uc + ul;
+   if ((sum.getClassType() != eULONG) || ((ULONG)sum != 213)) {
+      flag = false;
+      pretty << "Arithmetic table failure UCHAR + ULONG " << sum.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   SlipDatum  diff = c - uc;
+   if ((diff.getClassType() != eLONG) || ((LONG)diff != -205)) {
+      flag = false;
+      pretty << "Arithmetic table failure CHAR - UCHAR " << diff.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   SlipDatum  prod = l * d;
+   if (!prod.isReal() || ((DOUBLE)prod != -17.5)) {
+      flag = false;
+      pretty << "Arithmetic table failure LONG * DOUBLE " << prod.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   SlipDatum  quot = b / c;
+   if ((quot.getClassType() != eLONG) || ((LONG)quot != 0) || ((l % c) != -2) || ((uc % ul) != 5)) {
+      flag = false;
+      pretty << "Arithmetic table failure bool / CHAR " << quot.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+
+   if (!flag) testResultOutput("Test Arithmetic Table ", 0.0, flag);
+   return flag;
+}; // bool testArithmeticTable()
+bool testExpressionTemplates() {
+   bool flag = true;
+   stringstream pretty;
+   SlipDatum  a((DOUBLE)1.0);
+   SlipDatum  b((LONG)-3);
+   SlipDatum  c((DOUBLE)2.0);
+   SlipDatum  uc((UCHAR)200);
+   SlipDatum  ul((ULONG)13);
+   SlipExpr<SlipExprLeaf> A = slipExpr(a), B = slipExpr(b), C = slipExpr(c);
+
+   SlipDatum  root = (-B + B*B - 4*A*C) / 2;
+   if (!root.isReal() || ((DOUBLE)root != 2.0)) {
+      flag = false;
+      pretty << "Expression failure (-b + b*b - 4*a*c)/2 " << root.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   SlipDatum  sum  = slipExpr(uc) + ul - b;
+   SlipDatum  temp = uc + ul;
+   SlipDatum  same = temp - b;
+   if ((sum.getClassType() != same.getClassType()) || ((ULONG)sum != (ULONG)same)) {
+      flag = false;
+      pretty << "Expression failure UCHAR + ULONG - LONG " << sum.toString() << " != " << same.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   SlipDatum  rem  = slipExpr(b) % 2;
+   if ((rem.getClassType() != eLONG) || ((LONG)rem != -1)) {
+      flag = false;
+      pretty << "Expression failure LONG % 2 " << rem.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+
+   if (!flag) testResultOutput("Test Expression Templates ", 0.0, flag);
+   return flag;
+}; // bool testExpressionTemplates()
 bool testAssignmentOperators() {
    bool flag = true;
    //                             operator+=          operator-=          operator*=          operator/=          operator%=          operator<<=         operator>>=         operator&=          operator|=          operator^=
@@ -2169,6 +2243,117 @@ bool testLogicalOperators() {
    if (!flag) testResultOutput("Test Logical Operators ", 0.0, flag);
    return flag;
 }; // bool testLogicalOperators()
+bool testStringLogicalOperators() {
+   bool flag = true;
+   stringstream pretty;
+   string    abc("abc");
+   SlipDatum constStr(&abc, true);                                              // borrowed string
+   SlipDatum localStr(string("abd"));                                           // copied string
+   SlipDatum number(string("53"));
+
+   if (!(constStr <  localStr) || (constStr >= localStr) || (constStr == localStr)
+    || !(localStr >  constStr) ||  (localStr <= constStr) || !(constStr != localStr)) {
+      flag = false;
+      pretty << "String failure \"abc\" <=> \"abd\"";
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   if (!(constStr == abc) || (constStr != abc) || !(localStr > abc) || !(localStr >= string("abc"))) {
+      flag = false;
+      pretty << "String failure SlipDatum <=> string";
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   if (!(number == (LONG)53) || !(number == (ULONG)53) || !(number == (DOUBLE)53.0)
+    || !(number <  (DOUBLE)54.0) || !(number > (LONG)-1) || (number != (ULONG)53)) {
+      flag = false;
+      pretty << "String failure \"53\" <=> 53";
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+
+   if (!flag) testResultOutput("Test String Logical Operators ", 0.0, flag);
+   return flag;
+}; // bool testStringLogicalOperators()
+bool testInlineStrings() {
+   bool flag = true;
+   stringstream pretty;
+   string    seven("1234567");
+   string    eight("12345678");
+   string    nul("a\0b", 3);
+   SlipHeader* head = new SlipHeader();
+   head->enqueue(seven).enqueue(eight).enqueue(string("")).enqueue(nul);
+   SlipDatum& first  = (SlipDatum&)head->getTop();
+   SlipDatum& second = (SlipDatum&)*first.getRightLink();
+   SlipDatum& third  = (SlipDatum&)*second.getRightLink();
+   SlipDatum& fourth = (SlipDatum&)*third.getRightLink();
+   SlipDatum  heap(&eight, true);                                               // constant strings are never inline
+
+   if ((first.dump().find("(inline)") == string::npos) || (second.dump().find("(inline)") != string::npos)) {
+      flag = false;
+      pretty << "Inline failure storage " << first.dump() << " " << second.dump();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   if (!first.isString() || (first.toString() != seven) || (first.write() != "\"1234567\"")
+    || (second.toString() != eight) || (third.toString() != "") || (fourth.toString() != nul)) {
+      flag = false;
+      pretty << "Inline failure toString/write " << first.toString() << " " << second.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   if (!(first < second) || !(second == heap) || !(heap > first) || (first == third)
+    || !(first == seven) || !(third < first) || (fourth != nul)) {
+      flag = false;
+      pretty << "Inline failure comparison";
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   SlipDatum copy(first);
+   first.replace(string("abc"));
+   if ((copy.toString() != seven) || (first.toString() != "abc") || !(first == string("abc"))) {
+      flag = false;
+      pretty << "Inline failure copy/replace " << copy.toString() << " " << first.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   head->deleteList();
+
+   if (!flag) testResultOutput("Test Inline Strings ", 0.0, flag);
+   return flag;
+}; // bool testInlineStrings()
+bool testInternedStrings() {
+   bool flag = true;
+   stringstream pretty;
+   ULONG     pool = SlipStringInterned::poolSize();
+   bool      mode = SlipDatum::internStrings(true);
+   SlipHeader* head = new SlipHeader();
+   for (int i = 0; i < 100; i++) {
+      head->enqueue(string("interned token"));
+      head->enqueue(string("interned other"));
+   }
+   SlipDatum  plain(string("interned token"));
+   SlipDatum& first  = (SlipDatum&)head->getTop();
+   SlipDatum& second = (SlipDatum&)*first.getRightLink();
+   SlipDatum& third  = (SlipDatum&)*second.getRightLink();
+
+   if (SlipStringInterned::poolSize() != pool + 2) {
+      flag = false;
+      pretty << "Interned failure pool size " << SlipStringInterned::poolSize() << " != " << pool + 2;
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   if (!(first == third) || (first != third) || (first == second) || !(first != second)
+    || !(second < first) || !(first == string("interned token"))) {
+      flag = false;
+      pretty << "Interned failure \"interned token\" <=> \"interned other\"";
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   SlipDatum::internStrings(false);
+   SlipDatum copied(string("interned token"));
+   if (!(copied == first) || !(first == copied) || !(plain == copied)) {
+      flag = false;
+      pretty << "Interned failure interned <=> non-interned";
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   head->deleteList();                                                          // strings are released when the cells are reused
+   SlipDatum::internStrings(mode);
+
+   if (!flag) testResultOutput("Test Interned Strings ", 0.0, flag);
+   return flag;
+}; // bool testInternedStrings()
 bool testMaskOperators() {
    stringstream pretty;
    bool flag = true;
@@ -2823,6 +3008,11 @@ bool testOperators() {
    flag = (testShiftOperators())?                 flag: false;
    flag = (testMaskOperators())?                  flag: false;
    flag = (testLogicalOperators())?               flag: false;
+   flag = (testStringLogicalOperators())?         flag: false;
+   flag = (testArithmeticTable())?                flag: false;
+   flag = (testExpressionTemplates())?            flag: false;
+   flag = (testInlineStrings())?                  flag: false;
+   flag = (testInternedStrings())?                flag: false;
    flag = (testAssignmentOperators())?            flag: false;
    
    high_resolution_clock::time_point end =  high_resolution_clock::now();
@@ -38,6 +38,7 @@
 
 # include "../libgslip/SlipDef.h"
 # include "../libgslip/SlipCell.h"
+# include "../libgslip/SlipCursor.h"
 # include "../libgslip/SlipDatum.h"
 # include "../libgslip/SlipHeader.h"
 # include "../libgslip/SlipReader.h"
@@ -63,6 +64,7 @@ bool testCurrentCell(SlipReader& reader, Intrinsics& test);
 bool testReaderAdvanceLinear();
 bool testReaderAdvanceStructural();
 bool testReaderCore();
+bool testReaderCursor();
 bool testReaderMoveSplit();
 bool testReaderMisc();
 bool testReaderOperators();
@@ -424,6 +426,82 @@ bool testReaderCore() {
    return flag;
 }; // bool testReaderCore()
 
+bool testReaderCursor() {
+   typedef SlipReader& (SlipReader::*ReaderAdvance)();
+   typedef SlipCursor& (SlipCursor::*CursorAdvance)();
+   struct { string name; ReaderAdvance reader; CursorAdvance cursor; } advance[] =
+      { { "advanceSEL", &SlipReader::advanceSEL, &SlipCursor::advanceSEL }
+      , { "advanceSER", &SlipReader::advanceSER, &SlipCursor::advanceSER }
+      , { "advanceSNL", &SlipReader::advanceSNL, &SlipCursor::advanceSNL }
+      , { "advanceSNR", &SlipReader::advanceSNR, &SlipCursor::advanceSNR }
+      , { "advanceSWL", &SlipReader::advanceSWL, &SlipCursor::advanceSWL }
+      , { "advanceSWR", &SlipReader::advanceSWR, &SlipCursor::advanceSWR }
+      };
+   bool flag = true;
+   stringstream pretty;
+   SlipHeader* header1 = new SlipHeader();                                      // ( ( () 22 () 24 25 () ) 12 ( () 22 () 24 25 () ) 14 )
+   SlipHeader* header2 = new SlipHeader();
+   SlipHeader* header3 = new SlipHeader();
+   header2->enqueue(*header3).enqueue((ULONG)22).enqueue(*header3).enqueue((ULONG)24).enqueue((ULONG)25).enqueue(*header3);
+   header1->enqueue(*header2).enqueue((ULONG)12).enqueue(*header2).enqueue((ULONG)14);
+   SlipHeader* header4 = new SlipHeader();                                      // ( 31 ( () 22 () 24 25 () ) 33 )
+   header4->enqueue((ULONG)31).enqueue(*header2).enqueue((ULONG)33);
+   SlipHeader* lists[] = { header1, header4, header3 };
+
+   for (unsigned i = 0; i < sizeof(advance)/sizeof(advance[0]) * 3; i++) {
+      SlipReader reader(*lists[i % 3]);
+      SlipCursor cursor(*lists[i % 3]);
+      for (int step = 0; step < 40; step++) {
+         (reader.*advance[i / 3].reader)();
+         (cursor.*advance[i / 3].cursor)();
+         if ((&reader.currentCell() != &cursor.currentCell()) || (reader.listDepth() != cursor.listDepth())
+          || (&reader.currentList() != &cursor.currentList())) {
+            flag = false;
+            pretty << "Test Reader Cursor " << advance[i / 3].name << " list " << (i % 3) << " step " << step << " " << cursor.toString();
+            writeDiagnostics(__FILE__, __LINE__, pretty.str());
+            break;
+         }
+         if (cursor.isHeader() && (cursor.listDepth() == 0)) break;
+      }
+   }
+
+   SlipCursor cursor(*header1);
+   cursor.advanceSER().advanceSER();
+   if (((ULONG)(SlipDatum&)cursor.currentCell() != 24) || (cursor.listDepth() != 1)
+    || ((void*)&cursor.upLevel().currentCell() != (void*)&header1->getTop())
+    || (cursor.advanceSNR().advanceSNR().listDepth() != 1) || (&cursor.currentList() != header2)
+    || ((void*)&cursor.resetTop().currentCell() != (void*)&header1->getTop()) || (cursor.listDepth() != 0)) {
+      flag = false;
+      pretty << "Test Reader Cursor levels " << cursor.toString();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+
+   const unsigned deep = 2 * SlipCursor::DEPTH;                                 // ( ( ... ( 0 ) ... 1 ) 1 )
+   SlipHeader* nest[deep + 1];
+   for (unsigned i = 0; i <= deep; i++) nest[i] = new SlipHeader();
+   nest[deep]->enqueue((LONG)0);
+   for (int i = deep - 1; i >= 0; i--) nest[i]->enqueue(*nest[i + 1]).enqueue((LONG)1);
+   SlipCursor down(*nest[0]);
+   LONG total = 0;
+   for (down.advanceSER(); !down.isHeader(); down.advanceSER()) total += (LONG)(SlipDatum&)down.currentCell();
+   LONG reverse = 0;
+   for (down.advanceSEL(); !down.isHeader(); down.advanceSEL()) reverse += (LONG)(SlipDatum&)down.currentCell();
+   if ((total != (LONG)deep) || (reverse != (LONG)deep) || (down.listDepth() != 0)) {
+      flag = false;
+      pretty << "Test Reader Cursor depth " << total << " " << reverse << " " << down.listDepth();
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   for (unsigned i = 0; i <= deep; i++) nest[i]->deleteList();
+
+   header4->deleteList();
+   header3->deleteList();
+   header2->deleteList();
+   header1->deleteList();
+   if (!flag)
+      testResultOutput("Test Reader Cursor", 0.0, flag);
+   return flag;
+}; // bool testReaderCursor()
+
 bool testReaderMisc() {
    stringstream pretty;
    bool flag = true;
@@ -664,6 +742,7 @@ bool testReaderMoveSplit() {
        *                      SplitRight                     *
        *******************************************************/
    *reader1 = *header2;
+   reader1->flush();
    reader2->flush();
    for(long i = 0; i < 10; i++)
       header2->insLeft((LONG) (i + 1));
@@ -1093,6 +1172,7 @@ bool testReader() {
    flag = (testReaderCore())?              flag: false;
    flag = (testReaderAdvanceLinear())?     flag: false;
    flag = (testReaderAdvanceStructural())? flag: false;
+   flag = (testReaderCursor())?            flag: false;
    flag = (testReaderMisc())?              flag: false;
    flag = (testReaderPushPop())?           flag: false;
    flag = (testReaderEnqueueDequeue())?    flag: false;
@@ -29,6 +29,7 @@
  *
  */
 
+# include <algorithm>
 # include <iostream>
 # include <sstream>
 
@@ -51,6 +52,7 @@ struct TestResults;
 bool testSequencerAdvanceLinear();
 bool testSequencerAdvanceStructural();
 bool testSequencerCore();
+bool testSequencerIterators();
 bool testSequencerMisc();
 bool testSequencerCell(string name, SlipSequencer* sequencer, bool flag, TestResults test);
 
@@ -402,6 +404,70 @@ bool testSequencerInsert() {
    return flag;
 }; // bool testSequencerInsert()
 
+bool testSequencerIterators() {
+   bool flag = true;
+   stringstream pretty;
+   SlipHeader* header1 = new SlipHeader();                                      // ( 1 ( 2 () 3 ( 4 5 ) ) 6 7 )
+   SlipHeader* header2 = new SlipHeader();
+   SlipHeader* header3 = new SlipHeader();
+   SlipHeader* header4 = new SlipHeader();
+   header4->enqueue((LONG)4).enqueue((LONG)5);
+   header2->enqueue((LONG)2).enqueue(*header3).enqueue((LONG)3).enqueue(*header4);
+   header1->enqueue((LONG)1).enqueue(*header2).enqueue((LONG)6).enqueue((LONG)7);
+
+   int cells = 0;
+   for (SlipCell& cell : *header1) if (cell.isData()) cells += (LONG)(SlipDatum&)cell;
+   const SlipHeader& list = *header1;
+   SlipHeader::const_iterator sublist = find_if(list.begin(), list.end(), [](const SlipCell& X) { return X.isSublist(); });
+   if ((cells != 14) || (distance(header1->begin(), header1->end()) != 4)
+    || (sublist == list.end()) || (&*sublist != &*++header1->begin())
+    || ((LONG)(SlipDatum&)*header1->rbegin() != 7) || (header3->begin() != header3->end())) {
+      flag = false;
+      pretty << "Test Sequencer Iterators linear " << cells;
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+
+   LONG expect = 1;
+   for (SlipCell& cell : header1->structure()) {
+      if ((LONG)(SlipDatum&)cell != expect++) {
+         flag = false;
+         pretty << "Test Sequencer Iterators structural " << cell.toString() << " expected " << (expect - 1);
+         writeDiagnostics(__FILE__, __LINE__, pretty.str());
+      }
+   }
+   if ((expect != 8) || (count_if(header3->sbegin(), header3->send(), [](SlipCell& X) { return true; }) != 0)) {
+      flag = false;
+      pretty << "Test Sequencer Iterators structural count " << (expect - 1);
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+
+   const unsigned deep = 2 * SlipStructuralIterator::DEPTH;                     // ( ( ... ( 0 ) ... 1 ) 1 )
+   SlipHeader* nest[deep + 1];
+   for (unsigned i = 0; i <= deep; i++) nest[i] = new SlipHeader();
+   nest[deep]->enqueue((LONG)0);
+   for (int i = deep - 1; i >= 0; i--) nest[i]->enqueue(*nest[i + 1]).enqueue((LONG)1);
+   LONG total = 0;
+   unsigned depth = 0;
+   for (SlipHeader::structural_iterator it = nest[0]->sbegin(); it != nest[0]->send(); ++it) {
+      total += (LONG)(SlipDatum&)*it;
+      depth = max(depth, it.getDepth());
+   }
+   if ((total != (LONG)deep) || (depth != deep)) {
+      flag = false;
+      pretty << "Test Sequencer Iterators depth " << total << " " << depth;
+      writeDiagnostics(__FILE__, __LINE__, pretty.str());
+   }
+   for (unsigned i = 0; i <= deep; i++) nest[i]->deleteList();
+
+   header4->deleteList();
+   header3->deleteList();
+   header2->deleteList();
+   header1->deleteList();
+   if (!flag)
+      testResultOutput("Test Sequencer Iterators", 0.0, flag);
+   return flag;
+}; // bool testSequencerIterators()
+
 bool testSequencerMisc() {
    bool flag = true;
    if (!flag)
@@ -710,6 +776,7 @@ bool testSequencer() {
    flag = (testSequencerOperators())?         flag: false;
    flag = (testSequencerInsert())?            flag: false;
    flag = (testSequencerReplace())?           flag: false;
+   flag = (testSequencerIterators())?         flag: false;
    
    high_resolution_clock::time_point end =  high_resolution_clock::now();
    duration<double> seconds = duration_cast<duration<double>>(end - start);